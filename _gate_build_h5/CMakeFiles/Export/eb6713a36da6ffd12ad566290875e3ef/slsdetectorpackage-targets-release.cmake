@@ -0,0 +1,106 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "slsSupportShared" for configuration "Release"
+set_property(TARGET slsSupportShared APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(slsSupportShared PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libSlsSupport.so.8.0.1"
+  IMPORTED_SONAME_RELEASE "libSlsSupport.so.8"
+  )
+
+list(APPEND _cmake_import_check_targets slsSupportShared )
+list(APPEND _cmake_import_check_files_for_slsSupportShared "${_IMPORT_PREFIX}/lib/libSlsSupport.so.8.0.1" )
+
+# Import target "slsSupportStatic" for configuration "Release"
+set_property(TARGET slsSupportStatic APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(slsSupportStatic PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libSlsSupportStatic.a"
+  )
+
+list(APPEND _cmake_import_check_targets slsSupportStatic )
+list(APPEND _cmake_import_check_files_for_slsSupportStatic "${_IMPORT_PREFIX}/lib/libSlsSupportStatic.a" )
+
+# Import target "md5sls" for configuration "Release"
+set_property(TARGET md5sls APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(md5sls PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "C"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libmd5sls.a"
+  )
+
+list(APPEND _cmake_import_check_targets md5sls )
+list(APPEND _cmake_import_check_files_for_md5sls "${_IMPORT_PREFIX}/lib/libmd5sls.a" )
+
+# Import target "slsDetectorShared" for configuration "Release"
+set_property(TARGET slsDetectorShared APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(slsDetectorShared PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libSlsDetector.so.8.0.1"
+  IMPORTED_SONAME_RELEASE "libSlsDetector.so.8"
+  )
+
+list(APPEND _cmake_import_check_targets slsDetectorShared )
+list(APPEND _cmake_import_check_files_for_slsDetectorShared "${_IMPORT_PREFIX}/lib/libSlsDetector.so.8.0.1" )
+
+# Import target "slsDetectorStatic" for configuration "Release"
+set_property(TARGET slsDetectorStatic APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(slsDetectorStatic PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libSlsDetectorStatic.a"
+  )
+
+list(APPEND _cmake_import_check_targets slsDetectorStatic )
+list(APPEND _cmake_import_check_files_for_slsDetectorStatic "${_IMPORT_PREFIX}/lib/libSlsDetectorStatic.a" )
+
+# Import target "slsReceiver" for configuration "Release"
+set_property(TARGET slsReceiver APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(slsReceiver PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/bin/slsReceiver"
+  )
+
+list(APPEND _cmake_import_check_targets slsReceiver )
+list(APPEND _cmake_import_check_files_for_slsReceiver "${_IMPORT_PREFIX}/bin/slsReceiver" )
+
+# Import target "slsMultiReceiver" for configuration "Release"
+set_property(TARGET slsMultiReceiver APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(slsMultiReceiver PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/bin/slsMultiReceiver"
+  )
+
+list(APPEND _cmake_import_check_targets slsMultiReceiver )
+list(APPEND _cmake_import_check_files_for_slsMultiReceiver "${_IMPORT_PREFIX}/bin/slsMultiReceiver" )
+
+# Import target "slsFrameSynchronizer" for configuration "Release"
+set_property(TARGET slsFrameSynchronizer APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(slsFrameSynchronizer PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/bin/slsFrameSynchronizer"
+  )
+
+list(APPEND _cmake_import_check_targets slsFrameSynchronizer )
+list(APPEND _cmake_import_check_files_for_slsFrameSynchronizer "${_IMPORT_PREFIX}/bin/slsFrameSynchronizer" )
+
+# Import target "slsReceiverShared" for configuration "Release"
+set_property(TARGET slsReceiverShared APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(slsReceiverShared PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libSlsReceiver.so.8.0.1"
+  IMPORTED_SONAME_RELEASE "libSlsReceiver.so.8"
+  )
+
+list(APPEND _cmake_import_check_targets slsReceiverShared )
+list(APPEND _cmake_import_check_files_for_slsReceiverShared "${_IMPORT_PREFIX}/lib/libSlsReceiver.so.8.0.1" )
+
+# Import target "slsReceiverStatic" for configuration "Release"
+set_property(TARGET slsReceiverStatic APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(slsReceiverStatic PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libSlsReceiverStatic.a"
+  )
+
+list(APPEND _cmake_import_check_targets slsReceiverStatic )
+list(APPEND _cmake_import_check_files_for_slsReceiverStatic "${_IMPORT_PREFIX}/lib/libSlsReceiverStatic.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,195 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS slsProjectOptions slsProjectWarnings slsSupportObject slsSupportShared slsSupportStatic md5sls slsDetectorObject slsDetectorShared slsDetectorStatic slsReceiver slsMultiReceiver slsFrameSynchronizer slsReceiverObject slsReceiverShared slsReceiverStatic)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Compute the installation prefix relative to this file.
+get_filename_component(_IMPORT_PREFIX "${CMAKE_CURRENT_LIST_FILE}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+if(_IMPORT_PREFIX STREQUAL "/")
+  set(_IMPORT_PREFIX "")
+endif()
+
+# Create imported target slsProjectOptions
+add_library(slsProjectOptions INTERFACE IMPORTED)
+
+set_target_properties(slsProjectOptions PROPERTIES
+  INTERFACE_COMPILE_FEATURES "cxx_std_11"
+)
+
+# Create imported target slsProjectWarnings
+add_library(slsProjectWarnings INTERFACE IMPORTED)
+
+set_target_properties(slsProjectWarnings PROPERTIES
+  INTERFACE_COMPILE_OPTIONS "-Wall;-Wextra;-Wno-unused-parameter;-Wnon-virtual-dtor;-Woverloaded-virtual;-Wdouble-promotion;-Wformat=2;-Wredundant-decls;-Wvla;-Wdouble-promotion;-Werror=return-type;-Wnull-dereference;-Wduplicated-cond;-Wno-class-memaccess"
+)
+
+# Create imported target slsSupportObject
+add_library(slsSupportObject INTERFACE IMPORTED)
+
+set_target_properties(slsSupportObject PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "slsProjectOptions;\$<LINK_ONLY:slsProjectWarnings>;\$<LINK_ONLY:md5sls>;\$<LINK_ONLY:>;\$<LINK_ONLY:ZLIB::ZLIB>"
+)
+
+# Create imported target slsSupportShared
+add_library(slsSupportShared SHARED IMPORTED)
+
+set_target_properties(slsSupportShared PROPERTIES
+  INTERFACE_LINK_LIBRARIES "slsSupportObject"
+)
+
+# Create imported target slsSupportStatic
+add_library(slsSupportStatic STATIC IMPORTED)
+
+set_target_properties(slsSupportStatic PROPERTIES
+  INTERFACE_LINK_LIBRARIES "slsSupportObject"
+)
+
+# Create imported target md5sls
+add_library(md5sls STATIC IMPORTED)
+
+set_target_properties(md5sls PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+)
+
+# Create imported target slsDetectorObject
+add_library(slsDetectorObject INTERFACE IMPORTED)
+
+set_target_properties(slsDetectorObject PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include"
+  INTERFACE_LINK_LIBRARIES "slsProjectOptions;slsSupportStatic;pthread;rt;\$<LINK_ONLY:slsProjectWarnings>"
+)
+
+# Create imported target slsDetectorShared
+add_library(slsDetectorShared SHARED IMPORTED)
+
+set_target_properties(slsDetectorShared PROPERTIES
+  INTERFACE_LINK_LIBRARIES "slsDetectorObject"
+)
+
+# Create imported target slsDetectorStatic
+add_library(slsDetectorStatic STATIC IMPORTED)
+
+set_target_properties(slsDetectorStatic PROPERTIES
+  INTERFACE_LINK_LIBRARIES "slsDetectorObject"
+)
+
+# Create imported target slsReceiver
+add_executable(slsReceiver IMPORTED)
+
+# Create imported target slsMultiReceiver
+add_executable(slsMultiReceiver IMPORTED)
+
+# Create imported target slsFrameSynchronizer
+add_executable(slsFrameSynchronizer IMPORTED)
+
+# Create imported target slsReceiverObject
+add_library(slsReceiverObject INTERFACE IMPORTED)
+
+set_target_properties(slsReceiverObject PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include;/usr/include/hdf5/serial;/usr/local/include"
+  INTERFACE_LINK_LIBRARIES "slsProjectOptions;slsSupportStatic;\$<LINK_ONLY:slsProjectWarnings>;/usr/lib/x86_64-linux-gnu/hdf5/serial/libhdf5_cpp.so;/usr/lib/x86_64-linux-gnu/hdf5/serial/libhdf5.so;/usr/lib/x86_64-linux-gnu/libcrypto.so;/usr/lib/x86_64-linux-gnu/libcurl.so;/usr/lib/x86_64-linux-gnu/libpthread.a;/usr/lib/x86_64-linux-gnu/libsz.so;/usr/lib/x86_64-linux-gnu/libz.so;/usr/lib/x86_64-linux-gnu/libdl.a;/usr/lib/x86_64-linux-gnu/libm.so"
+)
+
+# Create imported target slsReceiverShared
+add_library(slsReceiverShared SHARED IMPORTED)
+
+set_target_properties(slsReceiverShared PROPERTIES
+  INTERFACE_LINK_LIBRARIES "slsReceiverObject"
+)
+
+# Create imported target slsReceiverStatic
+add_library(slsReceiverStatic STATIC IMPORTED)
+
+set_target_properties(slsReceiverStatic PROPERTIES
+  INTERFACE_LINK_LIBRARIES "slsReceiverObject"
+)
+
+if(CMAKE_VERSION VERSION_LESS 3.0.0)
+  message(FATAL_ERROR "This file relies on consumers using CMake 3.0.0 or greater.")
+endif()
+
+# Load information for each installed configuration.
+file(GLOB _cmake_config_files "${CMAKE_CURRENT_LIST_DIR}/slsdetectorpackage-targets-*.cmake")
+foreach(_cmake_config_file IN LISTS _cmake_config_files)
+  include("${_cmake_config_file}")
+endforeach()
+unset(_cmake_config_file)
+unset(_cmake_config_files)
+
+# Cleanup temporary variables.
+set(_IMPORT_PREFIX)
+
+# Loop over all imported files and verify that they actually exist
+foreach(_cmake_target IN LISTS _cmake_import_check_targets)
+  foreach(_cmake_file IN LISTS "_cmake_import_check_files_for_${_cmake_target}")
+    if(NOT EXISTS "${_cmake_file}")
+      message(FATAL_ERROR "The imported target \"${_cmake_target}\" references the file
+   \"${_cmake_file}\"
+but this file does not exist.  Possible reasons include:
+* The file was deleted, renamed, or moved to another location.
+* An install or uninstall procedure did not complete successfully.
+* The installation package was faulty and contained
+   \"${CMAKE_CURRENT_LIST_FILE}\"
+but not all the files it references.
+")
+    endif()
+  endforeach()
+  unset(_cmake_file)
+  unset("_cmake_import_check_files_for_${_cmake_target}")
+endforeach()
+unset(_cmake_target)
+unset(_cmake_import_check_targets)
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
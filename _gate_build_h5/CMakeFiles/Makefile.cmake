@@ -0,0 +1,203 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/.clang-tidy"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "_deps/libzmq-src/AUTHORS"
+  "_deps/libzmq-src/CMakeLists.txt"
+  "_deps/libzmq-src/COPYING"
+  "_deps/libzmq-src/COPYING.LESSER"
+  "_deps/libzmq-src/NEWS"
+  "_deps/libzmq-src/builds/cmake/Modules/FindAsciiDoc.cmake"
+  "_deps/libzmq-src/builds/cmake/Modules/TestZMQVersion.cmake"
+  "_deps/libzmq-src/builds/cmake/Modules/ZMQSourceRunChecks.cmake"
+  "_deps/libzmq-src/builds/cmake/Modules/ZMQSupportMacros.cmake"
+  "_deps/libzmq-src/builds/cmake/ZeroMQConfig.cmake.in"
+  "_deps/libzmq-src/builds/cmake/platform.hpp.in"
+  "_deps/libzmq-src/src/libzmq.pc.in"
+  "_deps/libzmq-src/src/version.rc.in"
+  "slsReceiverSoftware/CMakeFiles/hdf5/cmake_hdf5_test.cxx"
+  "/root/repo/cmake/Catch.cmake"
+  "/root/repo/cmake/FindClangFormat.cmake"
+  "/root/repo/cmake/SlsAddFlag.cmake"
+  "/root/repo/cmake/package_config.cmake"
+  "/root/repo/cmake/project-config.cmake.in"
+  "/root/repo/cmake/project_version.cc.in"
+  "/root/repo/cmake/project_version.cmake"
+  "/root/repo/cmake/project_version.h.in"
+  "/root/repo/slsDetectorSoftware/CMakeLists.txt"
+  "/root/repo/slsDetectorSoftware/tests/CMakeLists.txt"
+  "/root/repo/slsReceiverSoftware/CMakeLists.txt"
+  "/root/repo/slsReceiverSoftware/tests/CMakeLists.txt"
+  "/root/repo/slsSupportLib/CMakeLists.txt"
+  "/root/repo/slsSupportLib/tests/CMakeLists.txt"
+  "/root/repo/slsSupportLib/tests/test-file_utils-channels.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/scripts/test_simulators.py"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/CMakeLists-C.txt.in"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/CMakeLists-CXX.txt.in"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/foo.c"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/foo.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/main.c"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/main.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FetchContent/CMakeLists.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FindHDF5.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "slsDetectorPackage/project_version.h"
+  "slsDetectorPackage/project_version.cc"
+  "_deps/libzmq-subbuild/CMakeLists.txt"
+  "CMakeFiles/_CMakeLTOTest-CXX/src/CMakeLists.txt"
+  "CMakeFiles/_CMakeLTOTest-CXX/src/foo.cpp"
+  "CMakeFiles/_CMakeLTOTest-CXX/src/main.cpp"
+  "CMakeFiles/_CMakeLTOTest-C/src/CMakeLists.txt"
+  "CMakeFiles/_CMakeLTOTest-C/src/foo.c"
+  "CMakeFiles/_CMakeLTOTest-C/src/main.c"
+  ".clang-tidy"
+  "slsdetectorpackage-config.cmake"
+  "slsdetectorpackage-config-version.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/libzmq-build/version.rc"
+  "_deps/libzmq-build/platform.hpp"
+  "_deps/libzmq-build/libzmq.pc"
+  "_deps/libzmq-build/AUTHORS.txt"
+  "_deps/libzmq-build/COPYING.txt"
+  "_deps/libzmq-build/COPYING.LESSER.txt"
+  "_deps/libzmq-build/NEWS.txt"
+  "_deps/libzmq-build/ZeroMQConfig.cmake"
+  "_deps/libzmq-build/ZeroMQConfigVersion.cmake"
+  "_deps/libzmq-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "DartConfiguration.tcl"
+  "bin/test_simulators.py"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "slsSupportLib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bin/test-file_utils-channels.txt"
+  "slsSupportLib/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "slsDetectorSoftware/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "slsDetectorSoftware/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "slsReceiverSoftware/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "slsReceiverSoftware/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "_deps/libzmq-build/CMakeFiles/objects.dir/DependInfo.cmake"
+  "_deps/libzmq-build/CMakeFiles/libzmq-static.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testclient.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testserver.dir/DependInfo.cmake"
+  "tests/CMakeFiles/tests.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "slsSupportLib/CMakeFiles/md5sls.dir/DependInfo.cmake"
+  "slsSupportLib/CMakeFiles/slsSupportObject.dir/DependInfo.cmake"
+  "slsSupportLib/CMakeFiles/slsSupportShared.dir/DependInfo.cmake"
+  "slsSupportLib/CMakeFiles/slsSupportStatic.dir/DependInfo.cmake"
+  "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/DependInfo.cmake"
+  "slsDetectorSoftware/CMakeFiles/slsDetectorShared.dir/DependInfo.cmake"
+  "slsDetectorSoftware/CMakeFiles/slsDetectorStatic.dir/DependInfo.cmake"
+  "slsDetectorSoftware/CMakeFiles/sls_detector_put.dir/DependInfo.cmake"
+  "slsDetectorSoftware/CMakeFiles/sls_detector_get.dir/DependInfo.cmake"
+  "slsDetectorSoftware/CMakeFiles/sls_detector_acquire.dir/DependInfo.cmake"
+  "slsDetectorSoftware/CMakeFiles/sls_detector_help.dir/DependInfo.cmake"
+  "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/DependInfo.cmake"
+  "slsReceiverSoftware/CMakeFiles/slsReceiverShared.dir/DependInfo.cmake"
+  "slsReceiverSoftware/CMakeFiles/slsReceiverStatic.dir/DependInfo.cmake"
+  "slsReceiverSoftware/CMakeFiles/slsReceiver.dir/DependInfo.cmake"
+  "slsReceiverSoftware/CMakeFiles/slsMultiReceiver.dir/DependInfo.cmake"
+  "slsReceiverSoftware/CMakeFiles/slsFrameSynchronizer.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_build_h5
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("_deps/libzmq-build")
+subdirs("tests")
+subdirs("slsSupportLib")
+subdirs("slsDetectorSoftware")
+subdirs("slsReceiverSoftware")
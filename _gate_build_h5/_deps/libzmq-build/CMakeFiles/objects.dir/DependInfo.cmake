@@ -0,0 +1,123 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/external/sha1/sha1.c" "_deps/libzmq-build/CMakeFiles/objects.dir/external/sha1/sha1.c.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/external/sha1/sha1.c.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/address.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/address.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/address.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/channel.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/channel.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/channel.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/client.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/client.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/client.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/clock.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/clock.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/clock.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/ctx.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ctx.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ctx.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/curve_client.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/curve_client.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/curve_client.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/curve_mechanism_base.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/curve_mechanism_base.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/curve_mechanism_base.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/curve_server.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/curve_server.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/curve_server.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/dealer.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/dealer.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/dealer.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/decoder_allocators.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/decoder_allocators.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/decoder_allocators.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/devpoll.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/devpoll.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/devpoll.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/dgram.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/dgram.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/dgram.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/dish.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/dish.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/dish.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/dist.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/dist.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/dist.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/endpoint.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/endpoint.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/endpoint.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/epoll.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/epoll.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/epoll.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/err.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/err.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/err.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/fq.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/fq.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/fq.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/gather.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/gather.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/gather.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/io_object.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/io_object.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/io_object.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/io_thread.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/io_thread.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/io_thread.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/ip.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ip.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ip.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/ip_resolver.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ip_resolver.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ip_resolver.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/ipc_address.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ipc_address.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ipc_address.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/ipc_connecter.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ipc_connecter.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ipc_connecter.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/ipc_listener.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ipc_listener.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/ipc_listener.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/kqueue.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/kqueue.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/kqueue.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/lb.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/lb.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/lb.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/mailbox.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mailbox.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mailbox.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/mailbox_safe.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mailbox_safe.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mailbox_safe.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/mechanism.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mechanism.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mechanism.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/mechanism_base.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mechanism_base.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mechanism_base.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/metadata.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/metadata.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/metadata.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/msg.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/msg.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/msg.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/mtrie.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mtrie.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/mtrie.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/norm_engine.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/norm_engine.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/norm_engine.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/null_mechanism.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/null_mechanism.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/null_mechanism.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/object.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/object.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/object.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/options.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/options.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/options.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/own.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/own.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/own.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/pair.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pair.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pair.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/peer.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/peer.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/peer.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/pgm_receiver.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pgm_receiver.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pgm_receiver.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/pgm_sender.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pgm_sender.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pgm_sender.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/pgm_socket.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pgm_socket.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pgm_socket.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/pipe.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pipe.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pipe.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/plain_client.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/plain_client.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/plain_client.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/plain_server.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/plain_server.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/plain_server.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/poll.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/poll.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/poll.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/poller_base.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/poller_base.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/poller_base.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/polling_util.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/polling_util.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/polling_util.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/pollset.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pollset.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pollset.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/precompiled.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/precompiled.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/precompiled.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/proxy.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/proxy.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/proxy.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/pub.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pub.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pub.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/pull.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pull.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/pull.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/push.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/push.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/push.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/radio.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/radio.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/radio.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/radix_tree.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/radix_tree.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/radix_tree.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/random.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/random.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/random.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/raw_decoder.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/raw_decoder.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/raw_decoder.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/raw_encoder.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/raw_encoder.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/raw_encoder.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/raw_engine.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/raw_engine.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/raw_engine.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/reaper.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/reaper.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/reaper.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/rep.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/rep.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/rep.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/req.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/req.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/req.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/router.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/router.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/router.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/scatter.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/scatter.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/scatter.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/select.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/select.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/select.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/server.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/server.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/server.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/session_base.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/session_base.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/session_base.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/signaler.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/signaler.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/signaler.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/socket_base.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/socket_base.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/socket_base.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/socket_poller.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/socket_poller.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/socket_poller.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/socks.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/socks.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/socks.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/socks_connecter.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/socks_connecter.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/socks_connecter.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/stream.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/stream.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/stream.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/stream_connecter_base.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/stream_connecter_base.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/stream_connecter_base.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/stream_engine_base.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/stream_engine_base.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/stream_engine_base.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/stream_listener_base.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/stream_listener_base.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/stream_listener_base.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/sub.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/sub.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/sub.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/tcp.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tcp.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tcp.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/tcp_address.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tcp_address.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tcp_address.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/tcp_connecter.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tcp_connecter.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tcp_connecter.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/tcp_listener.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tcp_listener.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tcp_listener.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/thread.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/thread.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/thread.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/timers.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/timers.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/timers.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/tipc_address.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tipc_address.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tipc_address.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/tipc_connecter.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tipc_connecter.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tipc_connecter.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/tipc_listener.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tipc_listener.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/tipc_listener.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/trie.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/trie.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/trie.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/udp_address.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/udp_address.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/udp_address.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/udp_engine.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/udp_engine.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/udp_engine.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/v1_decoder.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v1_decoder.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v1_decoder.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/v1_encoder.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v1_encoder.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v1_encoder.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/v2_decoder.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v2_decoder.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v2_decoder.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/v2_encoder.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v2_encoder.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v2_encoder.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/v3_1_encoder.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v3_1_encoder.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/v3_1_encoder.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/xpub.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/xpub.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/xpub.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/xsub.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/xsub.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/xsub.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/zap_client.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/zap_client.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/zap_client.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/zmq.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/zmq.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/zmq.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/zmq_utils.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/zmq_utils.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/zmq_utils.cpp.o.d"
+  "/root/repo/_gate_build_h5/_deps/libzmq-src/src/zmtp_engine.cpp" "_deps/libzmq-build/CMakeFiles/objects.dir/src/zmtp_engine.cpp.o" "gcc" "_deps/libzmq-build/CMakeFiles/objects.dir/src/zmtp_engine.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
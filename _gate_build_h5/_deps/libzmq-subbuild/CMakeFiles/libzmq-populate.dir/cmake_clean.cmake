@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libzmq-populate"
+  "CMakeFiles/libzmq-populate-complete"
+  "libzmq-populate-prefix/src/libzmq-populate-stamp/libzmq-populate-build"
+  "libzmq-populate-prefix/src/libzmq-populate-stamp/libzmq-populate-configure"
+  "libzmq-populate-prefix/src/libzmq-populate-stamp/libzmq-populate-download"
+  "libzmq-populate-prefix/src/libzmq-populate-stamp/libzmq-populate-install"
+  "libzmq-populate-prefix/src/libzmq-populate-stamp/libzmq-populate-mkdir"
+  "libzmq-populate-prefix/src/libzmq-populate-stamp/libzmq-populate-patch"
+  "libzmq-populate-prefix/src/libzmq-populate-stamp/libzmq-populate-test"
+  "libzmq-populate-prefix/src/libzmq-populate-stamp/libzmq-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/libzmq-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
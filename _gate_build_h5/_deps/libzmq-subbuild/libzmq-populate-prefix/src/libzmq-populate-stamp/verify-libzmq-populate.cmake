@@ -0,0 +1,37 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+if("/root/repo/libs/libzmq/libzmq-4.3.4.tar.gz" STREQUAL "")
+  message(FATAL_ERROR "LOCAL can't be empty")
+endif()
+
+if(NOT EXISTS "/root/repo/libs/libzmq/libzmq-4.3.4.tar.gz")
+  message(FATAL_ERROR "File not found: /root/repo/libs/libzmq/libzmq-4.3.4.tar.gz")
+endif()
+
+if("MD5" STREQUAL "")
+  message(WARNING "File will not be verified since no URL_HASH specified")
+  return()
+endif()
+
+if("cc20b769ac10afa352e5ed2769bb23b3" STREQUAL "")
+  message(FATAL_ERROR "EXPECT_VALUE can't be empty")
+endif()
+
+message(STATUS "verifying file...
+     file='/root/repo/libs/libzmq/libzmq-4.3.4.tar.gz'")
+
+file("MD5" "/root/repo/libs/libzmq/libzmq-4.3.4.tar.gz" actual_value)
+
+if(NOT "${actual_value}" STREQUAL "cc20b769ac10afa352e5ed2769bb23b3")
+  message(FATAL_ERROR "error: MD5 hash of
+  /root/repo/libs/libzmq/libzmq-4.3.4.tar.gz
+does not match expected value
+  expected: 'cc20b769ac10afa352e5ed2769bb23b3'
+    actual: '${actual_value}'
+")
+endif()
+
+message(STATUS "verifying file... done")
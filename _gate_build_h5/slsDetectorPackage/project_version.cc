@@ -0,0 +1,14 @@
+#include "project_version.h"
+/// project version as major.minor.patch string
+const char* slsDetectorPackage_runtime_project_version(){ return "8.0.1"; }
+/// package version as string, possibly with git commit: v1.2.3+4+g56789abc
+const char* slsDetectorPackage_runtime_package_version(){ return "8.0.1"; }
+/// project version as integer: major * 10000 + minor * 100 + patch
+int slsDetectorPackage_runtime_version_int()  { return 80001; }
+/// project version as integer: major
+int slsDetectorPackage_runtime_version_major(){ return 8; }
+/// project version as integer: minor
+int slsDetectorPackage_runtime_version_minor(){ return 0; }
+/// project version as integer: patch
+int slsDetectorPackage_runtime_version_patch(){ return 1; }
+
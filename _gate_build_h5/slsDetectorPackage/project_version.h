@@ -0,0 +1,34 @@
+#ifndef SLSDETECTORPACKAGE_VERSION_H_
+#define SLSDETECTORPACKAGE_VERSION_H_
+
+/// project version as major.minor.patch string
+#define SLSDETECTORPACKAGE_VERSION "8.0.1"
+/// project version as integer: major * 10000 + minor * 100 + patch
+#define SLSDETECTORPACKAGE_VERSION_INT 80001
+#define SLSDETECTORPACKAGE_VERSION_MAJOR 8
+#define SLSDETECTORPACKAGE_VERSION_MINOR 0
+#define SLSDETECTORPACKAGE_VERSION_PATCH 1
+/// package version as string, possibly with git commit: v1.2.3+4+g56789abc
+#define SLSDETECTORPACKAGE_PACKAGE_VERSION "8.0.1"
+
+///runtime versions, where the above values are linked into a lib and therefore reflect the version
+///of the library itself (not the version of the header at compile time of the user code)
+const char* slsDetectorPackage_runtime_project_version();
+const char* slsDetectorPackage_runtime_package_version();
+int slsDetectorPackage_runtime_version_int();
+int slsDetectorPackage_runtime_version_major();
+int slsDetectorPackage_runtime_version_minor();
+int slsDetectorPackage_runtime_version_patch();
+
+///Check consistency of runtime vs compile-time version number. I.e. the header used
+///for compilation was from the same version as the linked library.
+inline bool slsDetectorPackage_check_version_consistency(bool major_minor_only)
+{
+  return slsDetectorPackage_runtime_version_major() == SLSDETECTORPACKAGE_VERSION_MAJOR &&
+         slsDetectorPackage_runtime_version_minor() == SLSDETECTORPACKAGE_VERSION_MINOR &&
+         (major_minor_only ||
+          slsDetectorPackage_runtime_version_patch() == SLSDETECTORPACKAGE_VERSION_PATCH);
+}
+
+
+#endif
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/slsDetectorSoftware/src/CmdParser.cpp" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/CmdParser.cpp.o" "gcc" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/CmdParser.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/src/CmdProxy.cpp" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/CmdProxy.cpp.o" "gcc" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/CmdProxy.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/src/CtbConfig.cpp" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/CtbConfig.cpp.o" "gcc" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/CtbConfig.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/src/Detector.cpp" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/Detector.cpp.o" "gcc" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/Detector.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/src/DetectorImpl.cpp" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/DetectorImpl.cpp.o" "gcc" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/DetectorImpl.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/src/FrameAssembler.cpp" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/FrameAssembler.cpp.o" "gcc" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/FrameAssembler.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/src/Module.cpp" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/Module.cpp.o" "gcc" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/Module.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/src/ModuleWorkers.cpp" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/ModuleWorkers.cpp.o" "gcc" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/ModuleWorkers.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/src/Pattern.cpp" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/Pattern.cpp.o" "gcc" "slsDetectorSoftware/CMakeFiles/slsDetectorObject.dir/src/Pattern.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
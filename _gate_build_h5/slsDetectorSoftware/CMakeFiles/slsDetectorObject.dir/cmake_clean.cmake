@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slsDetectorObject.dir/src/CmdParser.cpp.o"
+  "CMakeFiles/slsDetectorObject.dir/src/CmdParser.cpp.o.d"
+  "CMakeFiles/slsDetectorObject.dir/src/CmdProxy.cpp.o"
+  "CMakeFiles/slsDetectorObject.dir/src/CmdProxy.cpp.o.d"
+  "CMakeFiles/slsDetectorObject.dir/src/CtbConfig.cpp.o"
+  "CMakeFiles/slsDetectorObject.dir/src/CtbConfig.cpp.o.d"
+  "CMakeFiles/slsDetectorObject.dir/src/Detector.cpp.o"
+  "CMakeFiles/slsDetectorObject.dir/src/Detector.cpp.o.d"
+  "CMakeFiles/slsDetectorObject.dir/src/DetectorImpl.cpp.o"
+  "CMakeFiles/slsDetectorObject.dir/src/DetectorImpl.cpp.o.d"
+  "CMakeFiles/slsDetectorObject.dir/src/FrameAssembler.cpp.o"
+  "CMakeFiles/slsDetectorObject.dir/src/FrameAssembler.cpp.o.d"
+  "CMakeFiles/slsDetectorObject.dir/src/Module.cpp.o"
+  "CMakeFiles/slsDetectorObject.dir/src/Module.cpp.o.d"
+  "CMakeFiles/slsDetectorObject.dir/src/ModuleWorkers.cpp.o"
+  "CMakeFiles/slsDetectorObject.dir/src/ModuleWorkers.cpp.o.d"
+  "CMakeFiles/slsDetectorObject.dir/src/Pattern.cpp.o"
+  "CMakeFiles/slsDetectorObject.dir/src/Pattern.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsDetectorObject.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
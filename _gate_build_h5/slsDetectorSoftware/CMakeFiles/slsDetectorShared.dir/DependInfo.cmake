@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build_h5/bin/libSlsDetector.so" "/root/repo/_gate_build_h5/bin/libSlsDetector.so.8.0.1"
+  "/root/repo/_gate_build_h5/bin/libSlsDetector.so.8" "/root/repo/_gate_build_h5/bin/libSlsDetector.so.8.0.1"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_h5/slsSupportLib/CMakeFiles/slsSupportStatic.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_h5/slsSupportLib/CMakeFiles/md5sls.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_h5/_deps/libzmq-build/CMakeFiles/libzmq-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
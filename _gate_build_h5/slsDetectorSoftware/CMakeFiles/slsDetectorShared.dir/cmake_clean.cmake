@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/libSlsDetector.pdb"
+  "../bin/libSlsDetector.so"
+  "../bin/libSlsDetector.so.8"
+  "../bin/libSlsDetector.so.8.0.1"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsDetectorShared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
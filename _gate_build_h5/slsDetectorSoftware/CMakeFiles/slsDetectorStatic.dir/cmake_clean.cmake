@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../bin/libSlsDetectorStatic.a"
+  "../bin/libSlsDetectorStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsDetectorStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/sls_detector_put"
+  "../bin/sls_detector_put.pdb"
+  "CMakeFiles/sls_detector_put.dir/src/CmdLineApp.cpp.o"
+  "CMakeFiles/sls_detector_put.dir/src/CmdLineApp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sls_detector_put.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/slsFrameSynchronizer"
+  "../bin/slsFrameSynchronizer.pdb"
+  "CMakeFiles/slsFrameSynchronizer.dir/src/FrameSynchronizerApp.cpp.o"
+  "CMakeFiles/slsFrameSynchronizer.dir/src/FrameSynchronizerApp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsFrameSynchronizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/slsMultiReceiver"
+  "../bin/slsMultiReceiver.pdb"
+  "CMakeFiles/slsMultiReceiver.dir/src/MultiReceiverApp.cpp.o"
+  "CMakeFiles/slsMultiReceiver.dir/src/MultiReceiverApp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsMultiReceiver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
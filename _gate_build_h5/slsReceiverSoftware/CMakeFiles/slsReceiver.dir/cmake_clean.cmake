@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/slsReceiver"
+  "../bin/slsReceiver.pdb"
+  "CMakeFiles/slsReceiver.dir/src/ReceiverApp.cpp.o"
+  "CMakeFiles/slsReceiver.dir/src/ReceiverApp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsReceiver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
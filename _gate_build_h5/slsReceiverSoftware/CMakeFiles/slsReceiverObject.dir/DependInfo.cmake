@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/slsReceiverSoftware/src/Arping.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Arping.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Arping.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/BinaryDataFile.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/BinaryDataFile.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/BinaryDataFile.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/ClientInterface.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/ClientInterface.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/ClientInterface.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/DataProcessor.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/DataProcessor.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/DataProcessor.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/DataStreamer.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/DataStreamer.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/DataStreamer.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/Fifo.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Fifo.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Fifo.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/FileWriter.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/FileWriter.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/FileWriter.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/FrameSynchronizer.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/FrameSynchronizer.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/FrameSynchronizer.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/HDF5DataFile.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/HDF5DataFile.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/HDF5DataFile.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/HDF5RawDriver.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/HDF5RawDriver.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/HDF5RawDriver.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/Implementation.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Implementation.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Implementation.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/IoUring.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/IoUring.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/IoUring.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/Listener.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Listener.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Listener.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/MasterAttributes.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/MasterAttributes.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/MasterAttributes.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/MasterFileUtility.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/MasterFileUtility.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/MasterFileUtility.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/Receiver.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Receiver.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/Receiver.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/src/ThreadObject.cpp" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/ThreadObject.cpp.o" "gcc" "slsReceiverSoftware/CMakeFiles/slsReceiverObject.dir/src/ThreadObject.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slsReceiverObject.dir/src/Arping.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/Arping.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/BinaryDataFile.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/BinaryDataFile.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/ClientInterface.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/ClientInterface.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/DataProcessor.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/DataProcessor.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/DataStreamer.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/DataStreamer.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/Fifo.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/Fifo.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/FileWriter.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/FileWriter.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/FrameSynchronizer.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/FrameSynchronizer.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/HDF5DataFile.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/HDF5DataFile.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/HDF5RawDriver.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/HDF5RawDriver.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/Implementation.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/Implementation.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/IoUring.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/IoUring.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/Listener.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/Listener.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/MasterAttributes.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/MasterAttributes.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/MasterFileUtility.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/MasterFileUtility.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/Receiver.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/Receiver.cpp.o.d"
+  "CMakeFiles/slsReceiverObject.dir/src/ThreadObject.cpp.o"
+  "CMakeFiles/slsReceiverObject.dir/src/ThreadObject.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsReceiverObject.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
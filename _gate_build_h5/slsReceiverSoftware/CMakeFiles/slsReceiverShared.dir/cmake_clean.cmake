@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/libSlsReceiver.pdb"
+  "../bin/libSlsReceiver.so"
+  "../bin/libSlsReceiver.so.8"
+  "../bin/libSlsReceiver.so.8.0.1"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsReceiverShared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
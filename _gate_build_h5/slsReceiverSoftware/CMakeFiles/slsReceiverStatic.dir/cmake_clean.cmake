@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../bin/libSlsReceiverStatic.a"
+  "../bin/libSlsReceiverStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsReceiverStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/slsReceiverSoftware/tests
+# Build directory: /root/repo/_gate_build_h5/slsReceiverSoftware/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
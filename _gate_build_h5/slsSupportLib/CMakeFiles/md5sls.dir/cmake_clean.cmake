@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/md5sls.dir/src/md5.c.o"
+  "CMakeFiles/md5sls.dir/src/md5.c.o.d"
+  "libmd5sls.a"
+  "libmd5sls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/md5sls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/slsSupportLib/src/ClientSocket.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ClientSocket.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ClientSocket.cpp.o.d"
+  "/root/repo/slsSupportLib/src/DataSocket.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/DataSocket.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/DataSocket.cpp.o.d"
+  "/root/repo/slsSupportLib/src/ServerInterface.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ServerInterface.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ServerInterface.cpp.o.d"
+  "/root/repo/slsSupportLib/src/ServerSocket.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ServerSocket.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ServerSocket.cpp.o.d"
+  "/root/repo/slsSupportLib/src/ToString.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ToString.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ToString.cpp.o.d"
+  "/root/repo/slsSupportLib/src/UdpRxSocket.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/UdpRxSocket.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/UdpRxSocket.cpp.o.d"
+  "/root/repo/slsSupportLib/src/Version.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/Version.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/Version.cpp.o.d"
+  "/root/repo/slsSupportLib/src/ZmqSocket.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ZmqSocket.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/ZmqSocket.cpp.o.d"
+  "/root/repo/slsSupportLib/src/bit_utils.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/bit_utils.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/bit_utils.cpp.o.d"
+  "/root/repo/slsSupportLib/src/compression_utils.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/compression_utils.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/compression_utils.cpp.o.d"
+  "/root/repo/slsSupportLib/src/file_utils.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/file_utils.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/file_utils.cpp.o.d"
+  "/root/repo/slsSupportLib/src/md5_helper.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/md5_helper.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/md5_helper.cpp.o.d"
+  "/root/repo/slsSupportLib/src/network_utils.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/network_utils.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/network_utils.cpp.o.d"
+  "/root/repo/slsSupportLib/src/sls_detector_exceptions.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/sls_detector_exceptions.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/sls_detector_exceptions.cpp.o.d"
+  "/root/repo/slsSupportLib/src/string_utils.cpp" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/string_utils.cpp.o" "gcc" "slsSupportLib/CMakeFiles/slsSupportObject.dir/src/string_utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slsSupportObject.dir/src/ClientSocket.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/ClientSocket.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/DataSocket.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/DataSocket.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/ServerInterface.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/ServerInterface.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/ServerSocket.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/ServerSocket.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/ToString.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/ToString.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/UdpRxSocket.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/UdpRxSocket.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/Version.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/Version.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/ZmqSocket.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/ZmqSocket.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/bit_utils.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/bit_utils.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/compression_utils.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/compression_utils.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/file_utils.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/file_utils.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/md5_helper.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/md5_helper.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/network_utils.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/network_utils.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/sls_detector_exceptions.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/sls_detector_exceptions.cpp.o.d"
+  "CMakeFiles/slsSupportObject.dir/src/string_utils.cpp.o"
+  "CMakeFiles/slsSupportObject.dir/src/string_utils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsSupportObject.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/libSlsSupport.pdb"
+  "../bin/libSlsSupport.so"
+  "../bin/libSlsSupport.so.8"
+  "../bin/libSlsSupport.so.8.0.1"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsSupportShared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
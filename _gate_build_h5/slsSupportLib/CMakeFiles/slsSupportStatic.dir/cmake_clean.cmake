@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../bin/libSlsSupportStatic.a"
+  "../bin/libSlsSupportStatic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slsSupportStatic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/slsSupportLib
+# Build directory: /root/repo/_gate_build_h5/slsSupportLib
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tests")
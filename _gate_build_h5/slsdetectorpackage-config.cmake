@@ -0,0 +1,51 @@
+# Config file for slsdetectorpackage
+#
+# It defines the following variables:
+#
+# SLSDETECTORPACKAGE_INCLUDE_DIRS     - include directory
+# SLSDETECTORPACKAGE_LIBRARIES        - all dynamic libraries
+# SLSDETECTORPACKAGE_STATIC_LIBRARIES - all static libraries
+
+
+####### Expanded from @PACKAGE_INIT@ by configure_package_config_file() #######
+####### Any changes to this file will be overwritten by the next CMake run ####
+####### The input file was project-config.cmake.in                            ########
+
+get_filename_component(PACKAGE_PREFIX_DIR "${CMAKE_CURRENT_LIST_DIR}/../../../" ABSOLUTE)
+
+macro(set_and_check _var _file)
+  set(${_var} "${_file}")
+  if(NOT EXISTS "${_file}")
+    message(FATAL_ERROR "File or directory ${_file} referenced by variable ${_var} does not exist !")
+  endif()
+endmacro()
+
+macro(check_required_components _NAME)
+  foreach(comp ${${_NAME}_FIND_COMPONENTS})
+    if(NOT ${_NAME}_${comp}_FOUND)
+      if(${_NAME}_FIND_REQUIRED_${comp})
+        set(${_NAME}_FOUND FALSE)
+      endif()
+    endif()
+  endforeach()
+endmacro()
+
+####################################################################################
+
+include(CMakeFindDependencyMacro)
+
+set(SLS_USE_HDF5 "ON")
+
+
+find_dependency(Threads)
+find_dependency(ZLIB)
+
+# Add optional dependencies here
+if (SLS_USE_HDF5)
+    find_dependency(HDF5)
+endif ()
+
+set_and_check(SLSDETECTORPACKAGE_CMAKE_INCLUDE_DIRS "${PACKAGE_PREFIX_DIR}/share/cmake/slsDetectorPackage")
+
+include("${CMAKE_CURRENT_LIST_DIR}/slsdetectorpackage-targets.cmake")
+check_required_components("slsDetectorPackage")
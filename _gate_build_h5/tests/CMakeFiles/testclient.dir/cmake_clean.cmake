@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/testclient"
+  "../bin/testclient.pdb"
+  "CMakeFiles/testclient.dir/src/testclient.cpp.o"
+  "CMakeFiles/testclient.dir/src/testclient.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testclient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,67 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/slsDetectorSoftware/tests/test-CmdParser.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdParser.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdParser.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-chiptestboard.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-chiptestboard.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-chiptestboard.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-eiger.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-eiger.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-eiger.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-global.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-global.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-global.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-gotthard.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-gotthard.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-gotthard.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-gotthard2.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-gotthard2.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-gotthard2.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-jungfrau.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-jungfrau.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-jungfrau.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-moench.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-moench.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-moench.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-mythen3.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-mythen3.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-mythen3.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-pattern.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-pattern.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-pattern.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy-rx.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-rx.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-rx.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CmdProxy.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-CtbConfig.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CtbConfig.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CtbConfig.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-FrameAssembler.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-FrameAssembler.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-FrameAssembler.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-Module.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Module.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Module.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-ModuleWorkers.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-ModuleWorkers.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-ModuleWorkers.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-Pattern.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Pattern.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Pattern.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-Result.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Result.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Result.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-SharedMemory.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-SharedMemory.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-SharedMemory.cpp.o.d"
+  "/root/repo/slsDetectorSoftware/tests/test-slsDetector.cpp" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-slsDetector.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-slsDetector.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/tests/test-CircularFifo.cpp" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-CircularFifo.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-CircularFifo.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/tests/test-ClientInterface.cpp" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-ClientInterface.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-ClientInterface.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/tests/test-DataStreamer.cpp" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-DataStreamer.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-DataStreamer.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/tests/test-FileWriter.cpp" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-FileWriter.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-FileWriter.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/tests/test-FrameSynchronizer.cpp" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-FrameSynchronizer.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-FrameSynchronizer.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/tests/test-GeneralData.cpp" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-GeneralData.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-GeneralData.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/tests/test-HDF5DataFile.cpp" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-HDF5DataFile.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-HDF5DataFile.cpp.o.d"
+  "/root/repo/slsReceiverSoftware/tests/test-SpscRing.cpp" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-SpscRing.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-SpscRing.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-Sockets.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-Sockets.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-Sockets.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-StaticVector.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-StaticVector.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-StaticVector.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-Timer.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-Timer.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-Timer.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-ToString.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-ToString.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-ToString.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-TypeTraits.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-TypeTraits.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-TypeTraits.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-UdpRxSocket.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-UdpRxSocket.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-UdpRxSocket.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-ZmqSocket.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-ZmqSocket.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-ZmqSocket.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-bit_utils.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-bit_utils.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-bit_utils.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-compression_utils.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-compression_utils.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-compression_utils.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-container_utils.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-container_utils.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-container_utils.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-file_utils.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-file_utils.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-file_utils.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-logger.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-logger.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-logger.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-network_utils.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-network_utils.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-network_utils.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-sls_detector_defs.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-sls_detector_defs.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-sls_detector_defs.cpp.o.d"
+  "/root/repo/slsSupportLib/tests/test-string_utils.cpp" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-string_utils.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/__/slsSupportLib/tests/test-string_utils.cpp.o.d"
+  "/root/repo/tests/test.cpp" "tests/CMakeFiles/tests.dir/test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_h5/slsSupportLib/CMakeFiles/slsSupportStatic.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_h5/slsDetectorSoftware/CMakeFiles/slsDetectorStatic.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_h5/slsReceiverSoftware/CMakeFiles/slsReceiverStatic.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_h5/slsSupportLib/CMakeFiles/md5sls.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_h5/_deps/libzmq-build/CMakeFiles/libzmq-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,98 @@
+file(REMOVE_RECURSE
+  "../bin/tests"
+  "../bin/tests.pdb"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdParser.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdParser.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-chiptestboard.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-chiptestboard.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-eiger.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-eiger.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-global.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-global.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-gotthard.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-gotthard.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-gotthard2.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-gotthard2.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-jungfrau.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-jungfrau.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-moench.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-moench.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-mythen3.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-mythen3.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-pattern.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-pattern.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-rx.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy-rx.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CmdProxy.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CtbConfig.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-CtbConfig.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-FrameAssembler.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-FrameAssembler.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Module.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Module.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-ModuleWorkers.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-ModuleWorkers.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Pattern.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Pattern.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Result.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-Result.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-SharedMemory.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-SharedMemory.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-slsDetector.cpp.o"
+  "CMakeFiles/tests.dir/__/slsDetectorSoftware/tests/test-slsDetector.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-CircularFifo.cpp.o"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-CircularFifo.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-ClientInterface.cpp.o"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-ClientInterface.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-DataStreamer.cpp.o"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-DataStreamer.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-FileWriter.cpp.o"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-FileWriter.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-FrameSynchronizer.cpp.o"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-FrameSynchronizer.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-GeneralData.cpp.o"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-GeneralData.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-HDF5DataFile.cpp.o"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-HDF5DataFile.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-SpscRing.cpp.o"
+  "CMakeFiles/tests.dir/__/slsReceiverSoftware/tests/test-SpscRing.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-Sockets.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-Sockets.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-StaticVector.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-StaticVector.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-Timer.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-Timer.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-ToString.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-ToString.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-TypeTraits.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-TypeTraits.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-UdpRxSocket.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-UdpRxSocket.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-ZmqSocket.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-ZmqSocket.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-bit_utils.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-bit_utils.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-compression_utils.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-compression_utils.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-container_utils.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-container_utils.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-file_utils.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-file_utils.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-logger.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-logger.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-network_utils.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-network_utils.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-sls_detector_defs.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-sls_detector_defs.cpp.o.d"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-string_utils.cpp.o"
+  "CMakeFiles/tests.dir/__/slsSupportLib/tests/test-string_utils.cpp.o.d"
+  "CMakeFiles/tests.dir/test.cpp.o"
+  "CMakeFiles/tests.dir/test.cpp.o.d"
+  "tests_tests-b858cb2.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/testserver"
+  "../bin/testserver.pdb"
+  "CMakeFiles/testserver.dir/src/testserver.cpp.o"
+  "CMakeFiles/testserver.dir/src/testserver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testserver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
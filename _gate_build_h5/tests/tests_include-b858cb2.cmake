@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_build_h5/tests/tests_tests-b858cb2.cmake")
+  include("/root/repo/_gate_build_h5/tests/tests_tests-b858cb2.cmake")
+else()
+  add_test(tests_NOT_BUILT-b858cb2 tests_NOT_BUILT-b858cb2)
+endif()
@@ -0,0 +1,539 @@
+add_test( [==[Raw driver only for hdf5 < 1.12]==] /root/repo/_gate_build_h5/bin/tests [==[Raw driver only for hdf5 < 1.12]==])
+set_tests_properties( [==[Raw driver only for hdf5 < 1.12]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Raw data of a direct chunk write is deferred]==] /root/repo/_gate_build_h5/bin/tests [==[Raw data of a direct chunk write is deferred]==])
+set_tests_properties( [==[Raw data of a direct chunk write is deferred]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Raw data other than the expected chunk is written right away]==] /root/repo/_gate_build_h5/bin/tests [==[Raw data other than the expected chunk is written right away]==])
+set_tests_properties( [==[Raw data other than the expected chunk is written right away]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Ports write hdf5 files concurrently]==] /root/repo/_gate_build_h5/bin/tests [==[Ports write hdf5 files concurrently]==])
+set_tests_properties( [==[Ports write hdf5 files concurrently]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Compressed chunks read back with the hdf5 filters]==] /root/repo/_gate_build_h5/bin/tests [==[Compressed chunks read back with the hdf5 filters]==])
+set_tests_properties( [==[Compressed chunks read back with the hdf5 filters]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Missing images are filled, their parameters 0]==] /root/repo/_gate_build_h5/bin/tests [==[Missing images are filled\, their parameters 0]==])
+set_tests_properties( [==[Missing images are filled, their parameters 0]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Partial last chunk up to the extent of the dataset]==] /root/repo/_gate_build_h5/bin/tests [==[Partial last chunk up to the extent of the dataset]==])
+set_tests_properties( [==[Partial last chunk up to the extent of the dataset]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[File rollover in the middle of a chunk]==] /root/repo/_gate_build_h5/bin/tests [==[File rollover in the middle of a chunk]==])
+set_tests_properties( [==[File rollover in the middle of a chunk]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Images out of order across a chunk boundary]==] /root/repo/_gate_build_h5/bin/tests [==[Images out of order across a chunk boundary]==])
+set_tests_properties( [==[Images out of order across a chunk boundary]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parameters of each image after a chunked write]==] /root/repo/_gate_build_h5/bin/tests [==[Parameters of each image after a chunked write]==])
+set_tests_properties( [==[Parameters of each image after a chunked write]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Receiver executes a command batch up to the first failure]==] /root/repo/_gate_build_h5/bin/tests [==[Receiver executes a command batch up to the first failure]==])
+set_tests_properties( [==[Receiver executes a command batch up to the first failure]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Receiver rejects invalid command batches]==] /root/repo/_gate_build_h5/bin/tests [==[Receiver rejects invalid command batches]==])
+set_tests_properties( [==[Receiver rejects invalid command batches]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Frame synchronizer publishes the detector image of each frame]==] /root/repo/_gate_build_h5/bin/tests [==[Frame synchronizer publishes the detector image of each frame]==])
+set_tests_properties( [==[Frame synchronizer publishes the detector image of each frame]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Frame synchronizer publishes each sub frame of eiger 32 bit]==] /root/repo/_gate_build_h5/bin/tests [==[Frame synchronizer publishes each sub frame of eiger 32 bit]==])
+set_tests_properties( [==[Frame synchronizer publishes each sub frame of eiger 32 bit]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Frame synchronizer throws for an invalid source]==] /root/repo/_gate_build_h5/bin/tests [==[Frame synchronizer throws for an invalid source]==])
+set_tests_properties( [==[Frame synchronizer throws for an invalid source]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Streamer sends images in order for compression and header formats]==] /root/repo/_gate_build_h5/bin/tests [==[Streamer sends images in order for compression and header formats]==])
+set_tests_properties( [==[Streamer sends images in order for compression and header formats]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Streamer drops images for a slow client without blocking the fifo]==] /root/repo/_gate_build_h5/bin/tests [==[Streamer drops images for a slow client without blocking the fifo]==])
+set_tests_properties( [==[Streamer drops images for a slow client without blocking the fifo]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Write more than the buffers with an unaligned tail]==] /root/repo/_gate_build_h5/bin/tests [==[Write more than the buffers with an unaligned tail]==])
+set_tests_properties( [==[Write more than the buffers with an unaligned tail]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Empty file]==] /root/repo/_gate_build_h5/bin/tests [==[Empty file]==])
+set_tests_properties( [==[Empty file]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Prepared file is preallocated and truncated on close]==] /root/repo/_gate_build_h5/bin/tests [==[Prepared file is preallocated and truncated on close]==])
+set_tests_properties( [==[Prepared file is preallocated and truncated on close]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Prepared file does not replace an existing file without overwrite]==] /root/repo/_gate_build_h5/bin/tests [==[Prepared file does not replace an existing file without overwrite]==])
+set_tests_properties( [==[Prepared file does not replace an existing file without overwrite]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Write from memory with io_uring]==] /root/repo/_gate_build_h5/bin/tests [==[Write from memory with io_uring]==])
+set_tests_properties( [==[Write from memory with io_uring]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Writes in flight with io_uring stay below the fifo depth]==] /root/repo/_gate_build_h5/bin/tests [==[Writes in flight with io_uring stay below the fifo depth]==])
+set_tests_properties( [==[Writes in flight with io_uring stay below the fifo depth]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Empty ring]==] /root/repo/_gate_build_h5/bin/tests [==[Empty ring]==])
+set_tests_properties( [==[Empty ring]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Push pop ring]==] /root/repo/_gate_build_h5/bin/tests [==[Push pop ring]==])
+set_tests_properties( [==[Push pop ring]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Batched pop from ring]==] /root/repo/_gate_build_h5/bin/tests [==[Batched pop from ring]==])
+set_tests_properties( [==[Batched pop from ring]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Ring between two threads wrapping around]==] /root/repo/_gate_build_h5/bin/tests [==[Ring between two threads wrapping around]==])
+set_tests_properties( [==[Ring between two threads wrapping around]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Empty buffer]==] /root/repo/_gate_build_h5/bin/tests [==[Empty buffer]==])
+set_tests_properties( [==[Empty buffer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Push pop]==] /root/repo/_gate_build_h5/bin/tests [==[Push pop]==])
+set_tests_properties( [==[Push pop]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parts of the same frame assembled into one frame]==] /root/repo/_gate_build_h5/bin/tests [==[Parts of the same frame assembled into one frame]==])
+set_tests_properties( [==[Parts of the same frame assembled into one frame]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Part missing a frame keeps its next frame for later]==] /root/repo/_gate_build_h5/bin/tests [==[Part missing a frame keeps its next frame for later]==])
+set_tests_properties( [==[Part missing a frame keeps its next frame for later]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Frames incomplete after a part stopped]==] /root/repo/_gate_build_h5/bin/tests [==[Frames incomplete after a part stopped]==])
+set_tests_properties( [==[Frames incomplete after a part stopped]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parts with a different exposure time assembled into one frame]==] /root/repo/_gate_build_h5/bin/tests [==[Parts with a different exposure time assembled into one frame]==])
+set_tests_properties( [==[Parts with a different exposure time assembled into one frame]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Sub frames of eiger 32 bit are matched by sub frame index]==] /root/repo/_gate_build_h5/bin/tests [==[Sub frames of eiger 32 bit are matched by sub frame index]==])
+set_tests_properties( [==[Sub frames of eiger 32 bit are matched by sub frame index]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[No frames if all parts stopped]==] /root/repo/_gate_build_h5/bin/tests [==[No frames if all parts stopped]==])
+set_tests_properties( [==[No frames if all parts stopped]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Calls of a module run in its persistent thread]==] /root/repo/_gate_build_h5/bin/tests [==[Calls of a module run in its persistent thread]==])
+set_tests_properties( [==[Calls of a module run in its persistent thread]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Exceptions of a module call are passed to the caller]==] /root/repo/_gate_build_h5/bin/tests [==[Exceptions of a module call are passed to the caller]==])
+set_tests_properties( [==[Exceptions of a module call are passed to the caller]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Call of a busy module does not wait for the running one]==] /root/repo/_gate_build_h5/bin/tests [==[Call of a busy module does not wait for the running one]==])
+set_tests_properties( [==[Call of a busy module does not wait for the running one]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Calls of busy modules reuse a bounded set of overflow threads]==] /root/repo/_gate_build_h5/bin/tests [==[Calls of busy modules reuse a bounded set of overflow threads]==])
+set_tests_properties( [==[Calls of busy modules reuse a bounded set of overflow threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Default construction]==] /root/repo/_gate_build_h5/bin/tests [==[Default construction]==])
+set_tests_properties( [==[Default construction]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Set and get a single dac name]==] /root/repo/_gate_build_h5/bin/tests [==[Set and get a single dac name]==])
+set_tests_properties( [==[Set and get a single dac name]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Set a name that is too large throws]==] /root/repo/_gate_build_h5/bin/tests [==[Set a name that is too large throws]==])
+set_tests_properties( [==[Set a name that is too large throws]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Length of dac name cannot be 0]==] /root/repo/_gate_build_h5/bin/tests [==[Length of dac name cannot be 0]==])
+set_tests_properties( [==[Length of dac name cannot be 0]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Copy a CTB config]==] /root/repo/_gate_build_h5/bin/tests [==[Copy a CTB config]==])
+set_tests_properties( [==[Copy a CTB config]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Move CtbConfig ]==] /root/repo/_gate_build_h5/bin/tests [==[Move CtbConfig ]==])
+set_tests_properties( [==[Move CtbConfig ]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Pattern is default constructable and has zeroed fields]==] /root/repo/_gate_build_h5/bin/tests [==[Pattern is default constructable and has zeroed fields]==])
+set_tests_properties( [==[Pattern is default constructable and has zeroed fields]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Copy construct pattern]==] /root/repo/_gate_build_h5/bin/tests [==[Copy construct pattern]==])
+set_tests_properties( [==[Copy construct pattern]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Compare patterns]==] /root/repo/_gate_build_h5/bin/tests [==[Compare patterns]==])
+set_tests_properties( [==[Compare patterns]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Construction with a defined detector type]==] /root/repo/_gate_build_h5/bin/tests [==[Construction with a defined detector type]==])
+set_tests_properties( [==[Construction with a defined detector type]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Read back detector type from shm]==] /root/repo/_gate_build_h5/bin/tests [==[Read back detector type from shm]==])
+set_tests_properties( [==[Read back detector type from shm]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Is shm fixed pattern shm compatible]==] /root/repo/_gate_build_h5/bin/tests [==[Is shm fixed pattern shm compatible]==])
+set_tests_properties( [==[Is shm fixed pattern shm compatible]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get default control port]==] /root/repo/_gate_build_h5/bin/tests [==[Get default control port]==])
+set_tests_properties( [==[Get default control port]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get default stop port]==] /root/repo/_gate_build_h5/bin/tests [==[Get default stop port]==])
+set_tests_properties( [==[Get default stop port]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get default receiver TCP port]==] /root/repo/_gate_build_h5/bin/tests [==[Get default receiver TCP port]==])
+set_tests_properties( [==[Get default receiver TCP port]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Scenario: Construction]==] /root/repo/_gate_build_h5/bin/tests [==[Scenario: Construction]==])
+set_tests_properties( [==[Scenario: Construction]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Scenario: Parsing a string with the command line parser]==] /root/repo/_gate_build_h5/bin/tests [==[Scenario: Parsing a string with the command line parser]==])
+set_tests_properties( [==[Scenario: Parsing a string with the command line parser]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Scenario: Parsing strings with -h or --help]==] /root/repo/_gate_build_h5/bin/tests [==[Scenario: Parsing strings with -h or --help]==])
+set_tests_properties( [==[Scenario: Parsing strings with -h or --help]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse string with --help]==] /root/repo/_gate_build_h5/bin/tests [==[Parse string with --help]==])
+set_tests_properties( [==[Parse string with --help]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse string with -h]==] /root/repo/_gate_build_h5/bin/tests [==[Parse string with -h]==])
+set_tests_properties( [==[Parse string with -h]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parsing consecutive strings resets not found det id]==] /root/repo/_gate_build_h5/bin/tests [==[Parsing consecutive strings resets not found det id]==])
+set_tests_properties( [==[Parsing consecutive strings resets not found det id]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parsing consecutive strings resets not found multi id]==] /root/repo/_gate_build_h5/bin/tests [==[Parsing consecutive strings resets not found multi id]==])
+set_tests_properties( [==[Parsing consecutive strings resets not found multi id]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse with no arguments results in no command and default id]==] /root/repo/_gate_build_h5/bin/tests [==[Parse with no arguments results in no command and default id]==])
+set_tests_properties( [==[Parse with no arguments results in no command and default id]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse a command without client id and detector id results in default]==] /root/repo/_gate_build_h5/bin/tests [==[Parse a command without client id and detector id results in default]==])
+set_tests_properties( [==[Parse a command without client id and detector id results in default]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse a command with value but without client or detector id]==] /root/repo/_gate_build_h5/bin/tests [==[Parse a command with value but without client or detector id]==])
+set_tests_properties( [==[Parse a command with value but without client or detector id]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Decodes position]==] /root/repo/_gate_build_h5/bin/tests [==[Decodes position]==])
+set_tests_properties( [==[Decodes position]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Decodes double digit position]==] /root/repo/_gate_build_h5/bin/tests [==[Decodes double digit position]==])
+set_tests_properties( [==[Decodes double digit position]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Decodes position and id]==] /root/repo/_gate_build_h5/bin/tests [==[Decodes position and id]==])
+set_tests_properties( [==[Decodes position and id]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Double digit id]==] /root/repo/_gate_build_h5/bin/tests [==[Double digit id]==])
+set_tests_properties( [==[Double digit id]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Allows space between mod id and command]==] /root/repo/_gate_build_h5/bin/tests [==[Allows space between mod id and command]==])
+set_tests_properties( [==[Allows space between mod id and command]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Allows space between mod id and command also without :]==] /root/repo/_gate_build_h5/bin/tests [==[Allows space between mod id and command also without :]==])
+set_tests_properties( [==[Allows space between mod id and command also without :]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Allows space between mod id and command when detector id is used]==] /root/repo/_gate_build_h5/bin/tests [==[Allows space between mod id and command when detector id is used]==])
+set_tests_properties( [==[Allows space between mod id and command when detector id is used]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Allows space between mod id and command with detector id and :]==] /root/repo/_gate_build_h5/bin/tests [==[Allows space between mod id and command with detector id and :]==])
+set_tests_properties( [==[Allows space between mod id and command with detector id and :]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse receiver ID]==] /root/repo/_gate_build_h5/bin/tests [==[Parse receiver ID]==])
+set_tests_properties( [==[Parse receiver ID]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse receiver ID no det id]==] /root/repo/_gate_build_h5/bin/tests [==[Parse receiver ID no det id]==])
+set_tests_properties( [==[Parse receiver ID no det id]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Det id but no mod id]==] /root/repo/_gate_build_h5/bin/tests [==[Det id but no mod id]==])
+set_tests_properties( [==[Det id but no mod id]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Det id but no mod id but with space after -]==] /root/repo/_gate_build_h5/bin/tests [==[Det id but no mod id but with space after -]==])
+set_tests_properties( [==[Det id but no mod id but with space after -]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse receiver ID no det id no mod]==] /root/repo/_gate_build_h5/bin/tests [==[Parse receiver ID no det id no mod]==])
+set_tests_properties( [==[Parse receiver ID no det id no mod]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse mod and receiver id]==] /root/repo/_gate_build_h5/bin/tests [==[Parse mod and receiver id]==])
+set_tests_properties( [==[Parse mod and receiver id]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Det id but no no mod]==] /root/repo/_gate_build_h5/bin/tests [==[Det id but no no mod]==])
+set_tests_properties( [==[Det id but no no mod]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[All stuff]==] /root/repo/_gate_build_h5/bin/tests [==[All stuff]==])
+set_tests_properties( [==[All stuff]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse a command that has -h in it]==] /root/repo/_gate_build_h5/bin/tests [==[Parse a command that has -h in it]==])
+set_tests_properties( [==[Parse a command that has -h in it]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse a command in the form 0-1 command]==] /root/repo/_gate_build_h5/bin/tests [==[Parse a command in the form 0-1 command]==])
+set_tests_properties( [==[Parse a command in the form 0-1 command]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse a command in the form 0-1:command]==] /root/repo/_gate_build_h5/bin/tests [==[Parse a command in the form 0-1:command]==])
+set_tests_properties( [==[Parse a command in the form 0-1:command]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Result looks and behaves like a standard container]==] /root/repo/_gate_build_h5/bin/tests [==[Result looks and behaves like a standard container]==])
+set_tests_properties( [==[Result looks and behaves like a standard container]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Default construction is possible and gives an empty result]==] /root/repo/_gate_build_h5/bin/tests [==[Default construction is possible and gives an empty result]==])
+set_tests_properties( [==[Default construction is possible and gives an empty result]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Result can be constructed from std::initializer_list]==] /root/repo/_gate_build_h5/bin/tests [==[Result can be constructed from std::initializer_list]==])
+set_tests_properties( [==[Result can be constructed from std::initializer_list]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Like vector it can be constructed from size and value]==] /root/repo/_gate_build_h5/bin/tests [==[Like vector it can be constructed from size and value]==])
+set_tests_properties( [==[Like vector it can be constructed from size and value]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Result can be iterated using modern syntax]==] /root/repo/_gate_build_h5/bin/tests [==[Result can be iterated using modern syntax]==])
+set_tests_properties( [==[Result can be iterated using modern syntax]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Calling squash on an empty Result produces default value]==] /root/repo/_gate_build_h5/bin/tests [==[Calling squash on an empty Result produces default value]==])
+set_tests_properties( [==[Calling squash on an empty Result produces default value]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[When equal squash gives the front value]==] /root/repo/_gate_build_h5/bin/tests [==[When equal squash gives the front value]==])
+set_tests_properties( [==[When equal squash gives the front value]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[When elements are not equal squash gives default value]==] /root/repo/_gate_build_h5/bin/tests [==[When elements are not equal squash gives default value]==])
+set_tests_properties( [==[When elements are not equal squash gives default value]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[String compare with squash]==] /root/repo/_gate_build_h5/bin/tests [==[String compare with squash]==])
+set_tests_properties( [==[String compare with squash]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[tsquash throws for different elements]==] /root/repo/_gate_build_h5/bin/tests [==[tsquash throws for different elements]==])
+set_tests_properties( [==[tsquash throws for different elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[tsquash returns front element when equal]==] /root/repo/_gate_build_h5/bin/tests [==[tsquash returns front element when equal]==])
+set_tests_properties( [==[tsquash returns front element when equal]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[When provided squash gives default value if elements differ]==] /root/repo/_gate_build_h5/bin/tests [==[When provided squash gives default value if elements differ]==])
+set_tests_properties( [==[When provided squash gives default value if elements differ]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[It is possible to update elements by index access]==] /root/repo/_gate_build_h5/bin/tests [==[It is possible to update elements by index access]==])
+set_tests_properties( [==[It is possible to update elements by index access]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Check if elements are equal]==] /root/repo/_gate_build_h5/bin/tests [==[Check if elements are equal]==])
+set_tests_properties( [==[Check if elements are equal]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Result can be converted to std::vector]==] /root/repo/_gate_build_h5/bin/tests [==[Result can be converted to std::vector]==])
+set_tests_properties( [==[Result can be converted to std::vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Result can be printed using <<]==] /root/repo/_gate_build_h5/bin/tests [==[Result can be printed using <<]==])
+set_tests_properties( [==[Result can be printed using <<]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Convert from Result<int> to Result<ns>]==] /root/repo/_gate_build_h5/bin/tests [==[Convert from Result<int> to Result<ns>]==])
+set_tests_properties( [==[Convert from Result<int> to Result<ns>]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Result of vectors]==] /root/repo/_gate_build_h5/bin/tests [==[Result of vectors]==])
+set_tests_properties( [==[Result of vectors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Free function begin end]==] /root/repo/_gate_build_h5/bin/tests [==[Free function begin end]==])
+set_tests_properties( [==[Free function begin end]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Sorting a Result]==] /root/repo/_gate_build_h5/bin/tests [==[Sorting a Result]==])
+set_tests_properties( [==[Sorting a Result]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Printing Result<std::string>]==] /root/repo/_gate_build_h5/bin/tests [==[Printing Result<std::string>]==])
+set_tests_properties( [==[Printing Result<std::string>]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Printing Result<int>]==] /root/repo/_gate_build_h5/bin/tests [==[Printing Result<int>]==])
+set_tests_properties( [==[Printing Result<int>]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[String conversions]==] /root/repo/_gate_build_h5/bin/tests [==[String conversions]==])
+set_tests_properties( [==[String conversions]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Any element is equal]==] /root/repo/_gate_build_h5/bin/tests [==[Any element is equal]==])
+set_tests_properties( [==[Any element is equal]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Result contains only the specified elements]==] /root/repo/_gate_build_h5/bin/tests [==[Result contains only the specified elements]==])
+set_tests_properties( [==[Result contains only the specified elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Only with multiple values]==] /root/repo/_gate_build_h5/bin/tests [==[Only with multiple values]==])
+set_tests_properties( [==[Only with multiple values]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Calling help doesn't throw or cause segfault]==] /root/repo/_gate_build_h5/bin/tests [==[Calling help doesn't throw or cause segfault]==])
+set_tests_properties( [==[Calling help doesn't throw or cause segfault]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Detector wide commands are commands]==] /root/repo/_gate_build_h5/bin/tests [==[Detector wide commands are commands]==])
+set_tests_properties( [==[Detector wide commands are commands]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Create SharedMemory read and write]==] /root/repo/_gate_build_h5/bin/tests [==[Create SharedMemory read and write]==])
+set_tests_properties( [==[Create SharedMemory read and write]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Open existing SharedMemory and read]==] /root/repo/_gate_build_h5/bin/tests [==[Open existing SharedMemory and read]==])
+set_tests_properties( [==[Open existing SharedMemory and read]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Creating a second shared memory with the same name throws]==] /root/repo/_gate_build_h5/bin/tests [==[Creating a second shared memory with the same name throws]==])
+set_tests_properties( [==[Creating a second shared memory with the same name throws]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Open two shared memories to the same place]==] /root/repo/_gate_build_h5/bin/tests [==[Open two shared memories to the same place]==])
+set_tests_properties( [==[Open two shared memories to the same place]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Move SharedMemory]==] /root/repo/_gate_build_h5/bin/tests [==[Move SharedMemory]==])
+set_tests_properties( [==[Move SharedMemory]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Create several shared memories]==] /root/repo/_gate_build_h5/bin/tests [==[Create several shared memories]==])
+set_tests_properties( [==[Create several shared memories]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Create create a shared memory with a tag]==] /root/repo/_gate_build_h5/bin/tests [==[Create create a shared memory with a tag]==])
+set_tests_properties( [==[Create create a shared memory with a tag]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Create create a shared memory with a tag when SLSDETNAME is set]==] /root/repo/_gate_build_h5/bin/tests [==[Create create a shared memory with a tag when SLSDETNAME is set]==])
+set_tests_properties( [==[Create create a shared memory with a tag when SLSDETNAME is set]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[map int64 to int32 throws]==] /root/repo/_gate_build_h5/bin/tests [==[map int64 to int32 throws]==])
+set_tests_properties( [==[map int64 to int32 throws]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Throws when cannot create socket]==] /root/repo/_gate_build_h5/bin/tests [==[Throws when cannot create socket]==])
+set_tests_properties( [==[Throws when cannot create socket]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get port number for sub]==] /root/repo/_gate_build_h5/bin/tests [==[Get port number for sub]==])
+set_tests_properties( [==[Get port number for sub]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get port number for pub]==] /root/repo/_gate_build_h5/bin/tests [==[Get port number for pub]==])
+set_tests_properties( [==[Get port number for pub]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Server address]==] /root/repo/_gate_build_h5/bin/tests [==[Server address]==])
+set_tests_properties( [==[Server address]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Send header on localhost]==] /root/repo/_gate_build_h5/bin/tests [==[Send header on localhost]==])
+set_tests_properties( [==[Send header on localhost]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Send serveral headers of different length]==] /root/repo/_gate_build_h5/bin/tests [==[Send serveral headers of different length]==])
+set_tests_properties( [==[Send serveral headers of different length]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Send all header fields as json and binary]==] /root/repo/_gate_build_h5/bin/tests [==[Send all header fields as json and binary]==])
+set_tests_properties( [==[Send all header fields as json and binary]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Send header and data]==] /root/repo/_gate_build_h5/bin/tests [==[Send header and data]==])
+set_tests_properties( [==[Send header and data]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Send data without copy]==] /root/repo/_gate_build_h5/bin/tests [==[Send data without copy]==])
+set_tests_properties( [==[Send data without copy]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Receive compressed data]==] /root/repo/_gate_build_h5/bin/tests [==[Receive compressed data]==])
+set_tests_properties( [==[Receive compressed data]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[LogLevel to string]==] /root/repo/_gate_build_h5/bin/tests [==[LogLevel to string]==])
+set_tests_properties( [==[LogLevel to string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Test output]==] /root/repo/_gate_build_h5/bin/tests [==[Test output]==])
+set_tests_properties( [==[Test output]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get packet size returns the packet size we set in the constructor]==] /root/repo/_gate_build_h5/bin/tests [==[Get packet size returns the packet size we set in the constructor]==])
+set_tests_properties( [==[Get packet size returns the packet size we set in the constructor]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Receive data from a vector]==] /root/repo/_gate_build_h5/bin/tests [==[Receive data from a vector]==])
+set_tests_properties( [==[Receive data from a vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Shutdown socket without hanging when waiting for data]==] /root/repo/_gate_build_h5/bin/tests [==[Shutdown socket without hanging when waiting for data]==])
+set_tests_properties( [==[Shutdown socket without hanging when waiting for data]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Too small packet]==] /root/repo/_gate_build_h5/bin/tests [==[Too small packet]==])
+set_tests_properties( [==[Too small packet]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Receive a batch of packets]==] /root/repo/_gate_build_h5/bin/tests [==[Receive a batch of packets]==])
+set_tests_properties( [==[Receive a batch of packets]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Scatter header and payload of a batch of packets]==] /root/repo/_gate_build_h5/bin/tests [==[Scatter header and payload of a batch of packets]==])
+set_tests_properties( [==[Scatter header and payload of a batch of packets]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Receive a batch of packets from packet ring or fall back]==] /root/repo/_gate_build_h5/bin/tests [==[Receive a batch of packets from packet ring or fall back]==])
+set_tests_properties( [==[Receive a batch of packets from packet ring or fall back]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Invalid batch size]==] /root/repo/_gate_build_h5/bin/tests [==[Invalid batch size]==])
+set_tests_properties( [==[Invalid batch size]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Receive an int to an external buffer]==] /root/repo/_gate_build_h5/bin/tests [==[Receive an int to an external buffer]==])
+set_tests_properties( [==[Receive an int to an external buffer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( is_container /root/repo/_gate_build_h5/bin/tests is_container)
+set_tests_properties( is_container PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Check for str() method]==] /root/repo/_gate_build_h5/bin/tests [==[Check for str() method]==])
+set_tests_properties( [==[Check for str() method]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Check for str() on ostream]==] /root/repo/_gate_build_h5/bin/tests [==[Check for str() on ostream]==])
+set_tests_properties( [==[Check for str() on ostream]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( is_duration /root/repo/_gate_build_h5/bin/tests is_duration)
+set_tests_properties( is_duration PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[initializer list]==] /root/repo/_gate_build_h5/bin/tests [==[initializer list]==])
+set_tests_properties( [==[initializer list]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Check for emplace back]==] /root/repo/_gate_build_h5/bin/tests [==[Check for emplace back]==])
+set_tests_properties( [==[Check for emplace back]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Integer conversions]==] /root/repo/_gate_build_h5/bin/tests [==[Integer conversions]==])
+set_tests_properties( [==[Integer conversions]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[floating point conversions]==] /root/repo/_gate_build_h5/bin/tests [==[floating point conversions]==])
+set_tests_properties( [==[floating point conversions]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[conversion from duration to string]==] /root/repo/_gate_build_h5/bin/tests [==[conversion from duration to string]==])
+set_tests_properties( [==[conversion from duration to string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Convert vector of time]==] /root/repo/_gate_build_h5/bin/tests [==[Convert vector of time]==])
+set_tests_properties( [==[Convert vector of time]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Vector of int]==] /root/repo/_gate_build_h5/bin/tests [==[Vector of int]==])
+set_tests_properties( [==[Vector of int]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Vector of double]==] /root/repo/_gate_build_h5/bin/tests [==[Vector of double]==])
+set_tests_properties( [==[Vector of double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( Array /root/repo/_gate_build_h5/bin/tests Array)
+set_tests_properties( Array PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Convert types with str method]==] /root/repo/_gate_build_h5/bin/tests [==[Convert types with str method]==])
+set_tests_properties( [==[Convert types with str method]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[String to string]==] /root/repo/_gate_build_h5/bin/tests [==[String to string]==])
+set_tests_properties( [==[String to string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[vector of strings]==] /root/repo/_gate_build_h5/bin/tests [==[vector of strings]==])
+set_tests_properties( [==[vector of strings]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[run status]==] /root/repo/_gate_build_h5/bin/tests [==[run status]==])
+set_tests_properties( [==[run status]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[string to std::chrono::duration]==] /root/repo/_gate_build_h5/bin/tests [==[string to std::chrono::duration]==])
+set_tests_properties( [==[string to std::chrono::duration]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[string to detectorType]==] /root/repo/_gate_build_h5/bin/tests [==[string to detectorType]==])
+set_tests_properties( [==[string to detectorType]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( vec /root/repo/_gate_build_h5/bin/tests vec)
+set_tests_properties( vec PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[uint32 from string]==] /root/repo/_gate_build_h5/bin/tests [==[uint32 from string]==])
+set_tests_properties( [==[uint32 from string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[uint64 from string]==] /root/repo/_gate_build_h5/bin/tests [==[uint64 from string]==])
+set_tests_properties( [==[uint64 from string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[int from string]==] /root/repo/_gate_build_h5/bin/tests [==[int from string]==])
+set_tests_properties( [==[int from string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[int64_t from string]==] /root/repo/_gate_build_h5/bin/tests [==[int64_t from string]==])
+set_tests_properties( [==[int64_t from string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[std::map of strings]==] /root/repo/_gate_build_h5/bin/tests [==[std::map of strings]==])
+set_tests_properties( [==[std::map of strings]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[std::map of ints]==] /root/repo/_gate_build_h5/bin/tests [==[std::map of ints]==])
+set_tests_properties( [==[std::map of ints]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Detector type]==] /root/repo/_gate_build_h5/bin/tests [==[Detector type]==])
+set_tests_properties( [==[Detector type]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Formatting slsDetectorDefs::ROI]==] /root/repo/_gate_build_h5/bin/tests [==[Formatting slsDetectorDefs::ROI]==])
+set_tests_properties( [==[Formatting slsDetectorDefs::ROI]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Streaming of slsDetectorDefs::ROI]==] /root/repo/_gate_build_h5/bin/tests [==[Streaming of slsDetectorDefs::ROI]==])
+set_tests_properties( [==[Streaming of slsDetectorDefs::ROI]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( std::array /root/repo/_gate_build_h5/bin/tests std::array)
+set_tests_properties( std::array PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[string to dac index]==] /root/repo/_gate_build_h5/bin/tests [==[string to dac index]==])
+set_tests_properties( [==[string to dac index]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[dac index to string]==] /root/repo/_gate_build_h5/bin/tests [==[dac index to string]==])
+set_tests_properties( [==[dac index to string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[convert vector of strings to dac index]==] /root/repo/_gate_build_h5/bin/tests [==[convert vector of strings to dac index]==])
+set_tests_properties( [==[convert vector of strings to dac index]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[vector of dac index to string]==] /root/repo/_gate_build_h5/bin/tests [==[vector of dac index to string]==])
+set_tests_properties( [==[vector of dac index to string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[int or uin64_t to a string in hex]==] /root/repo/_gate_build_h5/bin/tests [==[int or uin64_t to a string in hex]==])
+set_tests_properties( [==[int or uin64_t to a string in hex]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Streaming of slsDetectorDefs::scanParameters]==] /root/repo/_gate_build_h5/bin/tests [==[Streaming of slsDetectorDefs::scanParameters]==])
+set_tests_properties( [==[Streaming of slsDetectorDefs::scanParameters]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Printing c style arrays of int]==] /root/repo/_gate_build_h5/bin/tests [==[Printing c style arrays of int]==])
+set_tests_properties( [==[Printing c style arrays of int]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Printing c style arrays of uint8]==] /root/repo/_gate_build_h5/bin/tests [==[Printing c style arrays of uint8]==])
+set_tests_properties( [==[Printing c style arrays of uint8]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Printing c style arrays of double]==] /root/repo/_gate_build_h5/bin/tests [==[Printing c style arrays of double]==])
+set_tests_properties( [==[Printing c style arrays of double]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Print a member of patternParameters]==] /root/repo/_gate_build_h5/bin/tests [==[Print a member of patternParameters]==])
+set_tests_properties( [==[Print a member of patternParameters]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( streamingInterface /root/repo/_gate_build_h5/bin/tests streamingInterface)
+set_tests_properties( streamingInterface PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[speedLevel to string]==] /root/repo/_gate_build_h5/bin/tests [==[speedLevel to string]==])
+set_tests_properties( [==[speedLevel to string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[string to speedLevel]==] /root/repo/_gate_build_h5/bin/tests [==[string to speedLevel]==])
+set_tests_properties( [==[string to speedLevel]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[StaticVector is a container]==] /root/repo/_gate_build_h5/bin/tests [==[StaticVector is a container]==])
+set_tests_properties( [==[StaticVector is a container]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Comparing StaticVector containers]==] /root/repo/_gate_build_h5/bin/tests [==[Comparing StaticVector containers]==])
+set_tests_properties( [==[Comparing StaticVector containers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Compare array and fixed capacity container]==] /root/repo/_gate_build_h5/bin/tests [==[Compare array and fixed capacity container]==])
+set_tests_properties( [==[Compare array and fixed capacity container]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Compare vector and fixed capacity container]==] /root/repo/_gate_build_h5/bin/tests [==[Compare vector and fixed capacity container]==])
+set_tests_properties( [==[Compare vector and fixed capacity container]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Construct from vector]==] /root/repo/_gate_build_h5/bin/tests [==[Construct from vector]==])
+set_tests_properties( [==[Construct from vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Copy construct from vector]==] /root/repo/_gate_build_h5/bin/tests [==[Copy construct from vector]==])
+set_tests_properties( [==[Copy construct from vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Copy assignment from vector]==] /root/repo/_gate_build_h5/bin/tests [==[Copy assignment from vector]==])
+set_tests_properties( [==[Copy assignment from vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Construct from array]==] /root/repo/_gate_build_h5/bin/tests [==[Construct from array]==])
+set_tests_properties( [==[Construct from array]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Copy assign from array]==] /root/repo/_gate_build_h5/bin/tests [==[Copy assign from array]==])
+set_tests_properties( [==[Copy assign from array]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Copy construct from array]==] /root/repo/_gate_build_h5/bin/tests [==[Copy construct from array]==])
+set_tests_properties( [==[Copy construct from array]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Free function and method gives the same iterators]==] /root/repo/_gate_build_h5/bin/tests [==[Free function and method gives the same iterators]==])
+set_tests_properties( [==[Free function and method gives the same iterators]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Scenario: StaticVectors can be sized and resized]==] /root/repo/_gate_build_h5/bin/tests [==[Scenario: StaticVectors can be sized and resized]==])
+set_tests_properties( [==[Scenario: StaticVectors can be sized and resized]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Scenario: Comparison of StaticVectors]==] /root/repo/_gate_build_h5/bin/tests [==[Scenario: Comparison of StaticVectors]==])
+set_tests_properties( [==[Scenario: Comparison of StaticVectors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Scenario: Sorting, removing and other manipulation of a container]==] /root/repo/_gate_build_h5/bin/tests [==[Scenario: Sorting\, removing and other manipulation of a container]==])
+set_tests_properties( [==[Scenario: Sorting, removing and other manipulation of a container]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Scenario: Assigning containers to each other]==] /root/repo/_gate_build_h5/bin/tests [==[Scenario: Assigning containers to each other]==])
+set_tests_properties( [==[Scenario: Assigning containers to each other]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Scenario: Converting to vector]==] /root/repo/_gate_build_h5/bin/tests [==[Scenario: Converting to vector]==])
+set_tests_properties( [==[Scenario: Converting to vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( StaticVector /root/repo/_gate_build_h5/bin/tests StaticVector)
+set_tests_properties( StaticVector PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[StaticVector stream]==] /root/repo/_gate_build_h5/bin/tests [==[StaticVector stream]==])
+set_tests_properties( [==[StaticVector stream]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[The server recive the same message as we send]==] /root/repo/_gate_build_h5/bin/tests [==[The server recive the same message as we send]==])
+set_tests_properties( [==[The server recive the same message as we send]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Server serves many commands on a connection kept open]==] /root/repo/_gate_build_h5/bin/tests [==[Server serves many commands on a connection kept open]==])
+set_tests_properties( [==[Server serves many commands on a connection kept open]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[throws on no server]==] /root/repo/_gate_build_h5/bin/tests [==[throws on no server]==])
+set_tests_properties( [==[throws on no server]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[sls_detector_module default construction]==] /root/repo/_gate_build_h5/bin/tests [==[sls_detector_module default construction]==])
+set_tests_properties( [==[sls_detector_module default construction]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[sls_detector_module from type]==] /root/repo/_gate_build_h5/bin/tests [==[sls_detector_module from type]==])
+set_tests_properties( [==[sls_detector_module from type]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[assign module]==] /root/repo/_gate_build_h5/bin/tests [==[assign module]==])
+set_tests_properties( [==[assign module]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[default construct scanParameters]==] /root/repo/_gate_build_h5/bin/tests [==[default construct scanParameters]==])
+set_tests_properties( [==[default construct scanParameters]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[compare two scanParameters]==] /root/repo/_gate_build_h5/bin/tests [==[compare two scanParameters]==])
+set_tests_properties( [==[compare two scanParameters]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[copy a string]==] /root/repo/_gate_build_h5/bin/tests [==[copy a string]==])
+set_tests_properties( [==[copy a string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[copy a long string]==] /root/repo/_gate_build_h5/bin/tests [==[copy a long string]==])
+set_tests_properties( [==[copy a long string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[split a string with end delimiter]==] /root/repo/_gate_build_h5/bin/tests [==[split a string with end delimiter]==])
+set_tests_properties( [==[split a string with end delimiter]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[split a string without end delimiter]==] /root/repo/_gate_build_h5/bin/tests [==[split a string without end delimiter]==])
+set_tests_properties( [==[split a string without end delimiter]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Remove char from string]==] /root/repo/_gate_build_h5/bin/tests [==[Remove char from string]==])
+set_tests_properties( [==[Remove char from string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Remove char from empty string]==] /root/repo/_gate_build_h5/bin/tests [==[Remove char from empty string]==])
+set_tests_properties( [==[Remove char from empty string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Many characters in a row]==] /root/repo/_gate_build_h5/bin/tests [==[Many characters in a row]==])
+set_tests_properties( [==[Many characters in a row]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Check is string is integer]==] /root/repo/_gate_build_h5/bin/tests [==[Check is string is integer]==])
+set_tests_properties( [==[Check is string is integer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Replace substring in string]==] /root/repo/_gate_build_h5/bin/tests [==[Replace substring in string]==])
+set_tests_properties( [==[Replace substring in string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Replace --help in command]==] /root/repo/_gate_build_h5/bin/tests [==[Replace --help in command]==])
+set_tests_properties( [==[Replace --help in command]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Replace -h in command]==] /root/repo/_gate_build_h5/bin/tests [==[Replace -h in command]==])
+set_tests_properties( [==[Replace -h in command]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[replace --help]==] /root/repo/_gate_build_h5/bin/tests [==[replace --help]==])
+set_tests_properties( [==[replace --help]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[port host]==] /root/repo/_gate_build_h5/bin/tests [==[port host]==])
+set_tests_properties( [==[port host]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[port missing]==] /root/repo/_gate_build_h5/bin/tests [==[port missing]==])
+set_tests_properties( [==[port missing]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[parse cpu list]==] /root/repo/_gate_build_h5/bin/tests [==[parse cpu list]==])
+set_tests_properties( [==[parse cpu list]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Parse cpu list out of range]==] /root/repo/_gate_build_h5/bin/tests [==[Parse cpu list out of range]==])
+set_tests_properties( [==[Parse cpu list out of range]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[cpu list to string]==] /root/repo/_gate_build_h5/bin/tests [==[cpu list to string]==])
+set_tests_properties( [==[cpu list to string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Convert mac address using classes]==] /root/repo/_gate_build_h5/bin/tests [==[Convert mac address using classes]==])
+set_tests_properties( [==[Convert mac address using classes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Hex representation of MAC]==] /root/repo/_gate_build_h5/bin/tests [==[Hex representation of MAC]==])
+set_tests_properties( [==[Hex representation of MAC]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Convert IP using classes ]==] /root/repo/_gate_build_h5/bin/tests [==[Convert IP using classes ]==])
+set_tests_properties( [==[Convert IP using classes ]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Strange input gives 0]==] /root/repo/_gate_build_h5/bin/tests [==[Strange input gives 0]==])
+set_tests_properties( [==[Strange input gives 0]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Convert to uint for sending over network]==] /root/repo/_gate_build_h5/bin/tests [==[Convert to uint for sending over network]==])
+set_tests_properties( [==[Convert to uint for sending over network]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Hostname lookup failed throws]==] /root/repo/_gate_build_h5/bin/tests [==[Hostname lookup failed throws]==])
+set_tests_properties( [==[Hostname lookup failed throws]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[IP Output operator gives same result as string]==] /root/repo/_gate_build_h5/bin/tests [==[IP Output operator gives same result as string]==])
+set_tests_properties( [==[IP Output operator gives same result as string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[MAC Output operator gives same result as string]==] /root/repo/_gate_build_h5/bin/tests [==[MAC Output operator gives same result as string]==])
+set_tests_properties( [==[MAC Output operator gives same result as string]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Copy construct a MacAddr]==] /root/repo/_gate_build_h5/bin/tests [==[Copy construct a MacAddr]==])
+set_tests_properties( [==[Copy construct a MacAddr]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Numa node of interface without device is unknown]==] /root/repo/_gate_build_h5/bin/tests [==[Numa node of interface without device is unknown]==])
+set_tests_properties( [==[Numa node of interface without device is unknown]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Cpus of interface without device are unknown]==] /root/repo/_gate_build_h5/bin/tests [==[Cpus of interface without device are unknown]==])
+set_tests_properties( [==[Cpus of interface without device are unknown]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[udp dst struct basic properties]==] /root/repo/_gate_build_h5/bin/tests [==[udp dst struct basic properties]==])
+set_tests_properties( [==[udp dst struct basic properties]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Equality of an empty vector]==] /root/repo/_gate_build_h5/bin/tests [==[Equality of an empty vector]==])
+set_tests_properties( [==[Equality of an empty vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Equality of a vector with one element]==] /root/repo/_gate_build_h5/bin/tests [==[Equality of a vector with one element]==])
+set_tests_properties( [==[Equality of a vector with one element]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[A larger vector of the same elements]==] /root/repo/_gate_build_h5/bin/tests [==[A larger vector of the same elements]==])
+set_tests_properties( [==[A larger vector of the same elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[A vector of double with different values]==] /root/repo/_gate_build_h5/bin/tests [==[A vector of double with different values]==])
+set_tests_properties( [==[A vector of double with different values]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Sum of empty vector]==] /root/repo/_gate_build_h5/bin/tests [==[Sum of empty vector]==])
+set_tests_properties( [==[Sum of empty vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Sum of vector]==] /root/repo/_gate_build_h5/bin/tests [==[Sum of vector]==])
+set_tests_properties( [==[Sum of vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Minus one if different]==] /root/repo/_gate_build_h5/bin/tests [==[Minus one if different]==])
+set_tests_properties( [==[Minus one if different]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[minus one does not have side effects]==] /root/repo/_gate_build_h5/bin/tests [==[minus one does not have side effects]==])
+set_tests_properties( [==[minus one does not have side effects]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Compare a vector containing two vectors]==] /root/repo/_gate_build_h5/bin/tests [==[Compare a vector containing two vectors]==])
+set_tests_properties( [==[Compare a vector containing two vectors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[vector of bool]==] /root/repo/_gate_build_h5/bin/tests [==[vector of bool]==])
+set_tests_properties( [==[vector of bool]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[compare a vector of arrays]==] /root/repo/_gate_build_h5/bin/tests [==[compare a vector of arrays]==])
+set_tests_properties( [==[compare a vector of arrays]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[check if vector has duplicates]==] /root/repo/_gate_build_h5/bin/tests [==[check if vector has duplicates]==])
+set_tests_properties( [==[check if vector has duplicates]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[check for duplicates in vector of pairs]==] /root/repo/_gate_build_h5/bin/tests [==[check for duplicates in vector of pairs]==])
+set_tests_properties( [==[check for duplicates in vector of pairs]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[remove duplicates from vector]==] /root/repo/_gate_build_h5/bin/tests [==[remove duplicates from vector]==])
+set_tests_properties( [==[remove duplicates from vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[remove duplicated empty vector]==] /root/repo/_gate_build_h5/bin/tests [==[remove duplicated empty vector]==])
+set_tests_properties( [==[remove duplicated empty vector]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get size of empty file]==] /root/repo/_gate_build_h5/bin/tests [==[Get size of empty file]==])
+set_tests_properties( [==[Get size of empty file]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get size of file with data]==] /root/repo/_gate_build_h5/bin/tests [==[Get size of file with data]==])
+set_tests_properties( [==[Get size of file with data]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Channel file reading]==] /root/repo/_gate_build_h5/bin/tests [==[Channel file reading]==])
+set_tests_properties( [==[Channel file reading]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Bytes shuffled as one pixel]==] /root/repo/_gate_build_h5/bin/tests [==[Bytes shuffled as one pixel]==])
+set_tests_properties( [==[Bytes shuffled as one pixel]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Shuffle bytes to byte planes of the pixels]==] /root/repo/_gate_build_h5/bin/tests [==[Shuffle bytes to byte planes of the pixels]==])
+set_tests_properties( [==[Shuffle bytes to byte planes of the pixels]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Compress and decompress image data]==] /root/repo/_gate_build_h5/bin/tests [==[Compress and decompress image data]==])
+set_tests_properties( [==[Compress and decompress image data]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Data that does not compress is only shuffled]==] /root/repo/_gate_build_h5/bin/tests [==[Data that does not compress is only shuffled]==])
+set_tests_properties( [==[Data that does not compress is only shuffled]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get set bits from 0]==] /root/repo/_gate_build_h5/bin/tests [==[Get set bits from 0]==])
+set_tests_properties( [==[Get set bits from 0]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get set bits from 1]==] /root/repo/_gate_build_h5/bin/tests [==[Get set bits from 1]==])
+set_tests_properties( [==[Get set bits from 1]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get set bits from 2]==] /root/repo/_gate_build_h5/bin/tests [==[Get set bits from 2]==])
+set_tests_properties( [==[Get set bits from 2]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get set bits from 3]==] /root/repo/_gate_build_h5/bin/tests [==[Get set bits from 3]==])
+set_tests_properties( [==[Get set bits from 3]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[All bits set]==] /root/repo/_gate_build_h5/bin/tests [==[All bits set]==])
+set_tests_properties( [==[All bits set]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Get set bits from 523]==] /root/repo/_gate_build_h5/bin/tests [==[Get set bits from 523]==])
+set_tests_properties( [==[Get set bits from 523]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Unpack 12 bit pixels to 16 bit]==] /root/repo/_gate_build_h5/bin/tests [==[Unpack 12 bit pixels to 16 bit]==])
+set_tests_properties( [==[Unpack 12 bit pixels to 16 bit]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+add_test( [==[Unpack 12 bit pixels with simd as scalar, including tails]==] /root/repo/_gate_build_h5/bin/tests [==[Unpack 12 bit pixels with simd as scalar\, including tails]==])
+set_tests_properties( [==[Unpack 12 bit pixels with simd as scalar, including tails]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_h5/tests)
+set( tests_TESTS [==[Raw driver only for hdf5 < 1.12]==] [==[Raw data of a direct chunk write is deferred]==] [==[Raw data other than the expected chunk is written right away]==] [==[Ports write hdf5 files concurrently]==] [==[Compressed chunks read back with the hdf5 filters]==] [==[Missing images are filled, their parameters 0]==] [==[Partial last chunk up to the extent of the dataset]==] [==[File rollover in the middle of a chunk]==] [==[Images out of order across a chunk boundary]==] [==[Parameters of each image after a chunked write]==] [==[Receiver executes a command batch up to the first failure]==] [==[Receiver rejects invalid command batches]==] [==[Frame synchronizer publishes the detector image of each frame]==] [==[Frame synchronizer publishes each sub frame of eiger 32 bit]==] [==[Frame synchronizer throws for an invalid source]==] [==[Streamer sends images in order for compression and header formats]==] [==[Streamer drops images for a slow client without blocking the fifo]==] [==[Write more than the buffers with an unaligned tail]==] [==[Empty file]==] [==[Prepared file is preallocated and truncated on close]==] [==[Prepared file does not replace an existing file without overwrite]==] [==[Write from memory with io_uring]==] [==[Writes in flight with io_uring stay below the fifo depth]==] [==[Empty ring]==] [==[Push pop ring]==] [==[Batched pop from ring]==] [==[Ring between two threads wrapping around]==] [==[Empty buffer]==] [==[Push pop]==] [==[Parts of the same frame assembled into one frame]==] [==[Part missing a frame keeps its next frame for later]==] [==[Frames incomplete after a part stopped]==] [==[Parts with a different exposure time assembled into one frame]==] [==[Sub frames of eiger 32 bit are matched by sub frame index]==] [==[No frames if all parts stopped]==] [==[Calls of a module run in its persistent thread]==] [==[Exceptions of a module call are passed to the caller]==] [==[Call of a busy module does not wait for the running one]==] [==[Calls of busy modules reuse a bounded set of overflow threads]==] [==[Default construction]==] [==[Set and get a single dac name]==] [==[Set a name that is too large throws]==] [==[Length of dac name cannot be 0]==] [==[Copy a CTB config]==] [==[Move CtbConfig ]==] [==[Pattern is default constructable and has zeroed fields]==] [==[Copy construct pattern]==] [==[Compare patterns]==] [==[Construction with a defined detector type]==] [==[Read back detector type from shm]==] [==[Is shm fixed pattern shm compatible]==] [==[Get default control port]==] [==[Get default stop port]==] [==[Get default receiver TCP port]==] [==[Scenario: Construction]==] [==[Scenario: Parsing a string with the command line parser]==] [==[Scenario: Parsing strings with -h or --help]==] [==[Parse string with --help]==] [==[Parse string with -h]==] [==[Parsing consecutive strings resets not found det id]==] [==[Parsing consecutive strings resets not found multi id]==] [==[Parse with no arguments results in no command and default id]==] [==[Parse a command without client id and detector id results in default]==] [==[Parse a command with value but without client or detector id]==] [==[Decodes position]==] [==[Decodes double digit position]==] [==[Decodes position and id]==] [==[Double digit id]==] [==[Allows space between mod id and command]==] [==[Allows space between mod id and command also without :]==] [==[Allows space between mod id and command when detector id is used]==] [==[Allows space between mod id and command with detector id and :]==] [==[Parse receiver ID]==] [==[Parse receiver ID no det id]==] [==[Det id but no mod id]==] [==[Det id but no mod id but with space after -]==] [==[Parse receiver ID no det id no mod]==] [==[Parse mod and receiver id]==] [==[Det id but no no mod]==] [==[All stuff]==] [==[Parse a command that has -h in it]==] [==[Parse a command in the form 0-1 command]==] [==[Parse a command in the form 0-1:command]==] [==[Result looks and behaves like a standard container]==] [==[Default construction is possible and gives an empty result]==] [==[Result can be constructed from std::initializer_list]==] [==[Like vector it can be constructed from size and value]==] [==[Result can be iterated using modern syntax]==] [==[Calling squash on an empty Result produces default value]==] [==[When equal squash gives the front value]==] [==[When elements are not equal squash gives default value]==] [==[String compare with squash]==] [==[tsquash throws for different elements]==] [==[tsquash returns front element when equal]==] [==[When provided squash gives default value if elements differ]==] [==[It is possible to update elements by index access]==] [==[Check if elements are equal]==] [==[Result can be converted to std::vector]==] [==[Result can be printed using <<]==] [==[Convert from Result<int> to Result<ns>]==] [==[Result of vectors]==] [==[Free function begin end]==] [==[Sorting a Result]==] [==[Printing Result<std::string>]==] [==[Printing Result<int>]==] [==[String conversions]==] [==[Any element is equal]==] [==[Result contains only the specified elements]==] [==[Only with multiple values]==] [==[Calling help doesn't throw or cause segfault]==] [==[Detector wide commands are commands]==] [==[Create SharedMemory read and write]==] [==[Open existing SharedMemory and read]==] [==[Creating a second shared memory with the same name throws]==] [==[Open two shared memories to the same place]==] [==[Move SharedMemory]==] [==[Create several shared memories]==] [==[Create create a shared memory with a tag]==] [==[Create create a shared memory with a tag when SLSDETNAME is set]==] [==[map int64 to int32 throws]==] [==[Throws when cannot create socket]==] [==[Get port number for sub]==] [==[Get port number for pub]==] [==[Server address]==] [==[Send header on localhost]==] [==[Send serveral headers of different length]==] [==[Send all header fields as json and binary]==] [==[Send header and data]==] [==[Send data without copy]==] [==[Receive compressed data]==] [==[LogLevel to string]==] [==[Test output]==] [==[Get packet size returns the packet size we set in the constructor]==] [==[Receive data from a vector]==] [==[Shutdown socket without hanging when waiting for data]==] [==[Too small packet]==] [==[Receive a batch of packets]==] [==[Scatter header and payload of a batch of packets]==] [==[Receive a batch of packets from packet ring or fall back]==] [==[Invalid batch size]==] [==[Receive an int to an external buffer]==] is_container [==[Check for str() method]==] [==[Check for str() on ostream]==] is_duration [==[initializer list]==] [==[Check for emplace back]==] [==[Integer conversions]==] [==[floating point conversions]==] [==[conversion from duration to string]==] [==[Convert vector of time]==] [==[Vector of int]==] [==[Vector of double]==] Array [==[Convert types with str method]==] [==[String to string]==] [==[vector of strings]==] [==[run status]==] [==[string to std::chrono::duration]==] [==[string to detectorType]==] vec [==[uint32 from string]==] [==[uint64 from string]==] [==[int from string]==] [==[int64_t from string]==] [==[std::map of strings]==] [==[std::map of ints]==] [==[Detector type]==] [==[Formatting slsDetectorDefs::ROI]==] [==[Streaming of slsDetectorDefs::ROI]==] std::array [==[string to dac index]==] [==[dac index to string]==] [==[convert vector of strings to dac index]==] [==[vector of dac index to string]==] [==[int or uin64_t to a string in hex]==] [==[Streaming of slsDetectorDefs::scanParameters]==] [==[Printing c style arrays of int]==] [==[Printing c style arrays of uint8]==] [==[Printing c style arrays of double]==] [==[Print a member of patternParameters]==] streamingInterface [==[speedLevel to string]==] [==[string to speedLevel]==] [==[StaticVector is a container]==] [==[Comparing StaticVector containers]==] [==[Compare array and fixed capacity container]==] [==[Compare vector and fixed capacity container]==] [==[Construct from vector]==] [==[Copy construct from vector]==] [==[Copy assignment from vector]==] [==[Construct from array]==] [==[Copy assign from array]==] [==[Copy construct from array]==] [==[Free function and method gives the same iterators]==] [==[Scenario: StaticVectors can be sized and resized]==] [==[Scenario: Comparison of StaticVectors]==] [==[Scenario: Sorting, removing and other manipulation of a container]==] [==[Scenario: Assigning containers to each other]==] [==[Scenario: Converting to vector]==] StaticVector [==[StaticVector stream]==] [==[The server recive the same message as we send]==] [==[Server serves many commands on a connection kept open]==] [==[throws on no server]==] [==[sls_detector_module default construction]==] [==[sls_detector_module from type]==] [==[assign module]==] [==[default construct scanParameters]==] [==[compare two scanParameters]==] [==[copy a string]==] [==[copy a long string]==] [==[split a string with end delimiter]==] [==[split a string without end delimiter]==] [==[Remove char from string]==] [==[Remove char from empty string]==] [==[Many characters in a row]==] [==[Check is string is integer]==] [==[Replace substring in string]==] [==[Replace --help in command]==] [==[Replace -h in command]==] [==[replace --help]==] [==[port host]==] [==[port missing]==] [==[parse cpu list]==] [==[Parse cpu list out of range]==] [==[cpu list to string]==] [==[Convert mac address using classes]==] [==[Hex representation of MAC]==] [==[Convert IP using classes ]==] [==[Strange input gives 0]==] [==[Convert to uint for sending over network]==] [==[Hostname lookup failed throws]==] [==[IP Output operator gives same result as string]==] [==[MAC Output operator gives same result as string]==] [==[Copy construct a MacAddr]==] [==[Numa node of interface without device is unknown]==] [==[Cpus of interface without device are unknown]==] [==[udp dst struct basic properties]==] [==[Equality of an empty vector]==] [==[Equality of a vector with one element]==] [==[A larger vector of the same elements]==] [==[A vector of double with different values]==] [==[Sum of empty vector]==] [==[Sum of vector]==] [==[Minus one if different]==] [==[minus one does not have side effects]==] [==[Compare a vector containing two vectors]==] [==[vector of bool]==] [==[compare a vector of arrays]==] [==[check if vector has duplicates]==] [==[check for duplicates in vector of pairs]==] [==[remove duplicates from vector]==] [==[remove duplicated empty vector]==] [==[Get size of empty file]==] [==[Get size of file with data]==] [==[Channel file reading]==] [==[Bytes shuffled as one pixel]==] [==[Shuffle bytes to byte planes of the pixels]==] [==[Compress and decompress image data]==] [==[Data that does not compress is only shuffled]==] [==[Get set bits from 0]==] [==[Get set bits from 1]==] [==[Get set bits from 2]==] [==[Get set bits from 3]==] [==[All bits set]==] [==[Get set bits from 523]==] [==[Unpack 12 bit pixels to 16 bit]==] [==[Unpack 12 bit pixels with simd as scalar, including tails]==])
@@ -16,6 +16,7 @@ cp build/install/bin/sls_detector_put $PREFIX/bin/.
 cp build/install/bin/sls_detector_help $PREFIX/bin/.
 cp build/install/bin/slsReceiver $PREFIX/bin/.
 cp build/install/bin/slsMultiReceiver $PREFIX/bin/.
+cp build/install/bin/slsFrameSynchronizer $PREFIX/bin/.
 
 
 cp build/install/include/sls/* $PREFIX/include/sls
@@ -27,4 +27,5 @@ MacAddr = _slsdet.MacAddr
 scanParameters = _slsdet.scanParameters
 currentSrcParameters = _slsdet.currentSrcParameters
 DurationWrapper = _slsdet.DurationWrapper
-pedestalParameters = _slsdet.pedestalParameters
\ No newline at end of file
+pedestalParameters = _slsdet.pedestalParameters
+streamingStatistics = _slsdet.streamingStatistics
\ No newline at end of file
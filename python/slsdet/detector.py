@@ -250,6 +250,20 @@ class Detector(CppDetectorApi):
         """
         return self.getKernelVersion()
 
+    @property
+    def persistentconnections(self):
+        """Keep one tcp connection per module to the control server, stop server and receiver open between commands of this process. Default is disabled.
+
+        Note
+        ----
+        Connections are reopened if closed by the server.
+        """
+        return self.getPersistentConnections()
+
+    @persistentconnections.setter
+    def persistentconnections(self, value):
+        self.setPersistentConnections(value)
+
     @property
     def clientversion(self):
         """Client software version in format [YYMMDD]
@@ -287,6 +301,28 @@ class Detector(CppDetectorApi):
         """
         return self.getRxThreadIds()
 
+    @property
+    @element
+    def rx_cpus(self):
+        """
+        Cpus the receiver threads are pinned to, as space separated cpu lists in order of [tcp, listener 0, processor 0, streamer 0, listener 1, processor 1, streamer 1].
+
+        Note
+        -----
+        '-' or missing for all cpus of the receiver process (default). 'auto' pins the listeners to cpus local to the udp interface but not handling its interrupts and the other threads to the remaining local cpus. \n
+        Get gives the cpus the threads are running on, '-' if the thread does not exist.
+
+        Example
+        -------
+        >>> d.rx_cpus = '0 2 3-5'
+        >>> d.rx_cpus = 'auto'
+        """
+        return self.getRxThreadCpus()
+
+    @rx_cpus.setter
+    def rx_cpus(self, value):
+        ut.set_using_dict(self.setRxThreadCpus, value)
+
     @property
     @element
     def rx_arping(self):
@@ -881,6 +917,49 @@ class Detector(CppDetectorApi):
     def rx_fifodepth(self, frames):
         ut.set_using_dict(self.setRxFifoDepth, frames)
 
+    @property
+    @element
+    def rx_fifohugepage(self):
+        """Allocate the receiver fifo from huge pages of this size in MB.
+
+        Note
+        -----
+        Options: 0 (normal pages, default), 2, 1024 \n
+        Falls back to normal pages if none are reserved (/proc/sys/vm/nr_hugepages). \n
+        Get returns the page size actually used.
+        """
+        return self.getRxFifoHugePageSize()
+
+    @rx_fifohugepage.setter
+    def rx_fifohugepage(self, size_mb):
+        ut.set_using_dict(self.setRxFifoHugePageSize, size_mb)
+
+    @property
+    @element
+    def rx_fifonumanode(self):
+        """Numa node to allocate the receiver fifo memory on. -1 (default) uses the node of the rx_udpip interface. Get returns the node actually bound to, -1 if none."""
+        return self.getRxFifoNumaNode()
+
+    @rx_fifonumanode.setter
+    def rx_fifonumanode(self, node):
+        ut.set_using_dict(self.setRxFifoNumaNode, node)
+
+    @property
+    @element
+    def rx_processingthreads(self):
+        """
+        Number of threads processing (padding, roi, call backs) the images of each udp port in parallel. Default is 1. Max value is 64.
+
+        Note
+        -----
+        Images are still written to file and streamed in order. Data call backs must be thread safe for more than 1.
+        """
+        return self.getRxProcessingThreads()
+
+    @rx_processingthreads.setter
+    def rx_processingthreads(self, value):
+        ut.set_using_dict(self.setRxProcessingThreads, value)
+
     @property
     @element
     def rx_silent(self):
@@ -978,6 +1057,7 @@ class Detector(CppDetectorApi):
         Options: BINARY, HDF5
         Default: BINARY
         For HDF5, package must be compiled with HDF5 flags. Default is binary. 
+        With hdf5 >= 1.12, the image data of all ports is written in one hdf5 lib mutex, which limits the rate of multi port receivers. Ports write in parallel only with hdf5 1.10 or 1.11.
 
         Example
         --------
@@ -1090,6 +1170,68 @@ class Detector(CppDetectorApi):
     def rx_framesperfile(self, n_frames):
         ut.set_using_dict(self.setFramesPerFile, n_frames)
 
+    @property
+    @element
+    def rx_writeengine(self):
+        """
+        How the receiver writes binary files.
+        Enum: writeEngine
+
+        Note
+        -----
+        Options: IO_THREAD, IO_URING \n
+        Default: IO_THREAD \n
+        IO_URING writes frames that are not streamed directly from the fifo with io_uring (kernel >= 5.6), otherwise falls back to IO_THREAD. Not for hdf5 files, their chunks are written with blocking pwrite by the processing (or compression) threads of each port.
+
+        Example
+        --------
+        >>> d.rx_writeengine = writeEngine.IO_URING
+        >>> d.rx_writeengine
+        writeEngine.IO_URING
+        """
+        return self.getRxWriteEngine()
+
+    @rx_writeengine.setter
+    def rx_writeengine(self, engine):
+        ut.set_using_dict(self.setRxWriteEngine, engine)
+
+    @property
+    @element
+    def rx_compression(self):
+        """
+        Compression of the image datasets of receiver hdf5 files.
+        Enum: fileCompression
+
+        Note
+        -----
+        Options: NO_COMPRESSION, SHUFFLE_DEFLATE \n
+        Default: NO_COMPRESSION \n
+        SHUFFLE_DEFLATE applies the hdf5 shuffle and deflate (level 1) filters, compressed in parallel in the receiver. Deflate is the only codec (no bitshuffle, lz4 or zstd), so that files are readable with any hdf5 library without filter plugins.
+
+        Example
+        --------
+        >>> d.rx_compression = fileCompression.SHUFFLE_DEFLATE
+        >>> d.rx_compression
+        fileCompression.SHUFFLE_DEFLATE
+        """
+        return self.getRxFileCompression()
+
+    @rx_compression.setter
+    def rx_compression(self, compression):
+        ut.set_using_dict(self.setRxFileCompression, compression)
+
+    @property
+    @element
+    def rx_compressionthreads(self):
+        """
+        Number of threads compressing the hdf5 chunks (rx_compression) and the streamed images (rx_zmqcompression) of each udp port in parallel. Default is 4. Max value is 64.
+        """
+        return self.getRxCompressionThreads()
+
+    @rx_compressionthreads.setter
+    def rx_compressionthreads(self, value):
+        ut.set_using_dict(self.setRxCompressionThreads, value)
+
     # ZMQ Streaming Parameters (Receiver<->Client)
 
     @property
@@ -1275,6 +1417,97 @@ class Detector(CppDetectorApi):
     def rx_zmqhwm(self, n_frames):
         self.setRxZmqHwm(n_frames)
 
+    @property
+    @element
+    def rx_zmqcompression(self):
+        """
+        Compression of the image data streamed out of the receiver.
+        Enum: fileCompression
+
+        Note
+        -----
+        Options: NO_COMPRESSION, SHUFFLE_DEFLATE \n
+        Default: NO_COMPRESSION \n
+        SHUFFLE_DEFLATE (the hdf5 shuffle, then deflate) is the only codec, there is no lz4 or zstd. It saves network bandwidth for images that compress well, at the cost of receiver cpu (rx_compressionthreads) and latency, and is not meant for the full rate of fast detectors. Compressed in parallel in the receiver. The codec is in the zmq header and the client decompresses transparently. Images that do not compress are sent as they are.
+
+        Example
+        --------
+        >>> d.rx_zmqcompression = fileCompression.SHUFFLE_DEFLATE
+        >>> d.rx_zmqcompression
+        fileCompression.SHUFFLE_DEFLATE
+        """
+        return self.getRxZmqCompression()
+
+    @rx_zmqcompression.setter
+    def rx_zmqcompression(self, compression):
+        ut.set_using_dict(self.setRxZmqCompression, compression)
+
+    @property
+    @element
+    def rx_zmqcomplevel(self):
+        """Deflate level of rx_zmqcompression [1-9]. Default is 1 (fastest)."""
+        return self.getRxZmqCompressionLevel()
+
+    @rx_zmqcomplevel.setter
+    def rx_zmqcomplevel(self, level):
+        ut.set_using_dict(self.setRxZmqCompressionLevel, level)
+
+    @property
+    @element
+    def rx_zmqheader(self):
+        """
+        Format of the zmq headers streamed out of the receiver.
+        Enum: zmqHeaderFormat
+
+        Note
+        -----
+        Options: JSON_HEADER, BINARY_HEADER \n
+        Default: JSON_HEADER \n
+        BINARY_HEADER is a packed struct that is faster to create and parse. The client detects the format, other zmq clients might only read json.
+
+        Example
+        --------
+        >>> d.rx_zmqheader = zmqHeaderFormat.BINARY_HEADER
+        >>> d.rx_zmqheader
+        zmqHeaderFormat.BINARY_HEADER
+        """
+        return self.getRxZmqHeaderFormat()
+
+    @rx_zmqheader.setter
+    def rx_zmqheader(self, format):
+        ut.set_using_dict(self.setRxZmqHeaderFormat, format)
+
+    @property
+    @element
+    def rx_zmqpolicy(self):
+        """
+        What the receiver streams when a client is too slow and its zmq send queue (a quarter of the fifo) is full.
+        Enum: zmqStreamingPolicy
+
+        Note
+        -----
+        Options: BLOCK_ON_FULL, DROP_NEWEST, DROP_OLDEST, KEEP_LATEST \n
+        Default: BLOCK_ON_FULL \n
+        BLOCK_ON_FULL waits, which can take all fifo buffers and cause packet loss also for file writing. The others drop the new images, the oldest waiting or all but the latest, so that file writing is not affected. The receiver logs when it drops images.
+
+        Example
+        --------
+        >>> d.rx_zmqpolicy = zmqStreamingPolicy.KEEP_LATEST
+        >>> d.rx_zmqpolicy
+        zmqStreamingPolicy.KEEP_LATEST
+        """
+        return self.getRxZmqPolicy()
+
+    @rx_zmqpolicy.setter
+    def rx_zmqpolicy(self, policy):
+        ut.set_using_dict(self.setRxZmqPolicy, policy)
+
+    @property
+    @element
+    def rx_zmqstats(self):
+        """Images streamed and dropped and their latency in the receiver (from the fifo until zmq released them) for each port, since the start of the acquisition."""
+        return self.getRxZmqStatistics()
+
     @property
     @element
     def udp_dstip(self):
@@ -1609,6 +1842,46 @@ class Detector(CppDetectorApi):
         """Gets actual udp socket buffer size. Double the size of rx_udpsocksize due to kernel bookkeeping."""
         return self.getRxRealUDPSocketBufferSize()
 
+    @property
+    @element
+    def rx_udpbatchsize(self):
+        """Number of udp packets received per system call in receiver. Default is 1. Max value is 1024.
+
+        Note
+        -----
+        Larger values reduce system calls and packet loss at high frame rates.
+        """
+        return self.getRxUDPBatchSize()
+
+    @rx_udpbatchsize.setter
+    def rx_udpbatchsize(self, value):
+        ut.set_using_dict(self.setRxUDPBatchSize, value)
+
+    @property
+    @element
+    def rx_socketbackend(self):
+        """
+        How the receiver reads udp packets.
+        Enum: socketBackend
+
+        Note
+        -----
+        Options: UDP_SOCKET, PACKET_MMAP \n
+        Default: UDP_SOCKET \n
+        PACKET_MMAP reads packets from a memory mapped kernel ring on the rx_udpip interface. Needs CAP_NET_RAW and jumbo frames, otherwise falls back to UDP_SOCKET.
+
+        Example
+        --------
+        >>> d.rx_socketbackend = socketBackend.PACKET_MMAP
+        >>> d.rx_socketbackend
+        socketBackend.PACKET_MMAP
+        """
+        return self.getRxSocketBackend()
+
+    @rx_socketbackend.setter
+    def rx_socketbackend(self, backend):
+        ut.set_using_dict(self.setRxSocketBackend, backend)
+
     @property
     def trimbits(self):
         """
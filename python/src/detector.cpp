@@ -53,6 +53,13 @@ void init_det(py::module &m) {
                        py::arg(), py::arg());
     CppDetectorApi.def("getShmId",
                        (int (Detector::*)() const) & Detector::getShmId);
+    CppDetectorApi.def("getPersistentConnections",
+                       (bool (Detector::*)() const) &
+                           Detector::getPersistentConnections);
+    CppDetectorApi.def("setPersistentConnections",
+                       (void (Detector::*)(const bool)) &
+                           Detector::setPersistentConnections,
+                       py::arg());
     CppDetectorApi.def("getPackageVersion", (std::string(Detector::*)() const) &
                                                 Detector::getPackageVersion);
     CppDetectorApi.def("getClientVersion", (std::string(Detector::*)() const) &
@@ -858,6 +865,30 @@ void init_det(py::module &m) {
                        (void (Detector::*)(int, sls::Positions)) &
                            Detector::setRxFifoDepth,
                        py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def("getRxFifoHugePageSize",
+                       (Result<int>(Detector::*)(sls::Positions) const) &
+                           Detector::getRxFifoHugePageSize,
+                       py::arg() = Positions{});
+    CppDetectorApi.def("setRxFifoHugePageSize",
+                       (void (Detector::*)(int, sls::Positions)) &
+                           Detector::setRxFifoHugePageSize,
+                       py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def("getRxFifoNumaNode",
+                       (Result<int>(Detector::*)(sls::Positions) const) &
+                           Detector::getRxFifoNumaNode,
+                       py::arg() = Positions{});
+    CppDetectorApi.def("setRxFifoNumaNode",
+                       (void (Detector::*)(int, sls::Positions)) &
+                           Detector::setRxFifoNumaNode,
+                       py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def("getRxProcessingThreads",
+                       (Result<int>(Detector::*)(sls::Positions) const) &
+                           Detector::getRxProcessingThreads,
+                       py::arg() = Positions{});
+    CppDetectorApi.def("setRxProcessingThreads",
+                       (void (Detector::*)(int, sls::Positions)) &
+                           Detector::setRxProcessingThreads,
+                       py::arg(), py::arg() = Positions{});
     CppDetectorApi.def("getRxSilentMode",
                        (Result<bool>(Detector::*)(sls::Positions) const) &
                            Detector::getRxSilentMode,
@@ -914,6 +945,33 @@ void init_det(py::module &m) {
         (Result<std::array<pid_t, 9>>(Detector::*)(sls::Positions) const) &
             Detector::getRxThreadIds,
         py::arg() = Positions{});
+    CppDetectorApi.def("getRxThreadCpus",
+                       (Result<std::string>(Detector::*)(sls::Positions) const) &
+                           Detector::getRxThreadCpus,
+                       py::arg() = Positions{});
+    CppDetectorApi.def("setRxThreadCpus",
+                       (void (Detector::*)(const std::string &,
+                                           sls::Positions)) &
+                           Detector::setRxThreadCpus,
+                       py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def("getRxUDPBatchSize",
+                       (Result<int>(Detector::*)(sls::Positions) const) &
+                           Detector::getRxUDPBatchSize,
+                       py::arg() = Positions{});
+    CppDetectorApi.def("setRxUDPBatchSize",
+                       (void (Detector::*)(int, sls::Positions)) &
+                           Detector::setRxUDPBatchSize,
+                       py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def(
+        "getRxSocketBackend",
+        (Result<defs::socketBackend>(Detector::*)(sls::Positions) const) &
+            Detector::getRxSocketBackend,
+        py::arg() = Positions{});
+    CppDetectorApi.def(
+        "setRxSocketBackend",
+        (void (Detector::*)(defs::socketBackend, sls::Positions)) &
+            Detector::setRxSocketBackend,
+        py::arg(), py::arg() = Positions{});
     CppDetectorApi.def("getRxArping",
                        (Result<bool>(Detector::*)(sls::Positions) const) &
                            Detector::getRxArping,
@@ -999,6 +1057,34 @@ void init_det(py::module &m) {
                        (void (Detector::*)(int, sls::Positions)) &
                            Detector::setFramesPerFile,
                        py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def(
+        "getRxWriteEngine",
+        (Result<defs::writeEngine>(Detector::*)(sls::Positions) const) &
+            Detector::getRxWriteEngine,
+        py::arg() = Positions{});
+    CppDetectorApi.def(
+        "setRxWriteEngine",
+        (void (Detector::*)(defs::writeEngine, sls::Positions)) &
+            Detector::setRxWriteEngine,
+        py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def(
+        "getRxFileCompression",
+        (Result<defs::fileCompression>(Detector::*)(sls::Positions) const) &
+            Detector::getRxFileCompression,
+        py::arg() = Positions{});
+    CppDetectorApi.def(
+        "setRxFileCompression",
+        (void (Detector::*)(defs::fileCompression, sls::Positions)) &
+            Detector::setRxFileCompression,
+        py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def("getRxCompressionThreads",
+                       (Result<int>(Detector::*)(sls::Positions) const) &
+                           Detector::getRxCompressionThreads,
+                       py::arg() = Positions{});
+    CppDetectorApi.def("setRxCompressionThreads",
+                       (void (Detector::*)(int, sls::Positions)) &
+                           Detector::setRxCompressionThreads,
+                       py::arg(), py::arg() = Positions{});
     CppDetectorApi.def("getRxZmqDataStream",
                        (Result<bool>(Detector::*)(sls::Positions) const) &
                            Detector::getRxZmqDataStream,
@@ -1077,6 +1163,49 @@ void init_det(py::module &m) {
     CppDetectorApi.def("setRxZmqHwm",
                        (void (Detector::*)(const int)) & Detector::setRxZmqHwm,
                        py::arg());
+    CppDetectorApi.def(
+        "getRxZmqCompression",
+        (Result<defs::fileCompression>(Detector::*)(sls::Positions) const) &
+            Detector::getRxZmqCompression,
+        py::arg() = Positions{});
+    CppDetectorApi.def(
+        "setRxZmqCompression",
+        (void (Detector::*)(defs::fileCompression, sls::Positions)) &
+            Detector::setRxZmqCompression,
+        py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def("getRxZmqCompressionLevel",
+                       (Result<int>(Detector::*)(sls::Positions) const) &
+                           Detector::getRxZmqCompressionLevel,
+                       py::arg() = Positions{});
+    CppDetectorApi.def("setRxZmqCompressionLevel",
+                       (void (Detector::*)(int, sls::Positions)) &
+                           Detector::setRxZmqCompressionLevel,
+                       py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def(
+        "getRxZmqHeaderFormat",
+        (Result<defs::zmqHeaderFormat>(Detector::*)(sls::Positions) const) &
+            Detector::getRxZmqHeaderFormat,
+        py::arg() = Positions{});
+    CppDetectorApi.def(
+        "setRxZmqHeaderFormat",
+        (void (Detector::*)(defs::zmqHeaderFormat, sls::Positions)) &
+            Detector::setRxZmqHeaderFormat,
+        py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def(
+        "getRxZmqPolicy",
+        (Result<defs::zmqStreamingPolicy>(Detector::*)(sls::Positions) const) &
+            Detector::getRxZmqPolicy,
+        py::arg() = Positions{});
+    CppDetectorApi.def(
+        "setRxZmqPolicy",
+        (void (Detector::*)(defs::zmqStreamingPolicy, sls::Positions)) &
+            Detector::setRxZmqPolicy,
+        py::arg(), py::arg() = Positions{});
+    CppDetectorApi.def("getRxZmqStatistics",
+                       (Result<std::vector<defs::streamingStatistics>>(
+                           Detector::*)(sls::Positions) const) &
+                           Detector::getRxZmqStatistics,
+                       py::arg() = Positions{});
     CppDetectorApi.def("getSubExptime",
                        (Result<sls::ns>(Detector::*)(sls::Positions) const) &
                            Detector::getSubExptime,
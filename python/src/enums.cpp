@@ -47,6 +47,47 @@ void init_enums(py::module &m) {
                slsDetectorDefs::frameDiscardPolicy::NUM_DISCARD_POLICIES)
         .export_values();
 
+    py::enum_<slsDetectorDefs::socketBackend>(Defs, "socketBackend")
+        .value("UDP_SOCKET", slsDetectorDefs::socketBackend::UDP_SOCKET)
+        .value("PACKET_MMAP", slsDetectorDefs::socketBackend::PACKET_MMAP)
+        .value("NUM_SOCKET_BACKENDS",
+               slsDetectorDefs::socketBackend::NUM_SOCKET_BACKENDS)
+        .export_values();
+
+    py::enum_<slsDetectorDefs::writeEngine>(Defs, "writeEngine")
+        .value("IO_THREAD", slsDetectorDefs::writeEngine::IO_THREAD)
+        .value("IO_URING", slsDetectorDefs::writeEngine::IO_URING)
+        .value("NUM_WRITE_ENGINES",
+               slsDetectorDefs::writeEngine::NUM_WRITE_ENGINES)
+        .export_values();
+
+    py::enum_<slsDetectorDefs::fileCompression>(Defs, "fileCompression")
+        .value("NO_COMPRESSION",
+               slsDetectorDefs::fileCompression::NO_COMPRESSION)
+        .value("SHUFFLE_DEFLATE",
+               slsDetectorDefs::fileCompression::SHUFFLE_DEFLATE)
+        .value("NUM_FILE_COMPRESSIONS",
+               slsDetectorDefs::fileCompression::NUM_FILE_COMPRESSIONS)
+        .export_values();
+
+    py::enum_<slsDetectorDefs::zmqHeaderFormat>(Defs, "zmqHeaderFormat")
+        .value("JSON_HEADER", slsDetectorDefs::zmqHeaderFormat::JSON_HEADER)
+        .value("BINARY_HEADER",
+               slsDetectorDefs::zmqHeaderFormat::BINARY_HEADER)
+        .value("NUM_ZMQ_HEADER_FORMATS",
+               slsDetectorDefs::zmqHeaderFormat::NUM_ZMQ_HEADER_FORMATS)
+        .export_values();
+
+    py::enum_<slsDetectorDefs::zmqStreamingPolicy>(Defs, "zmqStreamingPolicy")
+        .value("BLOCK_ON_FULL",
+               slsDetectorDefs::zmqStreamingPolicy::BLOCK_ON_FULL)
+        .value("DROP_NEWEST", slsDetectorDefs::zmqStreamingPolicy::DROP_NEWEST)
+        .value("DROP_OLDEST", slsDetectorDefs::zmqStreamingPolicy::DROP_OLDEST)
+        .value("KEEP_LATEST", slsDetectorDefs::zmqStreamingPolicy::KEEP_LATEST)
+        .value("NUM_ZMQ_STREAMING_POLICIES",
+               slsDetectorDefs::zmqStreamingPolicy::NUM_ZMQ_STREAMING_POLICIES)
+        .export_values();
+
     py::enum_<slsDetectorDefs::fileFormat>(Defs, "fileFormat")
         .value("BINARY", slsDetectorDefs::fileFormat::BINARY)
         .value("HDF5", slsDetectorDefs::fileFormat::HDF5)
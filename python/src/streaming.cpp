@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+
+#include "py_headers.h"
+
+#include "sls/ToString.h"
+#include "sls/sls_detector_defs.h"
+
+namespace py = pybind11;
+void init_streaming(py::module &m) {
+
+    using src = slsDetectorDefs::streamingStatistics;
+    py::class_<src> streamingStatistics(m, "streamingStatistics");
+
+    streamingStatistics.def(py::init());
+    streamingStatistics.def_readwrite("streamed", &src::streamed);
+    streamingStatistics.def_readwrite("dropped", &src::dropped);
+    streamingStatistics.def_readwrite("averageLatency_ns",
+                                      &src::averageLatency_ns);
+    streamingStatistics.def_readwrite("maxLatency_ns", &src::maxLatency_ns);
+    streamingStatistics.def(pybind11::self == pybind11::self);
+
+    streamingStatistics.def("__repr__",
+                            [](const src &a) { return sls::ToString(a); });
+}
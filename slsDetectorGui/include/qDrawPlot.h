@@ -5,6 +5,7 @@
 #include "sls/Detector.h"
 #include "ui_form_plot.h"
 #include <mutex>
+#include <vector>
 
 class QResizeEvent;
 
@@ -137,6 +138,8 @@ class qDrawPlot : public QWidget, private Ui::PlotObject {
     double *gainDatay1d{nullptr};
     double *data2d{nullptr};
     double *gainData{nullptr};
+    // 12 bit data unpacked
+    std::vector<uint16_t> pixels16Bit;
 
     // options
     bool isPlot{true};
@@ -7,6 +7,7 @@
 #include "sls/detectorData.h"
 
 #include "sls/ToString.h"
+#include "sls/bit_utils.h"
 #include "sls/detectorData.h"
 
 #include <QFileDialog>
@@ -1109,7 +1110,6 @@ void qDrawPlot::toDoublePixelData(double *dest, char *source, int size,
     // mythen3 / gotthard2 debugging
     int discardBits = numDiscardBits;
 
-    uint16_t temp = 0;
     uint8_t *src = (uint8_t *)source;
     switch (dr) {
 
@@ -1131,15 +1131,10 @@ void qDrawPlot::toDoublePixelData(double *dest, char *source, int size,
         break;
 
     case 12:
+        pixels16Bit.resize(size);
+        unpack12To16Bit(pixels16Bit.data(), src, size);
         for (ichan = 0; ichan < size; ++ichan) {
-            temp = (*src++ & 0xFF);
-            temp |= ((*src & 0xF) << 8u);
-            dest[ichan] = (double)temp;
-            ++ichan;
-
-            temp = ((*src++ & 0xF0) >> 4u);
-            temp |= ((*src++ & 0xFF) << 4u);
-            dest[ichan] = (double)temp;
+            dest[ichan] = pixels16Bit[ichan];
         }
         break;
 
@@ -8,6 +8,14 @@
 #define GOODBYE (-200)
 #define REBOOT  (-400)
 
+/** command of a command batch, as received from the client */
+struct batchCommand {
+    int fnum;
+    int argsSize;
+    int retvalSize;
+    char *args;
+};
+
 // initialization functions
 int updateModeAllowedFunction(int file_des);
 int printSocketReadError();
@@ -329,3 +337,6 @@ int getColumn();
 int setColumn(int);
 int get_pedestal_mode(int);
 int set_pedestal_mode(int);
+int executeBatchCommand(struct batchCommand *command, char *reply,
+                        int *replySize, int *result);
+int exec_command_batch(int);
@@ -5,6 +5,7 @@
 
 #include <arpa/inet.h>
 #include <errno.h>
+#include <netinet/tcp.h>
 #include <string.h>
 
 #include <sys/select.h>
@@ -33,6 +34,8 @@ char mess[MAX_STR_LENGTH];
 
 // Local variables
 uint32_t dummyClientIP = 0u;
+// client ip of each connection kept open between commands
+uint32_t clientIPs[FD_SETSIZE];
 int myport = -1;
 // socket descriptor set
 fd_set readset, tempset;
@@ -158,87 +161,57 @@ int acceptConnection(int socketDescriptor) {
         LOG(logDEBUG3,
             ("%s select returned!\n", (isControlServer ? "control" : "stop")));
 
-        // loop through the file descriptor set
-        for (int j = 0; j < maxfd + 1; ++j) {
+        // new clients first, so that a client sending many commands on its
+        // connection does not keep out the others
+        if (FD_ISSET(socketDescriptor, &tempset)) {
+            // accept connection (if error)
+            if ((file_des = accept(socketDescriptor,
+                                   (struct sockaddr *)&addressC,
+                                   &address_length)) < 0) {
+                LOG(logERROR,
+                    ("%s socket accept() error. Connection refused. Error "
+                     "Number: %d, Message: %s\n",
+                     (isControlServer ? "control" : "stop"), errno,
+                     strerror(errno)));
+                return -1;
+            }
+            if (file_des >= FD_SETSIZE) {
+                LOG(logERROR, ("%s socket: too many connections\n",
+                               (isControlServer ? "control" : "stop")));
+                close(file_des);
+                return -1;
+            }
+            char buf[INET_ADDRSTRLEN] = "";
+            memset(buf, 0, INET_ADDRSTRLEN);
+            inet_ntop(AF_INET, &(addressC.sin_addr), buf, INET_ADDRSTRLEN);
+            LOG(logDEBUG3, ("%s socket accepted connection, fd= %d\n",
+                            (isControlServer ? "control" : "stop"), file_des));
+
+            getIpAddressFromString(buf, &dummyClientIP);
+            clientIPs[file_des] = dummyClientIP;
+
+            // detect clients gone without closing the connection
+            int keepAlive = 1;
+            setsockopt(file_des, SOL_SOCKET, SO_KEEPALIVE, &keepAlive,
+                       sizeof(keepAlive));
+            // replies are sent in pieces, which would otherwise wait for
+            // the delayed ack of the client on a connection kept open
+            int noDelay = 1;
+            setsockopt(file_des, IPPROTO_TCP, TCP_NODELAY, &noDelay,
+                       sizeof(noDelay));
+
+            // add the file descriptor from accept
+            FD_SET(file_des, &readset);
+            maxfd = (maxfd < file_des) ? file_des : maxfd;
+            return file_des;
+        }
 
-            // checks if file descriptor part of set
-            if (FD_ISSET(j, &tempset)) {
+        // command on a connection kept open (or closed by its client)
+        for (int j = 0; j < maxfd + 1; ++j) {
+            if (j != socketDescriptor && FD_ISSET(j, &tempset)) {
                 LOG(logDEBUG3, ("fd %d is set\n", j));
-
-                // clear the temporary set
-                FD_CLR(j, &tempset);
-
-                // accept connection (if error)
-                if ((file_des = accept(j, (struct sockaddr *)&addressC,
-                                       &address_length)) < 0) {
-                    LOG(logERROR,
-                        ("%s socket accept() error. Connection refused.\n",
-                         "Error Number: %d, Message: %s\n",
-                         (isControlServer ? "control" : "stop"), myport, errno,
-                         strerror(errno)));
-                    switch (errno) {
-                    case EWOULDBLOCK:
-                        LOG(logERROR, ("ewouldblock eagain"));
-                        break;
-                    case EBADF:
-                        LOG(logERROR, ("ebadf\n"));
-                        break;
-                    case ECONNABORTED:
-                        LOG(logERROR, ("econnaborted\n"));
-                        break;
-                    case EFAULT:
-                        LOG(logERROR, ("efault\n"));
-                        break;
-                    case EINTR:
-                        LOG(logERROR, ("eintr\n"));
-                        break;
-                    case EINVAL:
-                        LOG(logERROR, ("einval\n"));
-                        break;
-                    case EMFILE:
-                        LOG(logERROR, ("emfile\n"));
-                        break;
-                    case ENFILE:
-                        LOG(logERROR, ("enfile\n"));
-                        break;
-                    case ENOTSOCK:
-                        LOG(logERROR, ("enotsock\n"));
-                        break;
-                    case EOPNOTSUPP:
-                        LOG(logERROR, ("eOPNOTSUPP\n"));
-                        break;
-                    case ENOBUFS:
-                        LOG(logERROR, ("ENOBUFS\n"));
-                        break;
-                    case ENOMEM:
-                        LOG(logERROR, ("ENOMEM\n"));
-                        break;
-                    case ENOSR:
-                        LOG(logERROR, ("ENOSR\n"));
-                        break;
-                    case EPROTO:
-                        LOG(logERROR, ("EPROTO\n"));
-                        break;
-                    default:
-                        LOG(logERROR, ("unknown error\n"));
-                    }
-                }
-                // accept success
-                else {
-                    char buf[INET_ADDRSTRLEN] = "";
-                    memset(buf, 0, INET_ADDRSTRLEN);
-                    inet_ntop(AF_INET, &(addressC.sin_addr), buf,
-                              INET_ADDRSTRLEN);
-                    LOG(logDEBUG3,
-                        ("%s socket accepted connection, fd= %d\n",
-                         (isControlServer ? "control" : "stop"), file_des));
-
-                    getIpAddressFromString(buf, &dummyClientIP);
-
-                    // add the file descriptor from accept
-                    FD_SET(file_des, &readset);
-                    maxfd = (maxfd < file_des) ? file_des : maxfd;
-                }
+                dummyClientIP = clientIPs[j];
+                return j;
             }
         }
     }
@@ -384,7 +357,8 @@ int receiveDataOnly(int file_des, void *buf, int length) {
                          ? SEND_REC_MAX_SIZE
                          : length; // (condition) ? if_true : if_false
         nreceived = read(file_des, (char *)buf + total_received, nreceiving);
-        if (!nreceived) {
+        // closed by the client (or reset)
+        if (nreceived <= 0) {
             if (!total_received) {
                 return -1; // to handle it
             }
@@ -365,13 +365,18 @@ int main(int argc, char *argv[]) {
         LOG(logINFOBLUE, ("Stop Server Ready...\n\n"));
     }
 
-    // waits for connection
+    // waits for connection (or command on a connection kept open by a
+    // client)
     int retval = OK;
     while (retval != GOODBYE && retval != REBOOT) {
         int fd = acceptConnection(sockfd);
         if (fd > 0) {
             retval = decode_function(fd);
-            closeConnection(fd);
+            // closed by the client, or arguments of a failed command might
+            // not have been read
+            if (retval != OK) {
+                closeConnection(fd);
+            }
         }
     }
 
@@ -13,8 +13,11 @@
 #endif
 
 #include <arpa/inet.h>
+#include <errno.h>
 #include <pthread.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/socket.h>
 #include <sys/sysinfo.h>
 #include <unistd.h>
 
@@ -488,6 +491,7 @@ void function_table() {
     flist[F_SET_COLUMN] = &set_column;
     flist[F_GET_PEDESTAL_MODE] = &get_pedestal_mode;
     flist[F_SET_PEDESTAL_MODE] = &set_pedestal_mode;
+    flist[F_EXEC_COMMAND_BATCH] = &exec_command_batch;
 
     // check
     if (NUM_DET_FUNCTIONS >= RECEIVER_ENUM_START) {
@@ -10895,3 +10899,168 @@ int set_pedestal_mode(int file_des) {
 #endif
     return Server_SendResult(file_des, INT32, NULL, 0);
 }
+
+int executeBatchCommand(struct batchCommand *command, char *reply,
+                        int *replySize, int *result) {
+    // the command gets its own connection, so that its function reads the
+    // arguments and sends the reply as usual
+    int sv[2] = {-1, -1};
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) {
+        ret = FAIL;
+        sprintf(mess,
+                "Could not execute command batch. Could not create socket "
+                "pair: %s\n",
+                strerror(errno));
+        LOG(logERROR, (mess));
+        return FAIL;
+    }
+    int cmdFnum = command->fnum;
+    sendData(sv[0], &cmdFnum, sizeof(cmdFnum), INT32);
+    sendDataOnly(sv[0], command->args, command->argsSize);
+    // function reads end of file instead of waiting for missing arguments
+    shutdown(sv[0], SHUT_WR);
+
+    if (command->fnum == F_EXEC_COMMAND_BATCH) {
+        ret = FAIL;
+        strcpy(mess, "Cannot execute a command batch within a batch\n");
+        LOG(logERROR, (mess));
+        *result = Server_SendResult(sv[1], INT32, NULL, 0);
+    } else {
+        *result = decode_function(sv[1]);
+    }
+    shutdown(sv[1], SHUT_WR);
+
+    // reply as sent by the function: result, then error message or return
+    // value (a failed function might also send its return value, dropped)
+    int size = sizeof(int) + MAX_STR_LENGTH + command->retvalSize;
+    memset(reply + *replySize, 0, size);
+    int n = receiveDataOnly(sv[0], reply + *replySize, size);
+    if (*result == OK) {
+        size = sizeof(int) + command->retvalSize;
+    } else if (*result == FAIL) {
+        size = sizeof(int) + MAX_STR_LENGTH;
+    } else {
+        // goodbye or reboot, the last command of the batch
+        size = (n > 0) ? n : 0;
+    }
+    *replySize += size;
+    close(sv[0]);
+    close(sv[1]);
+    return OK;
+}
+
+int exec_command_batch(int file_des) {
+    ret = OK;
+    memset(mess, 0, sizeof(mess));
+    int ncommands = 0;
+
+    if (receiveData(file_des, &ncommands, sizeof(ncommands), INT32) < 0)
+        return printSocketReadError();
+    LOG(logDEBUG1, ("Executing command batch of %d commands\n", ncommands));
+
+    if (ncommands <= 0 || ncommands > MAX_BATCH_COMMANDS) {
+        ret = FAIL;
+        sprintf(mess,
+                "Could not execute command batch. Invalid number of commands "
+                "%d. Options: [1 - %d]\n",
+                ncommands, MAX_BATCH_COMMANDS);
+        LOG(logERROR, (mess));
+        return Server_SendResult(file_des, INT32, NULL, 0);
+    }
+
+    // read all the commands first, so that the connection stays in sync when
+    // one of them fails
+    struct batchCommand *commands =
+        calloc(ncommands, sizeof(struct batchCommand));
+    if (commands == NULL) {
+        ret = FAIL;
+        strcpy(mess, "Could not execute command batch. Could not allocate "
+                     "memory\n");
+        LOG(logERROR, (mess));
+        return Server_SendResult(file_des, INT32, NULL, 0);
+    }
+    int replyCapacity = MAX_STR_LENGTH;
+    for (int i = 0; i < ncommands; ++i) {
+        struct batchCommand *command = &commands[i];
+        if (receiveData(file_des, &command->fnum, sizeof(command->fnum),
+                        INT32) < 0 ||
+            receiveData(file_des, &command->argsSize,
+                        sizeof(command->argsSize), INT32) < 0 ||
+            receiveData(file_des, &command->retvalSize,
+                        sizeof(command->retvalSize), INT32) < 0) {
+            ret = printSocketReadError();
+            break;
+        }
+        if (command->argsSize < 0 || command->argsSize > MAX_BATCH_ARGS_SIZE ||
+            command->retvalSize < 0 ||
+            command->retvalSize > MAX_BATCH_ARGS_SIZE) {
+            ret = FAIL;
+            sprintf(mess,
+                    "Could not execute command batch. Invalid argument size "
+                    "%d or return value size %d of command %d. Max: %d\n",
+                    command->argsSize, command->retvalSize, i,
+                    MAX_BATCH_ARGS_SIZE);
+            LOG(logERROR, (mess));
+            break;
+        }
+        if (command->argsSize > 0) {
+            command->args = malloc(command->argsSize);
+            if (command->args == NULL) {
+                ret = FAIL;
+                strcpy(mess, "Could not execute command batch. Could not "
+                             "allocate memory\n");
+                LOG(logERROR, (mess));
+                break;
+            }
+            if (receiveData(file_des, command->args, command->argsSize,
+                            OTHER) < 0) {
+                ret = printSocketReadError();
+                break;
+            }
+        }
+        replyCapacity += sizeof(int) + command->retvalSize;
+    }
+
+    char *reply = NULL;
+    int replySize = 0;
+    if (ret == OK) {
+        reply = malloc(replyCapacity);
+        if (reply == NULL) {
+            ret = FAIL;
+            strcpy(mess, "Could not execute command batch. Could not "
+                         "allocate memory\n");
+            LOG(logERROR, (mess));
+        }
+    }
+
+    // stop at the first failed command, like commands sent one by one
+    int result = OK;
+    if (ret == OK) {
+        for (int i = 0; i < ncommands && result == OK; ++i) {
+            if (executeBatchCommand(&commands[i], reply, &replySize,
+                                    &result) == FAIL) {
+                break;
+            }
+            // result of the command is in its reply
+            ret = OK;
+        }
+    }
+    LOG(logDEBUG1, ("Command batch executed [reply size: %d, result: %d]\n",
+                    replySize, result));
+
+    for (int i = 0; i < ncommands; ++i) {
+        free(commands[i].args);
+    }
+    free(commands);
+
+    Server_SendResult(file_des, INT32, NULL, 0);
+    if (ret == OK) {
+        sendDataOnly(file_des, reply, replySize);
+    }
+    free(reply);
+    if (ret == FAIL) {
+        return FAIL;
+    }
+    // exit or reboot after the reply
+    return (result == GOODBYE || result == REBOOT) ? result : OK;
+}
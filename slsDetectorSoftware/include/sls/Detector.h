@@ -57,6 +57,9 @@ class Detector {
     /** Shared memory not freed prior. Set up per measurement. */
     void loadParameters(const std::string &fname);
 
+    /** Lines applied in order, consecutive module specific lines (eg.
+     * 0:udp_dstport) of different modules in parallel. Logs the load time
+     * and the slowest lines (every line in debug) */
     void loadParameters(const std::vector<std::string> &parameters);
 
     Result<std::string> getHostname(Positions pos = {}) const;
@@ -71,6 +74,16 @@ class Detector {
     /** Gets shared memory ID */
     int getShmId() const;
 
+    bool getPersistentConnections() const;
+
+    /**
+     * Keep one tcp connection per module to the control server, stop server
+     * and receiver open between commands of this process instead of one
+     * connection per command (eg. at the top of a config file). Connections
+     * are reopened if closed by the server. Default is disabled.
+     */
+    void setPersistentConnections(const bool enable);
+
     /** package git branch */
     std::string getPackageVersion() const;
 
@@ -921,6 +934,31 @@ class Detector {
     /** Number of frames in fifo between udp listening and processing threads */
     void setRxFifoDepth(int nframes, Positions pos = {});
 
+    /** Huge page size in MB the receiver fifo actually got, 0 for normal
+     * pages */
+    Result<int> getRxFifoHugePageSize(Positions pos = {}) const;
+
+    /** Allocate receiver fifo from huge pages of this size in MB. Options: 0
+     * (normal pages, default), 2, 1024. Falls back to normal pages if none
+     * are reserved (/proc/sys/vm/nr_hugepages). */
+    void setRxFifoHugePageSize(int size_mb, Positions pos = {});
+
+    /** Numa node the receiver fifo memory is actually bound to, -1 if not
+     * bound */
+    Result<int> getRxFifoNumaNode(Positions pos = {}) const;
+
+    /** Numa node to allocate receiver fifo memory on. -1 (default) uses the
+     * node of the rx_udpip interface. */
+    void setRxFifoNumaNode(int node, Positions pos = {});
+
+    Result<int> getRxProcessingThreads(Positions pos = {}) const;
+
+    /** Number of threads processing (padding, roi, call backs) the images of
+     * each udp port in parallel. Default is 1. Max value is 64. Images are
+     * still written to file and streamed in order. Data call backs must be
+     * thread safe for more than 1. */
+    void setRxProcessingThreads(int n, Positions pos = {});
+
     Result<bool> getRxSilentMode(Positions pos = {}) const;
 
     /** Switch on or off receiver text output during acquisition */
@@ -954,6 +992,24 @@ class Detector {
      */
     Result<int> getRxRealUDPSocketBufferSize(Positions pos = {}) const;
 
+    Result<int> getRxUDPBatchSize(Positions pos = {}) const;
+
+    /** Number of udp packets received per system call (recvmmsg) in
+     * receiver. Default is 1. Max value is 1024. Larger values reduce system
+     * calls and packet loss at high frame rates. */
+    void setRxUDPBatchSize(int n_packets, Positions pos = {});
+
+    Result<defs::socketBackend> getRxSocketBackend(Positions pos = {}) const;
+
+    /**
+     * Options: UDP_SOCKET, PACKET_MMAP
+     * Default: UDP_SOCKET
+     * PACKET_MMAP reads packets from a memory mapped kernel ring on
+     * rx_udpip interface instead of copying them out of the udp socket.
+     * Needs CAP_NET_RAW and jumbo frames, otherwise falls back to UDP_SOCKET
+     */
+    void setRxSocketBackend(defs::socketBackend backend, Positions pos = {});
+
     Result<bool> getRxLock(Positions pos = {});
 
     /** Lock receiver to one client IP, 1 locks, 0 unlocks. Default is unlocked.
@@ -971,6 +1027,18 @@ class Detector {
     Result<std::array<pid_t, NUM_RX_THREAD_IDS>>
     getRxThreadIds(Positions pos = {}) const;
 
+    /** Get cpus the receiver threads run on in order of [tcp, listener 0,
+     * processor 0, streamer 0, listener 1, processor 1, streamer 1], '-' for
+     * a thread that does not exist. */
+    Result<std::string> getRxThreadCpus(Positions pos = {}) const;
+
+    /** Pin receiver threads to cpus. Space separated cpu lists (eg. "2 3
+     * 4-7") in the order above, '-' or missing for all cpus of the
+     * receiver process (default). "auto" pins the listeners to cpus local
+     * to the udp interface but not handling its interrupts and the other
+     * threads to the remaining local cpus. */
+    void setRxThreadCpus(const std::string &cpus, Positions pos = {});
+
     Result<bool> getRxArping(Positions pos = {}) const;
 
     /** Starts a thread in slsReceiver to arping the interface it is listening
@@ -999,7 +1067,9 @@ class Detector {
     Result<defs::fileFormat> getFileFormat(Positions pos = {}) const;
 
     /** default binary, Options: BINARY, HDF5 (library must be compiled with
-     * this option) */
+     * this option). With hdf5 >= 1.12, the image data of all ports is written
+     * in one hdf5 lib mutex, which limits the rate of multi port receivers.
+     * Ports write in parallel only with hdf5 1.10 or 1.11. */
     void setFileFormat(defs::fileFormat f, Positions pos = {});
 
     Result<std::string> getFilePath(Positions pos = {}) const;
@@ -1043,6 +1113,42 @@ class Detector {
     /** Default depends on detector type. \n 0 will set frames per file in an
      * acquisition to unlimited */
     void setFramesPerFile(int n, Positions pos = {});
+
+    Result<defs::writeEngine> getRxWriteEngine(Positions pos = {}) const;
+
+    /**
+     * Options: IO_THREAD, IO_URING
+     * Default: IO_THREAD
+     * How the receiver writes binary files. IO_THREAD copies frames into
+     * large buffers written with O_DIRECT by an io thread. IO_URING writes
+     * frames that are not streamed directly from the fifo with io_uring
+     * (kernel >= 5.6), otherwise falls back to IO_THREAD. Not for hdf5 files,
+     * their chunks are written with blocking pwrite by the processing (or
+     * compression) threads of each port.
+     */
+    void setRxWriteEngine(defs::writeEngine engine, Positions pos = {});
+
+    Result<defs::fileCompression>
+    getRxFileCompression(Positions pos = {}) const;
+
+    /**
+     * Options: NO_COMPRESSION, SHUFFLE_DEFLATE
+     * Default: NO_COMPRESSION
+     * Compression of the image datasets of hdf5 files. SHUFFLE_DEFLATE
+     * applies the hdf5 shuffle and deflate (level 1) filters, compressed in
+     * parallel in the receiver. Deflate is the only codec (no bitshuffle,
+     * lz4 or zstd), so that files are readable by any hdf5 library without
+     * filter plugins.
+     */
+    void setRxFileCompression(defs::fileCompression compression,
+                              Positions pos = {});
+
+    Result<int> getRxCompressionThreads(Positions pos = {}) const;
+
+    /** Number of threads compressing the hdf5 chunks (rx_compression) and
+     * the streamed images (rx_zmqcompression) of each udp port in parallel.
+     * Default is 4. Max value is 64. */
+    void setRxCompressionThreads(int n, Positions pos = {});
     ///@}
 
     /** @name ZMQ Streaming Parameters (Receiver<->Client) */
@@ -1151,6 +1257,62 @@ class Detector {
      */
     void setRxZmqHwm(const int limit);
 
+    Result<defs::fileCompression>
+    getRxZmqCompression(Positions pos = {}) const;
+
+    /**
+     * Options: NO_COMPRESSION, SHUFFLE_DEFLATE
+     * Default: NO_COMPRESSION
+     * Compression of the image data streamed out of the receiver, in parallel
+     * in the receiver. SHUFFLE_DEFLATE (the hdf5 shuffle, then deflate) is
+     * the only codec, there is no lz4 or zstd. It saves network bandwidth for
+     * images that compress well, at the cost of receiver cpu and latency, and
+     * is not meant for the full rate of fast detectors. The codec is
+     * announced in the zmq header and the client decompresses transparently.
+     * Images that do not compress are sent as they are.
+     */
+    void setRxZmqCompression(defs::fileCompression compression,
+                             Positions pos = {});
+
+    Result<int> getRxZmqCompressionLevel(Positions pos = {}) const;
+
+    /** Deflate level of the streaming compression [1-9]. Default is 1
+     * (fastest) */
+    void setRxZmqCompressionLevel(int level, Positions pos = {});
+
+    Result<defs::zmqHeaderFormat> getRxZmqHeaderFormat(Positions pos = {}) const;
+
+    /**
+     * Options: JSON_HEADER, BINARY_HEADER
+     * Default: JSON_HEADER
+     * Format of the zmq headers streamed out of the receiver. BINARY_HEADER
+     * is a packed struct (zmqBinaryHeader) that is faster to create and
+     * parse. The client (ZmqSocket) detects the format of each header, other
+     * clients might only read json.
+     */
+    void setRxZmqHeaderFormat(defs::zmqHeaderFormat format,
+                              Positions pos = {});
+
+    Result<defs::zmqStreamingPolicy> getRxZmqPolicy(Positions pos = {}) const;
+
+    /**
+     * Options: BLOCK_ON_FULL, DROP_NEWEST, DROP_OLDEST, KEEP_LATEST
+     * Default: BLOCK_ON_FULL
+     * What the receiver streams when a client is too slow and its zmq send
+     * queue (a quarter of the fifo) is full. BLOCK_ON_FULL waits, which can
+     * take all fifo buffers and cause packet loss also for file writing. The
+     * others drop images: the new ones, the oldest ones waiting or all but
+     * the latest, so that file writing is not affected. The receiver logs
+     * when it drops images.
+     */
+    void setRxZmqPolicy(defs::zmqStreamingPolicy policy, Positions pos = {});
+
+    /** Images streamed and dropped and their latency in the receiver (from
+     * the fifo until zmq released them) for each port, since the start of the
+     * acquisition. Empty if not streaming. */
+    Result<std::vector<defs::streamingStatistics>>
+    getRxZmqStatistics(Positions pos = {}) const;
+
     ///@}
 
     /** @name Eiger Specific */
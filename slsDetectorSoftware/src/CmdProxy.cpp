@@ -79,6 +79,15 @@ std::vector<std::string> CmdProxy::GetProxyCommands() {
     return commands;
 }
 
+const std::set<std::string> &CmdProxy::GetDetectorWideCommands() {
+    static const std::set<std::string> commands{
+        "hostname", "virtual",       "rx_hostname", "rx_tcpport",
+        "port",     "numinterfaces", "vetostream",  "zmqport",
+        "zmqip",    "config",        "parameters",  "free",
+        "detsize"};
+    return commands;
+}
+
 std::map<std::string, std::string> CmdProxy::GetDepreciatedCommands() {
     return depreciated_functions;
 }
@@ -205,6 +214,41 @@ std::string CmdProxy::VirtualServer(int action) {
     return os.str();
 }
 
+std::string CmdProxy::PersistentConnections(int action) {
+    std::ostringstream os;
+    os << cmd << ' ';
+    if (action == defs::HELP_ACTION) {
+        os << "[0, 1]\n\tKeep one tcp connection per module to the control "
+              "server, stop server and receiver open between commands of "
+              "this process instead of one connection per command. Put it at "
+              "the top of a config file to load it faster. Default is 0."
+           << '\n';
+    } else if (action == defs::GET_ACTION) {
+        if (det_id != -1) {
+            throw RuntimeError("Cannot get persistent connections at module "
+                               "level");
+        }
+        if (!args.empty()) {
+            WrongNumberOfParameters(0);
+        }
+        auto t = det->getPersistentConnections();
+        os << t << '\n';
+    } else if (action == defs::PUT_ACTION) {
+        if (det_id != -1) {
+            throw RuntimeError("Cannot set persistent connections at module "
+                               "level");
+        }
+        if (args.size() != 1) {
+            WrongNumberOfParameters(1);
+        }
+        det->setPersistentConnections(StringTo<int>(args[0]));
+        os << args.front() << '\n';
+    } else {
+        throw RuntimeError("Unknown action");
+    }
+    return os.str();
+}
+
 std::string CmdProxy::Acquire(int action) {
     std::ostringstream os;
     if (action == defs::HELP_ACTION) {
@@ -1823,6 +1867,41 @@ std::string CmdProxy::ReceiverHostname(int action) {
     return os.str();
 }
 
+std::string CmdProxy::ReceiverThreadCpus(int action) {
+    std::ostringstream os;
+    os << cmd << ' ';
+    if (action == defs::HELP_ACTION) {
+        os << "[auto] or [tcp] [listener 0] [processor 0] [streamer 0] "
+              "[listener 1] [processor 1] [streamer 1]\n\tCpus the receiver "
+              "threads are pinned to, each as cpu list (eg. 2 or 4-7,9). '-' "
+              "or missing for all cpus of the receiver process "
+              "(default).\n\tauto pins the listeners to cpus local to the udp "
+              "interface but not handling its interrupts and the other "
+              "threads to the remaining local cpus.\n\tGet gives the cpus "
+              "the threads are running on, '-' if the thread does not exist."
+           << '\n';
+    } else if (action == defs::GET_ACTION) {
+        if (!args.empty()) {
+            WrongNumberOfParameters(0);
+        }
+        auto t = det->getRxThreadCpus(std::vector<int>{det_id});
+        os << OutString(t) << '\n';
+    } else if (action == defs::PUT_ACTION) {
+        if (args.empty()) {
+            WrongNumberOfParameters(1);
+        }
+        std::string cpus;
+        for (const auto &arg : args) {
+            cpus += (cpus.empty() ? "" : " ") + arg;
+        }
+        det->setRxThreadCpus(cpus, std::vector<int>{det_id});
+        os << cpus << '\n';
+    } else {
+        throw RuntimeError("Unknown action");
+    }
+    return os.str();
+}
+
 std::string CmdProxy::Rx_ROI(int action) {
     std::ostringstream os;
     os << cmd << ' ';
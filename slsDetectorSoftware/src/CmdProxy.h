@@ -8,6 +8,7 @@
 #include "sls/sls_detector_exceptions.h"
 #include <iostream>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -736,6 +737,10 @@ class CmdProxy {
     size_t GetFunctionMapSize() const noexcept { return functions.size(); };
     std::vector<std::string> GetProxyCommands();
     std::map<std::string, std::string> GetDepreciatedCommands();
+    /** commands that, also for a single module, read other modules or change
+     * detector wide state (eg. unique control and receiver host and port,
+     * client zmq sockets rebuilt for the number of udp interfaces) */
+    static const std::set<std::string> &GetDetectorWideCommands();
 
   private:
     Detector *det;
@@ -965,6 +970,7 @@ class CmdProxy {
         {"parameters", &CmdProxy::parameters},
         {"hostname", &CmdProxy::Hostname},
         {"virtual", &CmdProxy::VirtualServer},
+        {"persistentconnections", &CmdProxy::PersistentConnections},
         {"versions", &CmdProxy::Versions},
         {"packageversion", &CmdProxy::PackageVersion},
         {"clientversion", &CmdProxy::ClientVersion},
@@ -1124,14 +1130,20 @@ class CmdProxy {
         {"rx_hostname", &CmdProxy::ReceiverHostname},
         {"rx_tcpport", &CmdProxy::rx_tcpport},
         {"rx_fifodepth", &CmdProxy::rx_fifodepth},
+        {"rx_fifohugepage", &CmdProxy::rx_fifohugepage},
+        {"rx_fifonumanode", &CmdProxy::rx_fifonumanode},
+        {"rx_processingthreads", &CmdProxy::rx_processingthreads},
         {"rx_silent", &CmdProxy::rx_silent},
         {"rx_discardpolicy", &CmdProxy::rx_discardpolicy},
         {"rx_padding", &CmdProxy::rx_padding},
         {"rx_udpsocksize", &CmdProxy::rx_udpsocksize},
         {"rx_realudpsocksize", &CmdProxy::rx_realudpsocksize},
+        {"rx_udpbatchsize", &CmdProxy::rx_udpbatchsize},
+        {"rx_socketbackend", &CmdProxy::rx_socketbackend},
         {"rx_lock", &CmdProxy::rx_lock},
         {"rx_lastclient", &CmdProxy::rx_lastclient},
         {"rx_threads", &CmdProxy::rx_threads},
+        {"rx_cpus", &CmdProxy::ReceiverThreadCpus},
         {"rx_arping", &CmdProxy::rx_arping},
         {"rx_roi", &CmdProxy::Rx_ROI},
         {"rx_clearroi", &CmdProxy::rx_clearroi},
@@ -1145,6 +1157,9 @@ class CmdProxy {
         {"fmaster", &CmdProxy::fmaster},
         {"foverwrite", &CmdProxy::foverwrite},
         {"rx_framesperfile", &CmdProxy::rx_framesperfile},
+        {"rx_writeengine", &CmdProxy::rx_writeengine},
+        {"rx_compression", &CmdProxy::rx_compression},
+        {"rx_compressionthreads", &CmdProxy::rx_compressionthreads},
 
         /* ZMQ Streaming Parameters (Receiver<->Client) */
         {"rx_zmqstream", &CmdProxy::rx_zmqstream},
@@ -1156,6 +1171,11 @@ class CmdProxy {
         {"zmqip", &CmdProxy::zmqip},
         {"zmqhwm", &CmdProxy::ZMQHWM},
         {"rx_zmqhwm", &CmdProxy::rx_zmqhwm},
+        {"rx_zmqcompression", &CmdProxy::rx_zmqcompression},
+        {"rx_zmqcomplevel", &CmdProxy::rx_zmqcomplevel},
+        {"rx_zmqheader", &CmdProxy::rx_zmqheader},
+        {"rx_zmqpolicy", &CmdProxy::rx_zmqpolicy},
+        {"rx_zmqstats", &CmdProxy::rx_zmqstats},
 
         /* Eiger Specific */
         {"blockingtrigger", &CmdProxy::Trigger},
@@ -1339,6 +1359,7 @@ class CmdProxy {
     // std::string config2(int action);
     std::string Hostname(int action);
     std::string VirtualServer(int action);
+    std::string PersistentConnections(int action);
     std::string FirmwareVersion(int action);
     std::string Versions(int action);
     std::string PackageVersion(int action);
@@ -1387,6 +1408,7 @@ class CmdProxy {
     std::string TransmissionDelay(int action);
     /* Receiver Config */
     std::string ReceiverHostname(int action);
+    std::string ReceiverThreadCpus(int action);
     std::string Rx_ROI(int action);
     /* File */
     /* ZMQ Streaming Parameters (Receiver<->Client) */
@@ -2054,6 +2076,28 @@ class CmdProxy {
         "[n_frames]\n\tSet the number of frames in the receiver "
         "fifo depth (buffer between listener and writer threads).");
 
+    INTEGER_COMMAND_VEC_ID(
+        rx_fifohugepage, getRxFifoHugePageSize, setRxFifoHugePageSize,
+        StringTo<int>,
+        "[0 (default)|2|1024]\n\tAllocate the receiver fifo from huge pages "
+        "of this size in MB. 0 uses normal pages. Falls back to normal pages "
+        "if none are reserved (/proc/sys/vm/nr_hugepages). Get returns the "
+        "page size actually used.");
+
+    INTEGER_COMMAND_VEC_ID(
+        rx_fifonumanode, getRxFifoNumaNode, setRxFifoNumaNode, StringTo<int>,
+        "[-1 (default)|node]\n\tNuma node to allocate the receiver fifo "
+        "memory on. -1 uses the node of the rx_udpip interface. Get returns "
+        "the node actually bound to, -1 if none.");
+
+    INTEGER_COMMAND_VEC_ID(
+        rx_processingthreads, getRxProcessingThreads, setRxProcessingThreads,
+        StringTo<int>,
+        "[n_threads]\n\tNumber of threads processing (padding, roi, call "
+        "backs) the images of each udp port in parallel. Default is 1. Max "
+        "value is 64. Images are still written and streamed in order. Data "
+        "call backs must be thread safe for more than 1.");
+
     INTEGER_COMMAND_VEC_ID(rx_silent, getRxSilentMode, setRxSilentMode,
                            StringTo<int>,
                            "[0, 1]\n\tSwitch on or off receiver text "
@@ -2082,6 +2126,21 @@ class CmdProxy {
                 "\n\tActual udp socket buffer size. Double the size of "
                 "rx_udpsocksize due to kernel bookkeeping.");
 
+    INTEGER_COMMAND_VEC_ID(
+        rx_udpbatchsize, getRxUDPBatchSize, setRxUDPBatchSize, StringTo<int>,
+        "[n_packets]\n\tNumber of udp packets received per system call in "
+        "receiver. Default is 1. Max value is 1024. Larger values reduce "
+        "system calls and packet loss at high frame rates.");
+
+    INTEGER_COMMAND_VEC_ID(
+        rx_socketbackend, getRxSocketBackend, setRxSocketBackend,
+        StringTo<slsDetectorDefs::socketBackend>,
+        "[socket (default)|packetmmap]\n\tHow the receiver reads udp packets. "
+        "packetmmap reads them from a memory mapped kernel ring on the "
+        "rx_udpip interface instead of copying them out of the udp socket. "
+        "Needs CAP_NET_RAW and jumbo frames (unfragmented packets), otherwise "
+        "the receiver falls back to socket.");
+
     INTEGER_COMMAND_VEC_ID(rx_lock, getRxLock, setRxLock, StringTo<int>,
                            "[0, 1]\n\tLock receiver to one client IP, 1 locks, "
                            "0 unlocks. Default is unlocked.");
@@ -2112,7 +2171,10 @@ class CmdProxy {
         fformat, getFileFormat, setFileFormat,
         StringTo<slsDetectorDefs::fileFormat>,
         "[binary|hdf5]\n\tFile format of data file. For "
-        "HDF5, package must be compiled with HDF5 flags. Default is binary.");
+        "HDF5, package must be compiled with HDF5 flags. Default is binary. "
+        "With hdf5 >= 1.12, the image data of all ports is written in one "
+        "hdf5 lib mutex, which limits the rate of multi port receivers. Ports "
+        "write in parallel only with hdf5 1.10 or 1.11.");
 
     STRING_COMMAND(fpath, getFilePath, setFilePath,
                    "[path]\n\tDirectory where output data files are written in "
@@ -2147,6 +2209,33 @@ class CmdProxy {
         "all "
         "frames in single file.");
 
+    INTEGER_COMMAND_VEC_ID(
+        rx_writeengine, getRxWriteEngine, setRxWriteEngine,
+        StringTo<slsDetectorDefs::writeEngine>,
+        "[iothread (default)|iouring]\n\tHow the receiver writes binary "
+        "files. iothread copies frames into large buffers written with "
+        "O_DIRECT by an io thread. iouring writes frames that are not "
+        "streamed directly from the fifo with io_uring (kernel >= 5.6), "
+        "otherwise falls back to iothread. Not for hdf5 files, their chunks "
+        "are written with blocking pwrite by the processing (or "
+        "rx_compressionthreads) threads of each port.");
+
+    INTEGER_COMMAND_VEC_ID(
+        rx_compression, getRxFileCompression, setRxFileCompression,
+        StringTo<slsDetectorDefs::fileCompression>,
+        "[none (default)|shuffledeflate]\n\tCompression of the image "
+        "datasets of hdf5 files. shuffledeflate applies the hdf5 shuffle and "
+        "deflate (level 1) filters, compressed in parallel in the receiver. "
+        "Deflate is the only codec (no bitshuffle, lz4 or zstd), so that "
+        "files are readable by any hdf5 library without filter plugins.");
+
+    INTEGER_COMMAND_VEC_ID(
+        rx_compressionthreads, getRxCompressionThreads,
+        setRxCompressionThreads, StringTo<int>,
+        "[n_threads]\n\tNumber of threads compressing the hdf5 chunks "
+        "(rx_compression) and the streamed images (rx_zmqcompression) of "
+        "each udp port in parallel. Default is 4. Max value is 64.");
+
     /* ZMQ Streaming Parameters (Receiver<->Client) */
 
     INTEGER_COMMAND_VEC_ID(
@@ -2215,6 +2304,48 @@ class CmdProxy {
         "receiver zmq streaming if enabled. Can set to -1 to set default "
         "value.");
 
+    INTEGER_COMMAND_VEC_ID(
+        rx_zmqcompression, getRxZmqCompression, setRxZmqCompression,
+        StringTo<slsDetectorDefs::fileCompression>,
+        "[none (default)|shuffledeflate]\n\tCompression of the image data "
+        "streamed out of the receiver. shuffledeflate (the hdf5 shuffle, then "
+        "deflate) is the only codec, there is no lz4 or zstd. It saves "
+        "network bandwidth for images that compress well, at the cost of "
+        "receiver cpu (rx_compressionthreads) and latency, and is not meant "
+        "for the full rate of fast detectors. The codec is in the zmq header "
+        "and the client decompresses transparently. Images that do not "
+        "compress are sent as they are.");
+
+    INTEGER_COMMAND_VEC_ID(
+        rx_zmqcomplevel, getRxZmqCompressionLevel, setRxZmqCompressionLevel,
+        StringTo<int>,
+        "[1-9]\n\tDeflate level of rx_zmqcompression. Default is 1 "
+        "(fastest).");
+
+    INTEGER_COMMAND_VEC_ID(
+        rx_zmqheader, getRxZmqHeaderFormat, setRxZmqHeaderFormat,
+        StringTo<slsDetectorDefs::zmqHeaderFormat>,
+        "[json (default)|binary]\n\tFormat of the zmq headers streamed out "
+        "of the receiver. binary is a packed struct that is faster to create "
+        "and parse. The client detects the format, other zmq clients might "
+        "only read json.");
+
+    INTEGER_COMMAND_VEC_ID(
+        rx_zmqpolicy, getRxZmqPolicy, setRxZmqPolicy,
+        StringTo<slsDetectorDefs::zmqStreamingPolicy>,
+        "[block (default)|dropnewest|dropoldest|keeplatest]\n\tWhat the "
+        "receiver streams when a client is too slow and its zmq send queue (a "
+        "quarter of the fifo) is full. block waits, which can take all fifo "
+        "buffers and cause packet loss also for file writing. The others drop "
+        "the new images, the oldest waiting or all but the latest, so that "
+        "file writing is not affected. The receiver logs when it drops "
+        "images.");
+
+    GET_COMMAND(rx_zmqstats, getRxZmqStatistics,
+                "\n\tImages streamed and dropped and their latency in the "
+                "receiver (from the fifo until zmq released them) for each "
+                "port, since the start of the acquisition.");
+
     /* Eiger Specific */
 
     TIME_COMMAND(subexptime, getSubExptime, setSubExptime,
@@ -16,8 +16,11 @@
 #include "sls/sls_detector_defs.h"
 #include "sls/versionAPI.h"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <fstream>
+#include <map>
 #include <set>
 #include <thread>
 
@@ -66,8 +69,10 @@ void Detector::freeSharedMemory() { pimpl->freeSharedMemory(); }
 
 void Detector::loadConfig(const std::string &fname) {
     int shm_id = getShmId();
+    bool persistentConnections = getPersistentConnections();
     freeSharedMemory();
     pimpl = make_unique<DetectorImpl>(shm_id);
+    pimpl->setPersistentConnections(persistentConnections);
     LOG(logINFO) << "Loading configuration file: " << fname;
     loadParameters(fname);
 }
@@ -91,13 +96,156 @@ void Detector::loadParameters(const std::string &fname) {
 }
 
 void Detector::loadParameters(const std::vector<std::string> &parameters) {
-    CmdProxy proxy(this);
-    CmdParser parser;
-    for (const auto &current_line : parameters) {
-        parser.Parse(current_line);
-        proxy.Call(parser.command(), parser.arguments(), parser.detector_id(),
-                   defs::PUT_ACTION, std::cout, parser.receiver_id());
-    }
+    using clock = std::chrono::steady_clock;
+    struct Parameter {
+        std::string line;
+        CmdParser parser;
+        std::string output;
+        clock::duration elapsed{};
+        std::exception_ptr error;
+    };
+    const auto &detectorWide = CmdProxy::GetDetectorWideCommands();
+
+    auto begin = clock::now();
+    std::vector<Parameter> lines(parameters.size());
+    for (size_t i = 0; i != parameters.size(); ++i) {
+        lines[i].line = parameters[i];
+        lines[i].parser.Parse(parameters[i]);
+    }
+    auto isModuleSpecific = [&detectorWide](const Parameter &p) {
+        return p.parser.detector_id() != -1 &&
+               detectorWide.count(p.parser.command()) == 0;
+    };
+    auto execute = [this](CmdProxy &proxy, Parameter &p) {
+        auto t0 = clock::now();
+        std::ostringstream os;
+        pimpl->setBatchSource(p.line, {p.parser.detector_id()});
+        proxy.Call(p.parser.command(), p.parser.arguments(),
+                   p.parser.detector_id(), defs::PUT_ACTION, os,
+                   p.parser.receiver_id());
+        p.output = os.str();
+        p.elapsed = clock::now() - t0;
+    };
+
+    // output of a line printed (in file order) once its batched commands
+    // are applied, never for those not applied as an earlier command of
+    // their batch failed
+    std::vector<const Parameter *> pending;
+    auto printApplied = [&]() {
+        auto queued = pimpl->getQueuedBatchSources();
+        auto skipped = pimpl->getSkippedBatchSources();
+        auto it = pending.begin();
+        for (; it != pending.end() && queued.count((*it)->line) == 0; ++it) {
+            if (skipped.count((*it)->line) == 0) {
+                std::cout << (*it)->output;
+            } else {
+                LOG(logWARNING) << "Parameter '" << (*it)->line
+                                << "' not applied";
+            }
+        }
+        pending.erase(pending.begin(), it);
+    };
+    auto flush = [&]() {
+        try {
+            pimpl->setBatchCommands(false);
+        } catch (...) {
+            printApplied();
+            throw;
+        }
+        printApplied();
+    };
+
+    // global lines in file order, each a barrier. Runs of consecutive module
+    // specific lines in parallel, in the worker of each module keeping the
+    // order of its lines. First error thrown in file order.
+    auto executeRun = [&](size_t first, size_t last) {
+        std::map<int, std::vector<Parameter *>> perModule;
+        for (size_t i = first; i != last; ++i) {
+            perModule[lines[i].parser.detector_id()].push_back(&lines[i]);
+        }
+        std::vector<int> positions;
+        for (const auto &it : perModule) {
+            positions.push_back(it.first);
+        }
+        std::atomic<bool> failed{false};
+        pimpl->ParallelForModules(positions, [&](int module) {
+            CmdProxy proxy(this);
+            for (auto p : perModule.at(module)) {
+                if (failed) {
+                    return;
+                }
+                try {
+                    execute(proxy, *p);
+                } catch (...) {
+                    p->error = std::current_exception();
+                    failed = true;
+                }
+            }
+        });
+        for (size_t i = first; i != last; ++i) {
+            if (!lines[i].error) {
+                pending.push_back(&lines[i]);
+            }
+        }
+        printApplied();
+        for (size_t i = first; i != last; ++i) {
+            if (lines[i].error) {
+                std::rethrow_exception(lines[i].error);
+            }
+        }
+    };
+
+    // commands without reply sent in one batch per server, errors of them
+    // thrown with their line once sent
+    pimpl->setBatchCommands(true);
+    try {
+        CmdProxy proxy(this);
+        size_t i = 0;
+        while (i != lines.size()) {
+            size_t last = i;
+            while (last != lines.size() && isModuleSpecific(lines[last])) {
+                ++last;
+            }
+            if (last - i > 1) {
+                executeRun(i, last);
+                i = last;
+            } else {
+                execute(proxy, lines[i]);
+                pending.push_back(&lines[i]);
+                printApplied();
+                ++i;
+            }
+        }
+    } catch (...) {
+        // commands of the previous lines still sent (their error first)
+        flush();
+        throw;
+    }
+    auto flushBegin = clock::now();
+    flush();
+    auto flushed = clock::now();
+
+    // batched commands are sent by a later line or at the end, whose time
+    // includes them
+    std::vector<const Parameter *> slowest;
+    for (const auto &p : lines) {
+        LOG(logDEBUG) << "Parameter '" << p.line << "': "
+                      << ToString(p.elapsed);
+        slowest.push_back(&p);
+    }
+    std::sort(slowest.begin(), slowest.end(),
+              [](const Parameter *a, const Parameter *b) {
+                  return a->elapsed > b->elapsed;
+              });
+    std::ostringstream oss;
+    oss << "Loaded " << lines.size() << " parameters in "
+        << ToString(flushed - begin) << " (sending remaining batched commands "
+        << ToString(flushed - flushBegin) << ')';
+    for (size_t i = 0; i != std::min<size_t>(slowest.size(), 3); ++i) {
+        oss << (i == 0 ? ". Slowest: '" : ", '") << slowest[i]->line << "' "
+            << ToString(slowest[i]->elapsed);
+    }
+    LOG(logINFO) << oss.str();
 }
 
 Result<std::string> Detector::getHostname(Positions pos) const {
@@ -116,6 +264,14 @@ void Detector::setVirtualDetectorServers(int numServers,
 
 int Detector::getShmId() const { return pimpl->getDetectorIndex(); }
 
+bool Detector::getPersistentConnections() const {
+    return pimpl->getPersistentConnections();
+}
+
+void Detector::setPersistentConnections(const bool enable) {
+    pimpl->setPersistentConnections(enable);
+}
+
 std::string Detector::getPackageVersion() const { return RELEASE; }
 
 std::string Detector::getClientVersion() const {
@@ -1278,6 +1434,30 @@ void Detector::setRxFifoDepth(int nframes, Positions pos) {
     pimpl->Parallel(&Module::setReceiverFifoDepth, pos, nframes);
 }
 
+Result<int> Detector::getRxFifoHugePageSize(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverFifoHugePageSize, pos);
+}
+
+void Detector::setRxFifoHugePageSize(int size_mb, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverFifoHugePageSize, pos, size_mb);
+}
+
+Result<int> Detector::getRxFifoNumaNode(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverFifoNumaNode, pos);
+}
+
+void Detector::setRxFifoNumaNode(int node, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverFifoNumaNode, pos, node);
+}
+
+Result<int> Detector::getRxProcessingThreads(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverProcessingThreads, pos);
+}
+
+void Detector::setRxProcessingThreads(int n, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverProcessingThreads, pos, n);
+}
+
 Result<bool> Detector::getRxSilentMode(Positions pos) const {
     return pimpl->Parallel(&Module::getReceiverSilentMode, pos);
 }
@@ -1317,6 +1497,22 @@ Result<int> Detector::getRxRealUDPSocketBufferSize(Positions pos) const {
     return pimpl->Parallel(&Module::getReceiverRealUDPSocketBufferSize, pos);
 }
 
+Result<int> Detector::getRxUDPBatchSize(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverUDPBatchSize, pos);
+}
+
+void Detector::setRxUDPBatchSize(int n_packets, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverUDPBatchSize, pos, n_packets);
+}
+
+Result<defs::socketBackend> Detector::getRxSocketBackend(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverSocketBackend, pos);
+}
+
+void Detector::setRxSocketBackend(defs::socketBackend backend, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverSocketBackend, pos, backend);
+}
+
 Result<bool> Detector::getRxLock(Positions pos) {
     return pimpl->Parallel(&Module::getReceiverLock, pos);
 }
@@ -1334,6 +1530,14 @@ Detector::getRxThreadIds(Positions pos) const {
     return pimpl->Parallel(&Module::getReceiverThreadIds, pos);
 }
 
+Result<std::string> Detector::getRxThreadCpus(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverThreadCpus, pos);
+}
+
+void Detector::setRxThreadCpus(const std::string &cpus, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverThreadCpus, pos, cpus);
+}
+
 Result<bool> Detector::getRxArping(Positions pos) const {
     return pimpl->Parallel(&Module::getRxArping, pos);
 }
@@ -1421,6 +1625,32 @@ void Detector::setFramesPerFile(int n, Positions pos) {
     pimpl->Parallel(&Module::setFramesPerFile, pos, n);
 }
 
+Result<defs::writeEngine> Detector::getRxWriteEngine(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverWriteEngine, pos);
+}
+
+void Detector::setRxWriteEngine(defs::writeEngine engine, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverWriteEngine, pos, engine);
+}
+
+Result<defs::fileCompression>
+Detector::getRxFileCompression(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverFileCompression, pos);
+}
+
+void Detector::setRxFileCompression(defs::fileCompression compression,
+                                    Positions pos) {
+    pimpl->Parallel(&Module::setReceiverFileCompression, pos, compression);
+}
+
+Result<int> Detector::getRxCompressionThreads(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverCompressionThreads, pos);
+}
+
+void Detector::setRxCompressionThreads(int n, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverCompressionThreads, pos, n);
+}
+
 // Zmq Streaming (Receiver<->Client)
 
 Result<bool> Detector::getRxZmqDataStream(Positions pos) const {
@@ -1545,6 +1775,48 @@ void Detector::setRxZmqHwm(const int limit) {
     }
 }
 
+Result<defs::fileCompression>
+Detector::getRxZmqCompression(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverStreamingCompression, pos);
+}
+
+void Detector::setRxZmqCompression(defs::fileCompression compression,
+                                   Positions pos) {
+    pimpl->Parallel(&Module::setReceiverStreamingCompression, pos,
+                    compression);
+}
+
+Result<int> Detector::getRxZmqCompressionLevel(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverStreamingCompressionLevel, pos);
+}
+
+void Detector::setRxZmqCompressionLevel(int level, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverStreamingCompressionLevel, pos, level);
+}
+
+Result<defs::zmqHeaderFormat>
+Detector::getRxZmqHeaderFormat(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverStreamingHeaderFormat, pos);
+}
+
+void Detector::setRxZmqHeaderFormat(defs::zmqHeaderFormat format,
+                                    Positions pos) {
+    pimpl->Parallel(&Module::setReceiverStreamingHeaderFormat, pos, format);
+}
+
+Result<defs::zmqStreamingPolicy> Detector::getRxZmqPolicy(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverStreamingPolicy, pos);
+}
+
+void Detector::setRxZmqPolicy(defs::zmqStreamingPolicy policy, Positions pos) {
+    pimpl->Parallel(&Module::setReceiverStreamingPolicy, pos, policy);
+}
+
+Result<std::vector<defs::streamingStatistics>>
+Detector::getRxZmqStatistics(Positions pos) const {
+    return pimpl->Parallel(&Module::getReceiverStreamingStatistics, pos);
+}
+
 // Eiger Specific
 
 Result<ns> Detector::getSubExptime(Positions pos) const {
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: LGPL-3.0-or-other
 // Copyright (C) 2021 Contributors to the SLS Detector Package
 #include "DetectorImpl.h"
+#include "FrameAssembler.h"
 #include "Module.h"
 #include "SharedMemory.h"
 #include "sls/ZmqSocket.h"
@@ -11,11 +12,13 @@
 #include "sls/versionAPI.h"
 
 #include "sls/ToString.h"
+#include "sls/bit_utils.h"
 #include "sls/container_utils.h"
 #include "sls/file_utils.h"
 #include "sls/network_utils.h"
 #include "sls/string_utils.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iomanip>
 #include <iostream>
@@ -27,6 +30,7 @@
 
 #include <chrono>
 #include <future>
+#include <thread>
 #include <vector>
 
 namespace sls {
@@ -90,6 +94,10 @@ void DetectorImpl::freeSharedMemory(int detectorIndex, int detPos) {
 }
 
 void DetectorImpl::freeSharedMemory() {
+    // commands queued for the modules (eg. config before hostname)
+    if (batchCommands && !modules.empty()) {
+        Parallel(&Module::flushCommandBatch, {});
+    }
     zmqSocket.clear();
     for (auto &module : modules) {
         module->freeSharedMemory();
@@ -191,6 +199,8 @@ void DetectorImpl::initializeMembers(bool verify) {
     for (int i = 0; i < shm()->totalNumberOfModules; i++) {
         try {
             modules.push_back(make_unique<Module>(detectorIndex, i, verify));
+            modules.back()->setPersistentConnections(persistentConnections);
+            modules.back()->setBatchCommands(batchCommands);
         } catch (...) {
             modules.clear();
             throw;
@@ -297,6 +307,8 @@ void DetectorImpl::addModule(const std::string &name) {
 
     auto pos = modules.size();
     modules.emplace_back(make_unique<Module>(type, detectorIndex, pos, false));
+    modules[pos]->setPersistentConnections(persistentConnections);
+    modules[pos]->setBatchCommands(batchCommands);
     shm()->totalNumberOfModules = modules.size();
     modules[pos]->setControlPort(port);
     modules[pos]->setStopPort(port + 1);
@@ -396,6 +408,73 @@ void DetectorImpl::setNumberOfChannels(const slsDetectorDefs::xy c) {
     shm()->numberOfChannels = c;
 }
 
+bool DetectorImpl::getPersistentConnections() const {
+    return persistentConnections;
+}
+
+void DetectorImpl::setPersistentConnections(const bool enable) {
+    persistentConnections = enable;
+    for (auto &module : modules) {
+        module->setPersistentConnections(enable);
+    }
+}
+
+void DetectorImpl::setBatchCommands(const bool enable) {
+    batchCommands = enable;
+    // no modules yet or any more (eg. config file freeing shared memory),
+    // later ones get the flag when added
+    if (modules.empty()) {
+        return;
+    }
+    // flushed in parallel when disabled
+    Parallel(&Module::setBatchCommands, {}, enable);
+}
+
+void DetectorImpl::setBatchSource(const std::string &source,
+                                  Positions pos) {
+    // not in parallel, only sets the source
+    if (isAllPositions(pos)) {
+        for (auto &module : modules) {
+            module->setBatchSource(source);
+        }
+    } else {
+        for (auto i : pos) {
+            modules.at(i)->setBatchSource(source);
+        }
+    }
+}
+
+std::set<std::string> DetectorImpl::getQueuedBatchSources() const {
+    std::set<std::string> sources;
+    for (const auto &module : modules) {
+        auto queued = module->getQueuedBatchSources();
+        sources.insert(queued.begin(), queued.end());
+    }
+    return sources;
+}
+
+void DetectorImpl::ParallelForModules(
+    std::vector<int> positions, const std::function<void(int)> &func) const {
+    auto futures = RunInWorkers<void>(positions, [&](Module *m) {
+        auto it = std::find_if(
+            modules.begin(), modules.end(),
+            [m](const std::unique_ptr<Module> &it) { return it.get() == m; });
+        func(static_cast<int>(it - modules.begin()));
+    });
+    for (auto &i : futures) {
+        i.get();
+    }
+}
+
+std::set<std::string> DetectorImpl::getSkippedBatchSources() const {
+    std::set<std::string> sources;
+    for (const auto &module : modules) {
+        auto skipped = module->getSkippedBatchSources();
+        sources.insert(skipped.begin(), skipped.end());
+    }
+    return sources;
+}
+
 bool DetectorImpl::getGapPixelsinCallback() const { return shm()->gapPixels; }
 
 void DetectorImpl::setGapPixelsinCallback(const bool enable) {
@@ -567,221 +646,100 @@ void DetectorImpl::readFrameFromReceiver() {
 
     bool gapPixels = shm()->gapPixels;
     LOG(logDEBUG) << "Gap pixels: " << gapPixels;
-    int nX = 0;
-    int nY = 0;
-    int nDetPixelsX = 0;
-    int nDetPixelsY = 0;
-    bool quadEnable = false;
-    // to flip image
-    bool eiger = false;
     std::array<int, 4> rxRoi = shm()->rx_roi.getIntArray();
 
-    std::vector<bool> runningList(zmqSocket.size());
+    // each socket received in its own thread, frames assembled by frame index
+    FrameAssembler assembler(zmqSocket.size());
     std::vector<bool> connectList(zmqSocket.size());
+    std::vector<std::thread> receivers;
     numZmqRunning = 0;
     for (size_t i = 0; i < zmqSocket.size(); ++i) {
         if (zmqSocket[i]->Connect() == 0) {
             connectList[i] = true;
-            runningList[i] = true;
             ++numZmqRunning;
         } else {
             // to remember the list it connected to, to disconnect later
             connectList[i] = false;
             LOG(logERROR) << "Could not connect to socket  "
                           << zmqSocket[i]->GetZmqServerAddress();
-            runningList[i] = false;
         }
     }
-    bool data = false;
-    bool completeImage = false;
-    std::unique_ptr<char[]> image{nullptr};
-    std::unique_ptr<char[]> multiframe{nullptr};
-    char *multigappixels = nullptr;
-    int multisize = 0;
-    // only first message header
-    uint32_t size = 0, nPixelsX = 0, nPixelsY = 0, dynamicRange = 0;
-    float bytesPerPixel = 0;
-    // header info every header
-    std::string currentFileName;
-    uint64_t currentAcquisitionIndex = -1, currentFrameIndex = -1,
-             currentFileIndex = -1;
-    double currentProgress = 0.00;
-    uint32_t currentSubFrameIndex = -1, coordX = -1, coordY = -1, flipRows = -1;
-
-    while (numZmqRunning != 0) {
-        // reset data
-        data = false;
-        if (multiframe != nullptr) {
-            memset(multiframe.get(), 0xFF, multisize);
-        }
-
-        completeImage = (numZmqRunning == (int)zmqSocket.size());
-
-        // get each frame
-        for (unsigned int isocket = 0; isocket < zmqSocket.size(); ++isocket) {
-
-            // if running
-            if (runningList[isocket]) {
-
-                // HEADER
-                {
-                    zmqHeader zHeader;
-                    if (zmqSocket[isocket]->ReceiveHeader(
-                            isocket, zHeader,
-                            SLS_DETECTOR_JSON_HEADER_VERSION) == 0) {
-                        // parse error, version error or end of acquisition for
-                        // socket
-                        runningList[isocket] = false;
-                        completeImage = false;
-                        --numZmqRunning;
-                        continue;
-                    }
-
-                    // if first message, allocate (all one time stuff)
-                    if (image == nullptr) {
-                        // allocate
-                        size = zHeader.imageSize;
-                        multisize = size * zmqSocket.size();
-                        image = make_unique<char[]>(size);
-                        multiframe = make_unique<char[]>(multisize);
-                        memset(multiframe.get(), 0xFF, multisize);
-                        // dynamic range
-                        dynamicRange = zHeader.dynamicRange;
-                        bytesPerPixel = (float)dynamicRange / 8;
-                        // shape
-                        nPixelsX = zHeader.npixelsx;
-                        nPixelsY = zHeader.npixelsy;
-                        // port geometry
-                        nX = zHeader.ndetx;
-                        nY = zHeader.ndety;
-                        nDetPixelsX = nX * nPixelsX;
-                        nDetPixelsY = nY * nPixelsY;
-                        // det type
-                        eiger = (zHeader.detType == EIGER)
-                                    ? true
-                                    : false; // to be changed to EIGER when
-                                             // firmware updates its header data
-                        quadEnable = (zHeader.quad == 0) ? false : true;
-                        LOG(logDEBUG1)
-                            << "One Time Header Info:"
-                               "\n\tsize: "
-                            << size << "\n\tmultisize: " << multisize
-                            << "\n\tdynamicRange: " << dynamicRange
-                            << "\n\tbytesPerPixel: " << bytesPerPixel
-                            << "\n\tnPixelsX: " << nPixelsX
-                            << "\n\tnPixelsY: " << nPixelsY << "\n\tnX: " << nX
-                            << "\n\tnY: " << nY << "\n\teiger: " << eiger
-                            << "\n\tquadEnable: " << quadEnable;
-                    }
-                    // each time, parse rest of header
-                    currentFileName = zHeader.fname;
-                    currentAcquisitionIndex = zHeader.acqIndex;
-                    currentFrameIndex = zHeader.frameIndex;
-                    currentProgress = zHeader.progress;
-                    currentFileIndex = zHeader.fileIndex;
-                    currentSubFrameIndex = zHeader.expLength;
-                    coordY = zHeader.row;
-                    coordX = zHeader.column;
-                    flipRows = zHeader.flipRows;
-                    if (zHeader.completeImage == 0) {
-                        completeImage = false;
-                    }
-                    LOG(logDEBUG1)
-                        << zmqSocket[isocket]->GetPortNumber() << " "
-                        << "Header Info:"
-                           "\n\tcurrentFileName: "
-                        << currentFileName << "\n\tcurrentAcquisitionIndex: "
-                        << currentAcquisitionIndex
-                        << "\n\tcurrentFrameIndex: " << currentFrameIndex
-                        << "\n\tcurrentFileIndex: " << currentFileIndex
-                        << "\n\tcurrentSubFrameIndex: " << currentSubFrameIndex
-                        << "\n\tcurrentProgress: " << currentProgress
-                        << "\n\tcoordX: " << coordX << "\n\tcoordY: " << coordY
-                        << "\n\tflipRows: " << flipRows
-                        << "\n\tcompleteImage: " << completeImage;
-                }
-
-                // DATA
-                data = true;
-                zmqSocket[isocket]->ReceiveData(isocket, image.get(), size);
-
-                // creating multi image
-                {
-                    uint32_t xoffset = coordX * nPixelsX * bytesPerPixel;
-                    uint32_t yoffset = coordY * nPixelsY;
-                    uint32_t singledetrowoffset = nPixelsX * bytesPerPixel;
-                    uint32_t rowoffset = nX * singledetrowoffset;
-                    if (shm()->detType == CHIPTESTBOARD) {
-                        singledetrowoffset = size;
-                    }
-                    LOG(logDEBUG1)
-                        << "Multi Image Info:"
-                           "\n\txoffset: "
-                        << xoffset << "\n\tyoffset: " << yoffset
-                        << "\n\tsingledetrowoffset: " << singledetrowoffset
-                        << "\n\trowoffset: " << rowoffset;
-
-                    if (eiger && (flipRows != 0U)) {
-                        for (uint32_t i = 0; i < nPixelsY; ++i) {
-                            memcpy((multiframe.get()) +
-                                       ((yoffset + (nPixelsY - 1 - i)) *
-                                        rowoffset) +
-                                       xoffset,
-                                   image.get() + (i * singledetrowoffset),
-                                   singledetrowoffset);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i < nPixelsY; ++i) {
-                            memcpy((multiframe.get()) +
-                                       ((yoffset + i) * rowoffset) + xoffset,
-                                   image.get() + (i * singledetrowoffset),
-                                   singledetrowoffset);
-                        }
-                    }
-                }
-            }
+    for (size_t i = 0; i < zmqSocket.size(); ++i) {
+        if (connectList[i]) {
+            receivers.emplace_back(&DetectorImpl::receiveFrameParts, this, i,
+                                   std::ref(assembler));
+        } else {
+            assembler.Stop(i);
         }
+    }
 
+    char *multigappixels = nullptr;
+    // 12 bit images unpacked for gap pixels
+    std::vector<uint16_t> multiframe16Bit;
+    FrameAssembler::Frame frame;
+    // the next frame assembled meanwhile in the other buffer
+    while (assembler.Next(frame)) {
+        const zmqHeader &zHeader = frame.header;
+        int nDetPixelsX = zHeader.ndetx * zHeader.npixelsx;
+        int nDetPixelsY = zHeader.ndety * zHeader.npixelsy;
+        uint32_t dynamicRange = zHeader.dynamicRange;
+        // to be changed to EIGER when firmware updates its header data
+        bool eiger = (zHeader.detType == EIGER);
+        bool quadEnable = (zHeader.quad != 0);
         LOG(logDEBUG) << "Call Back Info:"
                       << "\n\t nDetPixelsX: " << nDetPixelsX
                       << "\n\t nDetPixelsY: " << nDetPixelsY
-                      << "\n\t databytes: " << multisize
+                      << "\n\t databytes: " << frame.size
                       << "\n\t dynamicRange: " << dynamicRange;
 
         // send data to callback
-        if (data) {
-            char *callbackImage = multiframe.get();
-            int imagesize = multisize;
-            int nDetActualPixelsX = nDetPixelsX;
-            int nDetActualPixelsY = nDetPixelsY;
-
-            if (gapPixels) {
-                int n = insertGapPixels(multiframe.get(), multigappixels,
-                                        quadEnable, dynamicRange,
-                                        nDetActualPixelsX, nDetActualPixelsY);
-                callbackImage = multigappixels;
-                imagesize = n;
+        char *callbackImage = frame.data;
+        int imagesize = frame.size;
+        int nDetActualPixelsX = nDetPixelsX;
+        int nDetActualPixelsY = nDetPixelsY;
+        int callbackDynamicRange = dynamicRange;
+
+        if (gapPixels) {
+            char *gapPixelsSource = frame.data;
+            // gap pixels are interpolated on 16 bit pixels
+            if (dynamicRange == 12) {
+                multiframe16Bit.resize((size_t)nDetPixelsX * nDetPixelsY);
+                unpack12To16Bit(multiframe16Bit.data(), (uint8_t *)frame.data,
+                                multiframe16Bit.size());
+                gapPixelsSource = (char *)multiframe16Bit.data();
+                callbackDynamicRange = 16;
             }
-            LOG(logDEBUG) << "Image Info:"
-                          << "\n\tnDetActualPixelsX: " << nDetActualPixelsX
-                          << "\n\tnDetActualPixelsY: " << nDetActualPixelsY
-                          << "\n\timagesize: " << imagesize
-                          << "\n\tdynamicRange: " << dynamicRange;
-
-            thisData = new detectorData(currentProgress, currentFileName,
-                                        nDetActualPixelsX, nDetActualPixelsY,
-                                        callbackImage, imagesize, dynamicRange,
-                                        currentFileIndex, completeImage, rxRoi);
-            try {
-                dataReady(
-                    thisData, currentFrameIndex,
-                    ((dynamicRange == 32 && eiger) ? currentSubFrameIndex : -1),
-                    pCallbackArg);
-            } catch (const std::exception &e) {
-                LOG(logERROR) << "Exception caught from callback: " << e.what();
-            }
-            delete thisData;
+            int n = insertGapPixels(gapPixelsSource, multigappixels,
+                                    quadEnable, callbackDynamicRange,
+                                    nDetActualPixelsX, nDetActualPixelsY);
+            callbackImage = multigappixels;
+            imagesize = n;
+        }
+        LOG(logDEBUG) << "Image Info:"
+                      << "\n\tnDetActualPixelsX: " << nDetActualPixelsX
+                      << "\n\tnDetActualPixelsY: " << nDetActualPixelsY
+                      << "\n\timagesize: " << imagesize
+                      << "\n\tdynamicRange: " << callbackDynamicRange;
+
+        thisData = new detectorData(zHeader.progress, zHeader.fname,
+                                    nDetActualPixelsX, nDetActualPixelsY,
+                                    callbackImage, imagesize,
+                                    callbackDynamicRange, zHeader.fileIndex,
+                                    frame.complete, rxRoi);
+        try {
+            dataReady(
+                thisData, zHeader.frameIndex,
+                ((dynamicRange == 32 && eiger) ? zHeader.expLength : -1),
+                pCallbackArg);
+        } catch (const std::exception &e) {
+            LOG(logERROR) << "Exception caught from callback: " << e.what();
         }
+        delete thisData;
+        assembler.Release();
+    }
+
+    for (auto &t : receivers) {
+        t.join();
     }
 
     // Disconnect resources
@@ -795,6 +753,84 @@ void DetectorImpl::readFrameFromReceiver() {
     delete[] multigappixels;
 }
 
+void DetectorImpl::receiveFrameParts(size_t isocket,
+                                     FrameAssembler &assembler) {
+    bool ctb = (shm()->detType == CHIPTESTBOARD);
+    std::vector<char> image;
+    zmqHeader zHeader;
+    // image of a later frame, kept for the next round
+    bool pending = false;
+    while (true) {
+        if (!pending) {
+            zHeader = zmqHeader{};
+            if (zmqSocket[isocket]->ReceiveHeader(
+                    isocket, zHeader, SLS_DETECTOR_JSON_HEADER_VERSION) == 0) {
+                // parse error, version error or end of acquisition for
+                // socket
+                assembler.Stop(isocket);
+                --numZmqRunning;
+                return;
+            }
+            LOG(logDEBUG1) << zmqSocket[isocket]->GetPortNumber() << " "
+                           << "Header Info:"
+                              "\n\tcurrentFileName: "
+                           << zHeader.fname
+                           << "\n\tcurrentAcquisitionIndex: "
+                           << zHeader.acqIndex
+                           << "\n\tcurrentFrameIndex: " << zHeader.frameIndex
+                           << "\n\tcurrentFileIndex: " << zHeader.fileIndex
+                           << "\n\tcurrentSubFrameIndex: " << zHeader.expLength
+                           << "\n\tcurrentProgress: " << zHeader.progress
+                           << "\n\tcoordX: " << zHeader.column
+                           << "\n\tcoordY: " << zHeader.row
+                           << "\n\tflipRows: " << zHeader.flipRows
+                           << "\n\tcompleteImage: " << zHeader.completeImage;
+        }
+        char *multiframe = assembler.Arrive(isocket, zHeader);
+        pending = (multiframe == nullptr);
+        if (multiframe != nullptr) {
+            uint32_t size = zHeader.imageSize;
+            float bytesPerPixel = (float)zHeader.dynamicRange / 8;
+            uint32_t nPixelsX = zHeader.npixelsx;
+            uint32_t nPixelsY = zHeader.npixelsy;
+            uint32_t xoffset = zHeader.column * nPixelsX * bytesPerPixel;
+            uint32_t yoffset = zHeader.row * nPixelsY;
+            uint32_t singledetrowoffset = nPixelsX * bytesPerPixel;
+            uint32_t rowoffset = zHeader.ndetx * singledetrowoffset;
+            bool flip = (zHeader.detType == EIGER && zHeader.flipRows != 0);
+            if (ctb) {
+                singledetrowoffset = size;
+            }
+            LOG(logDEBUG1)
+                << "Multi Image Info:"
+                   "\n\txoffset: "
+                << xoffset << "\n\tyoffset: " << yoffset
+                << "\n\tsingledetrowoffset: " << singledetrowoffset
+                << "\n\trowoffset: " << rowoffset;
+
+            if (!ctb && !flip && rowoffset == singledetrowoffset &&
+                nPixelsY * rowoffset == size) {
+                // rows of the socket contiguous in the frame (one socket in
+                // x), received in place
+                zmqSocket[isocket]->ReceiveData(
+                    isocket, multiframe + (yoffset * rowoffset) + xoffset,
+                    size);
+            } else {
+                image.resize(size);
+                zmqSocket[isocket]->ReceiveData(isocket, image.data(), size);
+                for (uint32_t i = 0; i < nPixelsY; ++i) {
+                    uint32_t row = flip ? (nPixelsY - 1 - i) : i;
+                    memcpy(multiframe + ((yoffset + row) * rowoffset) +
+                               xoffset,
+                           image.data() + (i * singledetrowoffset),
+                           singledetrowoffset);
+                }
+            }
+        }
+        assembler.Done(isocket);
+    }
+}
+
 int DetectorImpl::insertGapPixels(char *image, char *&gpImage, bool quadEnable,
                                   int dr, int &nPixelsx, int &nPixelsy) {
 
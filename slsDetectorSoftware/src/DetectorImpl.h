@@ -3,16 +3,20 @@
 #pragma once
 
 #include "CtbConfig.h"
+#include "ModuleWorkers.h"
 #include "SharedMemory.h"
 #include "sls/Result.h"
 #include "sls/logger.h"
 #include "sls/sls_detector_defs.h"
 
+#include <atomic>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <numeric>
 #include <semaphore.h>
+#include <set>
 #include <string>
 #include <thread>
 #include <vector>
@@ -22,6 +26,7 @@ namespace sls {
 class ZmqSocket;
 class detectorData;
 class Module;
+class FrameAssembler;
 
 #define DETECTOR_SHMAPIVERSION 0x190809
 #define DETECTOR_SHMVERSION    0x220505
@@ -89,24 +94,10 @@ class DetectorImpl : public virtual slsDetectorDefs {
     Result<RT> Parallel(RT (Module::*somefunc)(CT...),
                         std::vector<int> positions,
                         typename NonDeduced<CT>::type... Args) {
-
-        if (modules.empty())
-            throw RuntimeError("No modules added");
-        if (positions.empty() ||
-            (positions.size() == 1 && positions[0] == -1)) {
-            positions.resize(modules.size());
-            std::iota(begin(positions), end(positions), 0);
-        }
-        std::vector<std::future<RT>> futures;
-        futures.reserve(positions.size());
-        for (size_t i : positions) {
-            if (i >= modules.size())
-                throw RuntimeError("Module out of range");
-            futures.push_back(std::async(std::launch::async, somefunc,
-                                         modules[i].get(), Args...));
-        }
+        auto futures = RunInWorkers<RT>(
+            positions, [&](Module *m) { return (m->*somefunc)(Args...); });
         Result<RT> result;
-        result.reserve(positions.size());
+        result.reserve(futures.size());
         for (auto &i : futures) {
             result.push_back(i.get());
         }
@@ -117,24 +108,10 @@ class DetectorImpl : public virtual slsDetectorDefs {
     Result<RT> Parallel(RT (Module::*somefunc)(CT...) const,
                         std::vector<int> positions,
                         typename NonDeduced<CT>::type... Args) const {
-
-        if (modules.empty())
-            throw RuntimeError("No modules added");
-        if (positions.empty() ||
-            (positions.size() == 1 && positions[0] == -1)) {
-            positions.resize(modules.size());
-            std::iota(begin(positions), end(positions), 0);
-        }
-        std::vector<std::future<RT>> futures;
-        futures.reserve(positions.size());
-        for (size_t i : positions) {
-            if (i >= modules.size())
-                throw RuntimeError("Module out of range");
-            futures.push_back(std::async(std::launch::async, somefunc,
-                                         modules[i].get(), Args...));
-        }
+        auto futures = RunInWorkers<RT>(
+            positions, [&](Module *m) { return (m->*somefunc)(Args...); });
         Result<RT> result;
-        result.reserve(positions.size());
+        result.reserve(futures.size());
         for (auto &i : futures) {
             result.push_back(i.get());
         }
@@ -144,22 +121,8 @@ class DetectorImpl : public virtual slsDetectorDefs {
     template <typename... CT>
     void Parallel(void (Module::*somefunc)(CT...), std::vector<int> positions,
                   typename NonDeduced<CT>::type... Args) {
-
-        if (modules.empty())
-            throw RuntimeError("No modules added");
-        if (positions.empty() ||
-            (positions.size() == 1 && positions[0] == -1)) {
-            positions.resize(modules.size());
-            std::iota(begin(positions), end(positions), 0);
-        }
-        std::vector<std::future<void>> futures;
-        futures.reserve(positions.size());
-        for (size_t i : positions) {
-            if (i >= modules.size())
-                throw RuntimeError("Module out of range");
-            futures.push_back(std::async(std::launch::async, somefunc,
-                                         modules[i].get(), Args...));
-        }
+        auto futures = RunInWorkers<void>(
+            positions, [&](Module *m) { (m->*somefunc)(Args...); });
         for (auto &i : futures) {
             i.get();
         }
@@ -169,27 +132,19 @@ class DetectorImpl : public virtual slsDetectorDefs {
     void Parallel(void (Module::*somefunc)(CT...) const,
                   std::vector<int> positions,
                   typename NonDeduced<CT>::type... Args) const {
-
-        if (modules.empty())
-            throw RuntimeError("No modules added");
-        if (positions.empty() ||
-            (positions.size() == 1 && positions[0] == -1)) {
-            positions.resize(modules.size());
-            std::iota(begin(positions), end(positions), 0);
-        }
-        std::vector<std::future<void>> futures;
-        futures.reserve(positions.size());
-        for (size_t i : positions) {
-            if (i >= modules.size())
-                throw RuntimeError("Module out of range");
-            futures.push_back(std::async(std::launch::async, somefunc,
-                                         modules[i].get(), Args...));
-        }
+        auto futures = RunInWorkers<void>(
+            positions, [&](Module *m) { (m->*somefunc)(Args...); });
         for (auto &i : futures) {
             i.get();
         }
     }
 
+    /** func(i) for each module i of positions, in its worker as Parallel
+     * (eg. the lines of a config file for each module). Returns when all
+     * calls are done, throws the first error of positions */
+    void ParallelForModules(std::vector<int> positions,
+                            const std::function<void(int)> &func) const;
+
     bool isAllPositions(Positions pos) const;
 
     /** set acquiring flag in shared memory */
@@ -237,6 +192,21 @@ class DetectorImpl : public virtual slsDetectorDefs {
      * Sets maximum number of channels of all sls modules */
     void setNumberOfChannels(const slsDetectorDefs::xy c);
 
+    /** not in shm, connections are per process */
+    bool getPersistentConnections() const;
+    void setPersistentConnections(const bool enable);
+
+    /** commands without reply queued per module and server, sent in one
+     * batch when a command needs a reply or when disabled (eg. config file) */
+    void setBatchCommands(const bool enable);
+    /** eg. config file line, for errors of the commands queued next */
+    void setBatchSource(const std::string &source, Positions pos = {});
+    /** sources of the commands still queued on any module */
+    std::set<std::string> getQueuedBatchSources() const;
+    /** sources of commands not applied as an earlier command of their batch
+     * failed, on any module */
+    std::set<std::string> getSkippedBatchSources() const;
+
     bool getGapPixelsinCallback() const;
     void setGapPixelsinCallback(const bool enable);
     int getTransmissionDelay() const;
@@ -353,6 +323,48 @@ class DetectorImpl : public virtual slsDetectorDefs {
     void setCtbSlowADCName(const defs::dacIndex index, const std::string &name);
 
   private:
+    /**
+     * Calls func for the module of each position (-1 or empty for all) in
+     * its worker, a single module in the calling thread. Returns when all
+     * calls are done (also if one throws, as they use the arguments of the
+     * caller), get() passes on the exceptions.
+     */
+    template <typename RT, typename F>
+    std::vector<std::future<RT>> RunInWorkers(std::vector<int> &positions,
+                                              F func) const {
+        if (modules.empty())
+            throw RuntimeError("No modules added");
+        if (positions.empty() ||
+            (positions.size() == 1 && positions[0] == -1)) {
+            positions.resize(modules.size());
+            std::iota(begin(positions), end(positions), 0);
+        }
+        for (size_t i : positions) {
+            if (i >= modules.size())
+                throw RuntimeError("Module out of range");
+        }
+        std::vector<std::future<RT>> futures;
+        futures.reserve(positions.size());
+        if (positions.size() == 1) {
+            futures.push_back(
+                std::async(std::launch::deferred, func,
+                           modules[positions[0]].get()));
+            futures.back().wait();
+            return futures;
+        }
+        for (size_t i : positions) {
+            Module *module = modules[i].get();
+            futures.push_back(workers.Run<RT>(
+                i, std::function<RT()>([&func, module]() {
+                    return func(module);
+                })));
+        }
+        for (auto &i : futures) {
+            i.wait();
+        }
+        return futures;
+    }
+
     /**
      * Creates/open shared memory, initializes detector structure and members
      * Called by constructor/ set hostname / read config file
@@ -398,6 +410,10 @@ class DetectorImpl : public virtual slsDetectorDefs {
      */
     void readFrameFromReceiver();
 
+    /** thread of a zmq socket for readFrameFromReceiver, receives its images
+     * into their place in the frames of the assembler */
+    void receiveFrameParts(size_t isocket, FrameAssembler &assembler);
+
     /** [Eiger][Jungfrau][Moench]
      * add gap pixels to the imag
      * @param image pointer to image without gap pixels
@@ -448,11 +464,15 @@ class DetectorImpl : public virtual slsDetectorDefs {
     SharedMemory<sharedDetector> shm{0, -1};
     SharedMemory<CtbConfig> ctb_shm{0, -1, CtbConfig::shm_tag()};
     std::vector<std::unique_ptr<Module>> modules;
+    /** threads of Parallel */
+    mutable ModuleWorkers workers;
+    bool persistentConnections{false};
+    bool batchCommands{false};
 
     /** data streaming (down stream) enabled in client (zmq sckets created) */
     bool client_downstream{false};
     std::vector<std::unique_ptr<ZmqSocket>> zmqSocket;
-    volatile int numZmqRunning{0};
+    std::atomic<int> numZmqRunning{0};
 
     /** mutex to synchronize main and data processing threads */
     mutable std::mutex mp;
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "FrameAssembler.h"
+#include "sls/sls_detector_defs.h"
+
+#include <cstring>
+
+namespace sls {
+
+FrameAssembler::FrameAssembler(size_t nParts)
+    : nParts(nParts), parts(nParts), nRunning(nParts) {}
+
+char *FrameAssembler::Arrive(size_t part, const zmqHeader &header) {
+    std::unique_lock<std::mutex> lock(mutex);
+    Part &p = parts[part];
+    // previous round done by all parts and its buffer handled by the consumer
+    cv.wait(lock,
+            [&]() { return round == p.round && !slots[round % 2].ready; });
+    if (frameSize == 0) {
+        frameSize = static_cast<size_t>(header.imageSize) * nParts;
+        for (auto &slot : slots) {
+            slot.data.reset(new char[frameSize]);
+            memset(slot.data.get(), 0xFF, frameSize);
+        }
+    }
+    p.arrived = true;
+    // expLength is the sub frame index only for eiger 32 bit, else the
+    // exposure time (may differ between parts)
+    bool subFrames = header.detType == slsDetectorDefs::EIGER &&
+                     header.dynamicRange == 32;
+    p.key = Key{header.frameIndex, subFrames ? header.expLength : 0};
+    p.header = header;
+    ++nArrived;
+    Update();
+    cv.wait(lock, [this]() { return decided; });
+    if (p.key != target) {
+        return nullptr;
+    }
+    return slots[round % 2].data.get();
+}
+
+void FrameAssembler::Done(size_t part) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Part &p = parts[part];
+    if (p.key == target) {
+        Frame &frame = slots[round % 2].frame;
+        frame.header = p.header;
+        if (p.header.completeImage == 0) {
+            frame.complete = false;
+        }
+        ++nWritten;
+    }
+    p.round = round + 1;
+    ++nDone;
+    Update();
+}
+
+void FrameAssembler::Stop(size_t part) {
+    std::lock_guard<std::mutex> lock(mutex);
+    parts[part].running = false;
+    --nRunning;
+    Update();
+    cv.notify_all();
+}
+
+void FrameAssembler::Update() {
+    if (!decided) {
+        if (nArrived == 0 || nArrived != nRunning) {
+            return;
+        }
+        target = Key{UINT64_MAX, UINT32_MAX};
+        for (const auto &p : parts) {
+            if (p.arrived && p.key < target) {
+                target = p.key;
+            }
+        }
+        decided = true;
+        slots[round % 2].frame.complete = true;
+        nWritten = 0;
+        cv.notify_all();
+        return;
+    }
+    if (nDone != nArrived) {
+        return;
+    }
+    Slot &slot = slots[round % 2];
+    slot.frame.data = slot.data.get();
+    slot.frame.size = frameSize;
+    if (nWritten != nParts) {
+        slot.frame.complete = false;
+    }
+    slot.ready = true;
+    for (auto &p : parts) {
+        p.arrived = false;
+    }
+    ++round;
+    nArrived = 0;
+    nDone = 0;
+    decided = false;
+    cv.notify_all();
+}
+
+bool FrameAssembler::Next(Frame &frame) {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]() {
+        return slots[consumed % 2].ready || nRunning == 0;
+    });
+    if (!slots[consumed % 2].ready) {
+        return false;
+    }
+    frame = slots[consumed % 2].frame;
+    return true;
+}
+
+void FrameAssembler::Release() {
+    // not written by the parts until released
+    Slot &slot = slots[consumed % 2];
+    memset(slot.data.get(), 0xFF, frameSize);
+    std::lock_guard<std::mutex> lock(mutex);
+    slot.ready = false;
+    ++consumed;
+    cv.notify_all();
+}
+
+} // namespace sls
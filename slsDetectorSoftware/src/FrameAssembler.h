@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#pragma once
+
+#include "sls/ZmqSocket.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace sls {
+
+/**
+ * Assembles the images of the client zmq sockets (parts), each received in
+ * its own thread, into one frame. The parts of a frame are matched by frame
+ * index and sub frame index: each round, every running part arrives with its
+ * next header, the lowest frame among them is assembled and parts with a
+ * later frame keep it for a later round (missing parts stay 0xFF). Two frame
+ * buffers: the parts write the next frame while the consumer handles the
+ * previous one.
+ */
+class FrameAssembler {
+  public:
+    struct Frame {
+        char *data{nullptr};
+        size_t size{0};
+        /** header of the last part written */
+        zmqHeader header;
+        /** all parts written and each of them complete */
+        bool complete{false};
+    };
+
+    explicit FrameAssembler(size_t nParts);
+    FrameAssembler(const FrameAssembler &) = delete;
+    FrameAssembler &operator=(const FrameAssembler &) = delete;
+
+    /**
+     * Called by the thread of a part with the header of its next image.
+     * Blocks until the frame of the round is decided (the first header
+     * allocates the frame buffers with imageSize per part).
+     * @returns frame buffer to write the image to, nullptr if the part keeps
+     * its image for a later frame. Either way followed by Done.
+     */
+    char *Arrive(size_t part, const zmqHeader &header);
+    void Done(size_t part);
+    /** end of acquisition (or error) for the part */
+    void Stop(size_t part);
+
+    /** blocks for the next frame, false if all parts stopped */
+    bool Next(Frame &frame);
+    /** frame buffer of Next free again */
+    void Release();
+
+  private:
+    using Key = std::pair<uint64_t, uint32_t>;
+    struct Slot {
+        std::unique_ptr<char[]> data;
+        bool ready{false};
+        Frame frame;
+    };
+    struct Part {
+        bool running{true};
+        bool arrived{false};
+        /** round the part joins next */
+        uint64_t round{0};
+        Key key;
+        zmqHeader header;
+    };
+
+    /** decides or publishes the round (locked) */
+    void Update();
+
+    const size_t nParts;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<Part> parts;
+    size_t nRunning;
+    size_t frameSize{0};
+    Slot slots[2];
+    uint64_t round{0};
+    uint64_t consumed{0};
+    size_t nArrived{0};
+    size_t nDone{0};
+    size_t nWritten{0};
+    bool decided{false};
+    Key target;
+};
+
+} // namespace sls
@@ -69,6 +69,7 @@ std::string Module::getHostname() const { return shm()->hostname; }
 
 void Module::setHostname(const std::string &hostname,
                          const bool initialChecks) {
+    flushCommandBatch();
     strcpy_safe(shm()->hostname, hostname.c_str());
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.close();
@@ -88,6 +89,19 @@ void Module::setHostname(const std::string &hostname,
     }
 }
 
+bool Module::getPersistentConnections() const { return persistentConnections; }
+
+void Module::setPersistentConnections(bool enable) {
+    persistentConnections = enable;
+    if (!enable) {
+        for (auto connection :
+             {&controlConnection, &stopConnection, &receiverConnection}) {
+            std::lock_guard<std::mutex> lock(connection->mutex);
+            connection->socket.reset();
+        }
+    }
+}
+
 int64_t Module::getFirmwareVersion() const {
     return sendToDetector<int64_t>(F_GET_FIRMWARE_VERSION);
 }
@@ -214,7 +228,7 @@ void Module::setSettings(detectorSettings isettings) {
         throw RuntimeError(
             "Cannot set settings for Eiger. Use threshold energy.");
     }
-    sendToDetector<int>(F_SET_SETTINGS, isettings);
+    sendToDetectorIgnoreRetval<int>(F_SET_SETTINGS, isettings);
 }
 
 int Module::getThresholdEnergy() const {
@@ -495,7 +509,7 @@ int Module::getAllTrimbits() const {
 }
 
 void Module::setAllTrimbits(int val) {
-    sendToDetector<int>(F_SET_ALL_TRIMBITS, val);
+    sendToDetectorIgnoreRetval<int>(F_SET_ALL_TRIMBITS, val);
 }
 
 std::vector<int> Module::getTrimEn() const {
@@ -531,7 +545,8 @@ bool Module::getFlipRows() const {
 
 void Module::setFlipRows(bool value) {
     if (shm()->detType == EIGER) {
-        sendToReceiver<int>(F_SET_FLIP_ROWS_RECEIVER, static_cast<int>(value));
+        sendToReceiverIgnoreRetval<int>(F_SET_FLIP_ROWS_RECEIVER,
+                                        static_cast<int>(value));
     } else {
         sendToDetector(F_SET_FLIP_ROWS, static_cast<int>(value), nullptr);
     }
@@ -560,6 +575,7 @@ void Module::setSynchronization(const bool value) {
 }
 
 std::vector<int> Module::getBadChannels() const {
+    flushCommandBatch();
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.Send(F_GET_BAD_CHANNELS);
     if (client.Receive<int>() == FAIL) {
@@ -581,6 +597,7 @@ std::vector<int> Module::getBadChannels() const {
 void Module::setBadChannels(std::vector<int> list) {
     auto nch = static_cast<int>(list.size());
     LOG(logDEBUG1) << "Sending bad channels to detector, nch:" << nch;
+    flushCommandBatch();
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.Send(F_SET_BAD_CHANNELS);
     client.Send(nch);
@@ -729,7 +746,7 @@ slsDetectorDefs::timingMode Module::getTimingMode() const {
 }
 
 void Module::setTimingMode(timingMode value) {
-    sendToDetector<int>(F_SET_TIMING_MODE, value);
+    sendToDetectorIgnoreRetval<int>(F_SET_TIMING_MODE, value);
     if (shm()->useReceiverFlag) {
         sendToReceiver(F_SET_RECEIVER_TIMING_MODE, value, nullptr);
     }
@@ -797,7 +814,7 @@ void Module::resetToDefaultDacs(const bool hardReset) {
 
 void Module::setDAC(int val, dacIndex index, bool mV) {
     int args[]{static_cast<int>(index), static_cast<int>(mV), val};
-    sendToDetector<int>(F_SET_DAC, args);
+    sendToDetectorIgnoreRetval<int>(F_SET_DAC, args);
 }
 
 bool Module::getPowerChip() const {
@@ -805,7 +822,7 @@ bool Module::getPowerChip() const {
 }
 
 void Module::setPowerChip(bool on) {
-    sendToDetector<int>(F_POWER_CHIP, static_cast<int>(on));
+    sendToDetectorIgnoreRetval<int>(F_POWER_CHIP, static_cast<int>(on));
 }
 
 int Module::getImageTestMode() const {
@@ -971,6 +988,7 @@ std::vector<int64_t> Module::getFramesCaughtByReceiver() const {
     // TODO!(Erik) Refactor
     LOG(logDEBUG1) << "Getting frames caught";
     if (shm()->useReceiverFlag) {
+        flushCommandBatch();
         auto client = ReceiverSocket(shm()->rxHostname, shm()->rxTCPPort);
         client.Send(F_GET_RECEIVER_FRAMES_CAUGHT);
         if (client.Receive<int>() == FAIL) {
@@ -993,6 +1011,7 @@ std::vector<int64_t> Module::getNumMissingPackets() const {
     // TODO!(Erik) Refactor
     LOG(logDEBUG1) << "Getting num missing packets";
     if (shm()->useReceiverFlag) {
+        flushCommandBatch();
         auto client = ReceiverSocket(shm()->rxHostname, shm()->rxTCPPort);
         client.Send(F_GET_NUM_MISSING_PACKETS);
         if (client.Receive<int>() == FAIL) {
@@ -1015,6 +1034,7 @@ std::vector<int64_t> Module::getReceiverCurrentFrameIndex() const {
     // TODO!(Erik) Refactor
     LOG(logDEBUG1) << "Getting frame index";
     if (shm()->useReceiverFlag) {
+        flushCommandBatch();
         auto client = ReceiverSocket(shm()->rxHostname, shm()->rxTCPPort);
         client.Send(F_GET_RECEIVER_FRAME_INDEX);
         if (client.Receive<int>() == FAIL) {
@@ -1435,6 +1455,7 @@ void Module::setReceiverHostname(const std::string &hostname,
 uint16_t Module::getReceiverPort() const { return shm()->rxTCPPort; }
 
 void Module::setReceiverPort(uint16_t port_number) {
+    flushCommandBatch();
     shm()->rxTCPPort = port_number;
 }
 
@@ -1443,7 +1464,31 @@ int Module::getReceiverFifoDepth() const {
 }
 
 void Module::setReceiverFifoDepth(int n_frames) {
-    sendToReceiver<int>(F_SET_RECEIVER_FIFO_DEPTH, n_frames);
+    sendToReceiverIgnoreRetval<int>(F_SET_RECEIVER_FIFO_DEPTH, n_frames);
+}
+
+int Module::getReceiverFifoHugePageSize() const {
+    return sendToReceiver<int>(F_GET_RECEIVER_FIFO_HUGEPAGE);
+}
+
+void Module::setReceiverFifoHugePageSize(int size_mb) {
+    sendToReceiver(F_SET_RECEIVER_FIFO_HUGEPAGE, size_mb, nullptr);
+}
+
+int Module::getReceiverFifoNumaNode() const {
+    return sendToReceiver<int>(F_GET_RECEIVER_FIFO_NUMA_NODE);
+}
+
+void Module::setReceiverFifoNumaNode(int node) {
+    sendToReceiver(F_SET_RECEIVER_FIFO_NUMA_NODE, node, nullptr);
+}
+
+int Module::getReceiverProcessingThreads() const {
+    return sendToReceiver<int>(F_GET_RECEIVER_PROCESSING_THREADS);
+}
+
+void Module::setReceiverProcessingThreads(int n) {
+    sendToReceiver(F_SET_RECEIVER_PROCESSING_THREADS, n, nullptr);
 }
 
 bool Module::getReceiverSilentMode() const {
@@ -1482,7 +1527,25 @@ int Module::getReceiverRealUDPSocketBufferSize() const {
 }
 
 void Module::setReceiverUDPSocketBufferSize(int udpsockbufsize) {
-    sendToReceiver<int>(F_RECEIVER_UDP_SOCK_BUF_SIZE, udpsockbufsize);
+    sendToReceiverIgnoreRetval<int>(F_RECEIVER_UDP_SOCK_BUF_SIZE,
+                                    udpsockbufsize);
+}
+
+int Module::getReceiverUDPBatchSize() const {
+    return sendToReceiver<int>(F_GET_RECEIVER_UDP_BATCH_SIZE);
+}
+
+void Module::setReceiverUDPBatchSize(int n_packets) {
+    sendToReceiver(F_SET_RECEIVER_UDP_BATCH_SIZE, n_packets, nullptr);
+}
+
+slsDetectorDefs::socketBackend Module::getReceiverSocketBackend() const {
+    return sendToReceiver<socketBackend>(F_GET_RECEIVER_SOCKET_BACKEND);
+}
+
+void Module::setReceiverSocketBackend(socketBackend backend) {
+    sendToReceiver(F_SET_RECEIVER_SOCKET_BACKEND, static_cast<int>(backend),
+                   nullptr);
 }
 
 bool Module::getReceiverLock() const {
@@ -1502,6 +1565,18 @@ std::array<pid_t, NUM_RX_THREAD_IDS> Module::getReceiverThreadIds() const {
         F_GET_RECEIVER_THREAD_IDS);
 }
 
+std::string Module::getReceiverThreadCpus() const {
+    char ret[MAX_STR_LENGTH]{};
+    sendToReceiver(F_GET_RECEIVER_THREAD_CPUS, nullptr, ret);
+    return ret;
+}
+
+void Module::setReceiverThreadCpus(const std::string &cpus) {
+    char args[MAX_STR_LENGTH]{};
+    strcpy_safe(args, cpus.c_str());
+    sendToReceiver(F_SET_RECEIVER_THREAD_CPUS, args, nullptr);
+}
+
 bool Module::getRxArping() const {
     return sendToReceiver<int>(F_GET_RECEIVER_ARPING);
 }
@@ -1605,6 +1680,32 @@ void Module::setFramesPerFile(int n_frames) {
     sendToReceiver(F_SET_RECEIVER_FRAMES_PER_FILE, n_frames, nullptr);
 }
 
+slsDetectorDefs::writeEngine Module::getReceiverWriteEngine() const {
+    return sendToReceiver<writeEngine>(F_GET_RECEIVER_WRITE_ENGINE);
+}
+
+void Module::setReceiverWriteEngine(writeEngine engine) {
+    sendToReceiver(F_SET_RECEIVER_WRITE_ENGINE, static_cast<int>(engine),
+                   nullptr);
+}
+
+slsDetectorDefs::fileCompression Module::getReceiverFileCompression() const {
+    return sendToReceiver<fileCompression>(F_GET_RECEIVER_FILE_COMPRESSION);
+}
+
+void Module::setReceiverFileCompression(fileCompression compression) {
+    sendToReceiver(F_SET_RECEIVER_FILE_COMPRESSION,
+                   static_cast<int>(compression), nullptr);
+}
+
+int Module::getReceiverCompressionThreads() const {
+    return sendToReceiver<int>(F_GET_RECEIVER_COMPRESSION_THREADS);
+}
+
+void Module::setReceiverCompressionThreads(int n) {
+    sendToReceiver(F_SET_RECEIVER_COMPRESSION_THREADS, n, nullptr);
+}
+
 // ZMQ Streaming Parameters (Receiver<->Client)
 
 bool Module::getReceiverStreaming() const {
@@ -1632,7 +1733,7 @@ int Module::getReceiverStreamingTimer() const {
 }
 
 void Module::setReceiverStreamingTimer(int time_in_ms) {
-    sendToReceiver<int>(F_RECEIVER_STREAMING_TIMER, time_in_ms);
+    sendToReceiverIgnoreRetval<int>(F_RECEIVER_STREAMING_TIMER, time_in_ms);
 }
 
 int Module::getReceiverStreamingStartingFrame() const {
@@ -1691,6 +1792,66 @@ void Module::setReceiverStreamingHwm(const int limit) {
     sendToReceiver(F_SET_RECEIVER_STREAMING_HWM, limit, nullptr);
 }
 
+slsDetectorDefs::fileCompression
+Module::getReceiverStreamingCompression() const {
+    return sendToReceiver<fileCompression>(
+        F_GET_RECEIVER_STREAMING_COMPRESSION);
+}
+
+void Module::setReceiverStreamingCompression(fileCompression compression) {
+    sendToReceiver(F_SET_RECEIVER_STREAMING_COMPRESSION,
+                   static_cast<int>(compression), nullptr);
+}
+
+int Module::getReceiverStreamingCompressionLevel() const {
+    return sendToReceiver<int>(F_GET_RECEIVER_STREAMING_COMPRESSION_LEVEL);
+}
+
+void Module::setReceiverStreamingCompressionLevel(int level) {
+    sendToReceiver(F_SET_RECEIVER_STREAMING_COMPRESSION_LEVEL, level, nullptr);
+}
+
+slsDetectorDefs::zmqHeaderFormat
+Module::getReceiverStreamingHeaderFormat() const {
+    return sendToReceiver<zmqHeaderFormat>(
+        F_GET_RECEIVER_STREAMING_HEADER_FORMAT);
+}
+
+void Module::setReceiverStreamingHeaderFormat(zmqHeaderFormat format) {
+    sendToReceiver(F_SET_RECEIVER_STREAMING_HEADER_FORMAT,
+                   static_cast<int>(format), nullptr);
+}
+
+slsDetectorDefs::zmqStreamingPolicy
+Module::getReceiverStreamingPolicy() const {
+    return sendToReceiver<zmqStreamingPolicy>(F_GET_RECEIVER_STREAMING_POLICY);
+}
+
+void Module::setReceiverStreamingPolicy(zmqStreamingPolicy policy) {
+    sendToReceiver(F_SET_RECEIVER_STREAMING_POLICY, static_cast<int>(policy),
+                   nullptr);
+}
+
+std::vector<slsDetectorDefs::streamingStatistics>
+Module::getReceiverStreamingStatistics() const {
+    if (!shm()->useReceiverFlag) {
+        throw RuntimeError("No receiver to get streaming statistics.");
+    }
+    flushCommandBatch();
+    auto client = ReceiverSocket(shm()->rxHostname, shm()->rxTCPPort);
+    client.Send(F_GET_RECEIVER_STREAMING_STATISTICS);
+    if (client.Receive<int>() == FAIL) {
+        throw ReceiverError("Receiver " + std::to_string(moduleIndex) +
+                            " returned error: " + client.readErrorMessage());
+    }
+    auto nstreamers = client.Receive<int>();
+    std::vector<streamingStatistics> retval(nstreamers);
+    client.Receive(retval);
+    LOG(logDEBUG1) << "Streaming statistics of Receiver" << moduleIndex
+                   << ": " << ToString(retval);
+    return retval;
+}
+
 //  Eiger Specific
 
 int64_t Module::getSubExptime() const {
@@ -1746,6 +1907,7 @@ void Module::setRateCorrection(int64_t t) {
 void Module::sendReceiverRateCorrections(const std::vector<int64_t> &t) {
     LOG(logDEBUG) << "Sending to receiver 0 [rate corrections: " << ToString(t)
                   << ']';
+    flushCommandBatch();
     auto receiver = ReceiverSocket(shm()->rxHostname, shm()->rxTCPPort);
     receiver.Send(F_SET_RECEIVER_RATE_CORRECT);
     receiver.Send(static_cast<int>(t.size()));
@@ -1799,7 +1961,7 @@ bool Module::getCounterBit() const {
 }
 
 void Module::setCounterBit(bool cb) {
-    sendToDetector<int>(F_SET_COUNTER_BIT, static_cast<int>(!cb));
+    sendToDetectorIgnoreRetval<int>(F_SET_COUNTER_BIT, static_cast<int>(!cb));
 }
 
 void Module::pulsePixel(int n, int x, int y) {
@@ -1886,7 +2048,8 @@ bool Module::getAutoComparatorDisableMode() const {
 }
 
 void Module::setAutoComparatorDisableMode(bool val) {
-    sendToDetector<int>(F_AUTO_COMP_DISABLE, static_cast<int>(val));
+    sendToDetectorIgnoreRetval<int>(F_AUTO_COMP_DISABLE,
+                                    static_cast<int>(val));
 }
 
 int64_t Module::getComparatorDisableTime() const {
@@ -1913,7 +2076,7 @@ int Module::getStorageCellStart() const {
 }
 
 void Module::setStorageCellStart(int pos) {
-    sendToDetector<int>(F_STORAGE_CELL_START, pos);
+    sendToDetectorIgnoreRetval<int>(F_STORAGE_CELL_START, pos);
 }
 
 int64_t Module::getStorageCellDelay() const {
@@ -2026,6 +2189,7 @@ void Module::sendVetoPhoton(const int chipIndex,
                    << ", nch:" << nch << "]";
 
     const int args[]{chipIndex, nch};
+    flushCommandBatch();
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.Send(F_SET_VETO_PHOTON);
     client.Send(args);
@@ -2040,6 +2204,7 @@ void Module::sendVetoPhoton(const int chipIndex,
 void Module::getVetoPhoton(const int chipIndex,
                            const std::string &fname) const {
     LOG(logDEBUG1) << "Getting veto photon [" << chipIndex << "]\n";
+    flushCommandBatch();
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.Send(F_GET_VETO_PHOTON);
     client.Send(chipIndex);
@@ -2396,7 +2561,7 @@ void Module::setADCEnableMask(uint32_t mask) {
     updateNumberOfChannels();
 
     if (shm()->useReceiverFlag) {
-        sendToReceiver<int>(F_RECEIVER_SET_ADC_MASK, mask);
+        sendToReceiverIgnoreRetval<int>(F_RECEIVER_SET_ADC_MASK, mask);
     }
 }
 
@@ -2409,7 +2574,7 @@ void Module::setTenGigaADCEnableMask(uint32_t mask) {
     updateNumberOfChannels(); // depends on samples and adcmask
 
     if (shm()->useReceiverFlag) {
-        sendToReceiver<int>(F_RECEIVER_SET_ADC_MASK_10G, mask);
+        sendToReceiverIgnoreRetval<int>(F_RECEIVER_SET_ADC_MASK_10G, mask);
     }
 }
 
@@ -2423,7 +2588,8 @@ void Module::setTransceiverEnableMask(uint32_t mask) {
     updateNumberOfChannels();
 
     if (shm()->useReceiverFlag) {
-        sendToReceiver<int>(F_RECEIVER_SET_TRANSCEIVER_MASK, mask);
+        sendToReceiverIgnoreRetval<int>(F_RECEIVER_SET_TRANSCEIVER_MASK,
+                                        mask);
     }
 }
 // CTB Specific
@@ -2482,7 +2648,8 @@ bool Module::getExternalSampling() const {
 }
 
 void Module::setExternalSampling(bool value) {
-    sendToDetector<int>(F_EXTERNAL_SAMPLING, static_cast<int>(value));
+    sendToDetectorIgnoreRetval<int>(F_EXTERNAL_SAMPLING,
+                                    static_cast<int>(value));
 }
 
 std::vector<int> Module::getReceiverDbitList() const {
@@ -2526,7 +2693,7 @@ bool Module::getLEDEnable() const {
 }
 
 void Module::setLEDEnable(bool enable) {
-    sendToDetector<int>(F_LED, static_cast<int>(enable));
+    sendToDetectorIgnoreRetval<int>(F_LED, static_cast<int>(enable));
 }
 
 // Pattern
@@ -2537,6 +2704,7 @@ std::string Module::getPatterFileName() const {
 }
 
 void Module::setPattern(const Pattern &pat, const std::string &fname) {
+    flushCommandBatch();
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.Send(F_SET_PATTERN);
     client.Send(pat.data(), pat.size());
@@ -2573,7 +2741,7 @@ uint64_t Module::getPatternWord(int addr) const {
 
 void Module::setPatternWord(int addr, uint64_t word) {
     uint64_t args[]{static_cast<uint64_t>(addr), word};
-    sendToDetector<uint64_t>(F_SET_PATTERN_WORD, args);
+    sendToDetectorIgnoreRetval<uint64_t>(F_SET_PATTERN_WORD, args);
 }
 
 std::array<int, 2> Module::getPatternLoopAddresses(int level) const {
@@ -2596,7 +2764,7 @@ int Module::getPatternLoopCycles(int level) const {
 
 void Module::setPatternLoopCycles(int level, int n) {
     int args[]{level, n};
-    sendToDetector<int>(F_SET_PATTERN_LOOP_CYCLES, args);
+    sendToDetectorIgnoreRetval<int>(F_SET_PATTERN_LOOP_CYCLES, args);
 }
 
 int Module::getPatternWaitAddr(int level) const {
@@ -2606,7 +2774,7 @@ int Module::getPatternWaitAddr(int level) const {
 
 void Module::setPatternWaitAddr(int level, int addr) {
     int args[]{level, addr};
-    sendToDetector<int>(F_SET_PATTERN_WAIT_ADDR, args);
+    sendToDetectorIgnoreRetval<int>(F_SET_PATTERN_WAIT_ADDR, args);
 }
 
 uint64_t Module::getPatternWaitTime(int level) const {
@@ -2617,7 +2785,7 @@ uint64_t Module::getPatternWaitTime(int level) const {
 
 void Module::setPatternWaitTime(int level, uint64_t t) {
     uint64_t args[]{static_cast<uint64_t>(level), t};
-    sendToDetector<uint64_t>(F_SET_PATTERN_WAIT_TIME, args);
+    sendToDetectorIgnoreRetval<uint64_t>(F_SET_PATTERN_WAIT_TIME, args);
 }
 
 uint64_t Module::getPatternMask() const {
@@ -2647,6 +2815,7 @@ std::map<std::string, std::string> Module::getAdditionalJsonHeader() const {
         throw RuntimeError("Set rx_hostname first to use receiver parameters "
                            "(zmq json header)");
     }
+    flushCommandBatch();
     auto client = ReceiverSocket(shm()->rxHostname, shm()->rxTCPPort);
     client.Send(F_GET_ADDITIONAL_JSON_HEADER);
     if (client.Receive<int>() == FAIL) {
@@ -2692,6 +2861,7 @@ void Module::setAdditionalJsonHeader(
     const auto size = static_cast<int>(buff.size());
     LOG(logDEBUG) << "Sending to receiver additional json header "
                   << ToString(jsonHeader);
+    flushCommandBatch();
     auto client = ReceiverSocket(shm()->rxHostname, shm()->rxTCPPort);
     client.Send(F_SET_ADDITIONAL_JSON_HEADER);
     client.Send(size);
@@ -2858,12 +3028,14 @@ void Module::setADCInvert(uint32_t value) {
 uint16_t Module::getControlPort() const { return shm()->controlPort; }
 
 void Module::setControlPort(uint16_t port_number) {
+    flushCommandBatch();
     shm()->controlPort = port_number;
 }
 
 uint16_t Module::getStopPort() const { return shm()->stopPort; }
 
 void Module::setStopPort(uint16_t port_number) {
+    flushCommandBatch();
     shm()->stopPort = port_number;
 }
 
@@ -2885,6 +3057,7 @@ std::string Module::executeCommand(const std::string &cmd) {
     strcpy_safe(arg, cmd.c_str());
     LOG(logINFO) << "Module " << moduleIndex << " (" << shm()->hostname
                  << "): Sending command " << cmd;
+    flushCommandBatch();
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.Send(F_EXEC_COMMAND);
     client.Send(arg);
@@ -2939,15 +3112,282 @@ void Module::checkArgs(const void *args, size_t args_size, void *retval,
     static_assert(!std::is_same<ARG, std::nullptr_t>::value,                   \
                   "nullptr_t type is incompatible with templated " DST);
 
+template <class Socket, class Command>
+void Module::sendCommand(Connection &connection, const std::string &hostname,
+                         uint16_t port, Command command) const {
+    std::unique_lock<std::mutex> lock(connection.mutex, std::defer_lock);
+    if (!persistentConnections || !lock.try_lock()) {
+        auto client = Socket(hostname, port);
+        command(client);
+        client.close();
+        return;
+    }
+    // closed by the server (restarted or previous command failed), or
+    // hostname or port changed
+    if (connection.socket && (!connection.socket->isConnected() ||
+                              connection.hostname != hostname ||
+                              connection.port != port)) {
+        connection.socket.reset();
+    }
+    if (!connection.socket) {
+        connection.socket = sls::make_unique<Socket>(hostname, port);
+        connection.hostname = hostname;
+        connection.port = port;
+    }
+    try {
+        command(*connection.socket);
+    } catch (...) {
+        // server closes the connection after a failed command
+        connection.socket.reset();
+        throw;
+    }
+}
+
+bool Module::queueCommand(std::vector<BatchCommand> &batch, int fnum,
+                          const void *args, size_t args_size,
+                          size_t retval_size) const {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    if (!batchCommands || batch.size() == MAX_BATCH_COMMANDS ||
+        args_size > MAX_BATCH_ARGS_SIZE || retval_size > MAX_BATCH_ARGS_SIZE) {
+        return false;
+    }
+    auto begin = static_cast<const char *>(args);
+    batch.push_back(BatchCommand{
+        fnum, std::vector<char>(begin, begin + args_size), retval_size,
+        batchSource.empty()
+            ? getFunctionNameFromEnum(static_cast<detFuncs>(fnum))
+            : batchSource,
+        batchSequence++});
+    return true;
+}
+
+template <class Socket>
+void Module::sendCommandBatch(Connection &connection,
+                              const std::string &hostname, uint16_t port,
+                              int fnum,
+                              const std::vector<BatchCommand> &batch,
+                              size_t &applied) const {
+    bool receiver = std::is_same<Socket, ReceiverSocket>::value;
+    auto error = [&](const std::string &source, const std::string &mess) {
+        std::string name = receiver ? "Receiver " : "Detector ";
+        std::string msg = name + std::to_string(moduleIndex) +
+                          " returned error" + source + ": " + mess.c_str();
+        if (receiver) {
+            throw ReceiverError(msg);
+        }
+        throw DetectorError(msg);
+    };
+    applied = 0;
+    std::string server = hostname + ':' + std::to_string(port);
+    if (connection.noBatchServer == server) {
+        try {
+            for (const auto &command : batch) {
+                sendCommand<Socket>(
+                    connection, hostname, port, [&](ClientSocket &client) {
+                        client.Send(command.fnum);
+                        client.setFnum(command.fnum);
+                        client.Send(command.args);
+                        if (client.Receive<int>() == FAIL) {
+                            error(" for '" + command.source + "'",
+                                  client.readErrorMessage());
+                        }
+                        std::vector<char> retval(command.retval_size);
+                        client.Receive(retval);
+                    });
+                ++applied;
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(batchMutex);
+            for (size_t i = applied; i != batch.size(); ++i) {
+                skippedBatchSources.insert(batch[i].source);
+            }
+            throw;
+        }
+        return;
+    }
+
+    // one request: number of commands, then fnum, argument size, return
+    // value size and arguments of each
+    std::vector<char> request;
+    auto append = [&request](const void *data, size_t size) {
+        auto begin = static_cast<const char *>(data);
+        request.insert(request.end(), begin, begin + size);
+    };
+    auto ncommands = static_cast<int>(batch.size());
+    append(&ncommands, sizeof(ncommands));
+    for (const auto &command : batch) {
+        int header[]{command.fnum, static_cast<int>(command.args.size()),
+                     static_cast<int>(command.retval_size)};
+        append(header, sizeof(header));
+        append(command.args.data(), command.args.size());
+    }
+    LOG(logDEBUG1) << "Sending batch of " << ncommands << " commands to "
+                   << server;
+
+    bool unsupported = false;
+    try {
+        sendCommand<Socket>(
+            connection, hostname, port, [&](ClientSocket &client) {
+                client.Send(fnum);
+                client.setFnum(fnum);
+                client.Send(request);
+                if (client.Receive<int>() == FAIL) {
+                    std::string mess = client.readErrorMessage();
+                    if (mess.find(UNRECOGNIZED_FNUM_ENUM) !=
+                        std::string::npos) {
+                        unsupported = true;
+                        return;
+                    }
+                    error("", mess);
+                }
+                // results in order, up to the first failed command
+                std::vector<char> retval;
+                for (const auto &command : batch) {
+                    if (client.Receive<int>() == FAIL) {
+                        error(" for '" + command.source + "'",
+                              client.readErrorMessage());
+                    }
+                    retval.resize(command.retval_size);
+                    client.Receive(retval);
+                    ++applied;
+                }
+            });
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(batchMutex);
+        for (size_t i = applied; i != batch.size(); ++i) {
+            skippedBatchSources.insert(batch[i].source);
+        }
+        throw;
+    }
+    if (unsupported) {
+        // the request was not read by the server
+        {
+            std::lock_guard<std::mutex> lock(connection.mutex);
+            connection.socket.reset();
+        }
+        LOG(logINFO) << (receiver ? "Receiver " : "Detector ") << moduleIndex
+                     << " (" << server
+                     << ") does not support command batches, sending its "
+                        "commands one by one";
+        connection.noBatchServer = server;
+        sendCommandBatch<Socket>(connection, hostname, port, fnum, batch,
+                                 applied);
+    }
+}
+
+bool Module::getBatchCommands() const {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    return batchCommands;
+}
+
+void Module::setBatchCommands(bool enable) {
+    {
+        std::lock_guard<std::mutex> lock(batchMutex);
+        batchCommands = enable;
+        batchSource.clear();
+        if (enable) {
+            skippedBatchSources.clear();
+        }
+    }
+    if (!enable) {
+        flushCommandBatch();
+    }
+}
+
+void Module::setBatchSource(const std::string &source) {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    batchSource = source;
+}
+
+std::set<std::string> Module::getQueuedBatchSources() const {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    std::set<std::string> sources;
+    for (const auto &command : detectorBatch) {
+        sources.insert(command.source);
+    }
+    for (const auto &command : receiverBatch) {
+        sources.insert(command.source);
+    }
+    return sources;
+}
+
+std::set<std::string> Module::getSkippedBatchSources() const {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    return skippedBatchSources;
+}
+
+void Module::flushCommandBatch() const {
+    // held until sent, so that a command sent directly by another thread
+    // (which flushes first) waits for the batch instead of overtaking it
+    std::lock_guard<std::mutex> sendLock(batchSendMutex);
+    std::vector<BatchCommand> detector, receiver;
+    {
+        std::lock_guard<std::mutex> lock(batchMutex);
+        detector.swap(detectorBatch);
+        receiver.swap(receiverBatch);
+    }
+    std::exception_ptr error;
+    if (!detector.empty()) {
+        size_t applied = 0;
+        try {
+            sendCommandBatch<DetectorSocket>(
+                controlConnection, shm()->hostname, shm()->controlPort,
+                F_EXEC_COMMAND_BATCH, detector, applied);
+        } catch (...) {
+            error = std::current_exception();
+            // nor the receiver commands of the failed one or queued after it
+            const auto &failed =
+                detector[std::min(applied, detector.size() - 1)];
+            auto skip = [&failed](const BatchCommand &command) {
+                return command.sequence > failed.sequence ||
+                       command.source == failed.source;
+            };
+            std::lock_guard<std::mutex> lock(batchMutex);
+            for (const auto &command : receiver) {
+                if (skip(command)) {
+                    skippedBatchSources.insert(command.source);
+                }
+            }
+            receiver.erase(
+                std::remove_if(receiver.begin(), receiver.end(), skip),
+                receiver.end());
+        }
+    }
+    if (!receiver.empty()) {
+        try {
+            size_t applied = 0;
+            sendCommandBatch<ReceiverSocket>(
+                receiverConnection, shm()->rxHostname, shm()->rxTCPPort,
+                F_RECEIVER_EXEC_COMMAND_BATCH, receiver, applied);
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 void Module::sendToDetector(int fnum, const void *args, size_t args_size,
                             void *retval, size_t retval_size) const {
     // This is the only function that actually sends data to the detector
     // the other versions use templates to deduce sizes and create
     // the return type
     checkArgs(args, args_size, retval, retval_size);
-    auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
-    client.sendCommandThenRead(fnum, args, args_size, retval, retval_size);
-    client.close();
+    if (retval == nullptr &&
+        queueCommand(detectorBatch, fnum, args, args_size, 0)) {
+        return;
+    }
+    // also waits for a batch sent by another thread
+    flushCommandBatch();
+    sendCommand<DetectorSocket>(
+        controlConnection, shm()->hostname, shm()->controlPort,
+        [&](ClientSocket &client) {
+            client.sendCommandThenRead(fnum, args, args_size, retval,
+                                       retval_size);
+        });
 }
 
 void Module::sendToDetector(int fnum, const void *args, size_t args_size,
@@ -3058,9 +3498,14 @@ void Module::sendToDetectorStop(int fnum, const void *args, size_t args_size,
     // the other versions use templates to deduce sizes and create
     // the return type
     checkArgs(args, args_size, retval, retval_size);
-    auto stop = DetectorSocket(shm()->hostname, shm()->stopPort);
-    stop.sendCommandThenRead(fnum, args, args_size, retval, retval_size);
-    stop.close();
+    // stop server shares the state of the control server
+    flushCommandBatch();
+    sendCommand<DetectorSocket>(
+        stopConnection, shm()->hostname, shm()->stopPort,
+        [&](ClientSocket &client) {
+            client.sendCommandThenRead(fnum, args, args_size, retval,
+                                       retval_size);
+        });
 }
 
 void Module::sendToDetectorStop(int fnum, const void *args, size_t args_size,
@@ -3180,9 +3625,18 @@ void Module::sendToReceiver(int fnum, const void *args, size_t args_size,
         throw RuntimeError(oss.str());
     }
     checkArgs(args, args_size, retval, retval_size);
-    auto receiver = ReceiverSocket(shm()->rxHostname, shm()->rxTCPPort);
-    receiver.sendCommandThenRead(fnum, args, args_size, retval, retval_size);
-    receiver.close();
+    if (retval == nullptr &&
+        queueCommand(receiverBatch, fnum, args, args_size, 0)) {
+        return;
+    }
+    // also waits for a batch sent by another thread
+    flushCommandBatch();
+    sendCommand<ReceiverSocket>(
+        receiverConnection, shm()->rxHostname, shm()->rxTCPPort,
+        [&](ClientSocket &client) {
+            client.sendCommandThenRead(fnum, args, args_size, retval,
+                                       retval_size);
+        });
 }
 
 void Module::sendToReceiver(int fnum, const void *args, size_t args_size,
@@ -3285,6 +3739,27 @@ Ret Module::sendToReceiver(int fnum, const Arg &args) {
     return static_cast<const Module &>(*this).sendToReceiver<Ret>(fnum, args);
 }
 
+template <typename Ret, typename Arg>
+void Module::sendToDetectorIgnoreRetval(int fnum, const Arg &args) const {
+    STATIC_ASSERT_ARG(Arg, "sendToDetectorIgnoreRetval")
+    STATIC_ASSERT_ARG(Ret, "sendToDetectorIgnoreRetval")
+    if (!queueCommand(detectorBatch, fnum, &args, sizeof(args),
+                      sizeof(Ret))) {
+        sendToDetector<Ret>(fnum, args);
+    }
+}
+
+template <typename Ret, typename Arg>
+void Module::sendToReceiverIgnoreRetval(int fnum, const Arg &args) const {
+    STATIC_ASSERT_ARG(Arg, "sendToReceiverIgnoreRetval")
+    STATIC_ASSERT_ARG(Ret, "sendToReceiverIgnoreRetval")
+    if (!shm()->useReceiverFlag ||
+        !queueCommand(receiverBatch, fnum, &args, sizeof(args),
+                      sizeof(Ret))) {
+        sendToReceiver<Ret>(fnum, args);
+    }
+}
+
 slsDetectorDefs::detectorType Module::getDetectorTypeFromShm(int det_id,
                                                              bool verify) {
     if (!shm.exists()) {
@@ -3489,6 +3964,7 @@ void Module::setModule(sls_detector_module &module, bool trimbits) {
                    "these have been replaced with 0/200 or 2800/2400.";
         }
     }
+    flushCommandBatch();
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.Send(F_SET_MODULE);
     sendModule(&module, client);
@@ -3501,6 +3977,7 @@ void Module::setModule(sls_detector_module &module, bool trimbits) {
 sls_detector_module Module::getModule() {
     LOG(logDEBUG1) << "Getting module";
     sls_detector_module module(shm()->detType);
+    flushCommandBatch();
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.Send(F_GET_MODULE);
     if (client.Receive<int>() == FAIL) {
@@ -3842,6 +4319,7 @@ void Module::sendProgram(bool blackfin, std::vector<char> buffer,
                  << "): Sending " << functionType;
 
     // send fnum and filesize
+    flushCommandBatch();
     auto client = DetectorSocket(shm()->hostname, shm()->controlPort);
     client.Send(functionEnum);
     uint64_t filesize = buffer.size();
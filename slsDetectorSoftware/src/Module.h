@@ -10,8 +10,12 @@
 #include "sls/sls_detector_defs.h"
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <vector>
 
 namespace sls {
@@ -89,6 +93,25 @@ class Module : public virtual slsDetectorDefs {
     users! */
     void setHostname(const std::string &hostname, const bool initialChecks);
 
+    /** tcp connections to the servers kept open between commands of this
+     * process, one per server */
+    bool getPersistentConnections() const;
+    void setPersistentConnections(bool enable);
+
+    /** commands that do not need a reply from the server are queued and sent
+     * in one batch per server, once a command needs a reply or when
+     * disabled. Errors are thrown then, with the source of the command. */
+    bool getBatchCommands() const;
+    void setBatchCommands(bool enable);
+    /** eg. the config file line of the commands queued next */
+    void setBatchSource(const std::string &source);
+    void flushCommandBatch() const;
+    /** sources of the commands still queued */
+    std::set<std::string> getQueuedBatchSources() const;
+    /** sources of the commands of failed batches not applied (the failed
+     * one and those after it), since batching was enabled */
+    std::set<std::string> getSkippedBatchSources() const;
+
     int64_t getFirmwareVersion() const;
     int64_t getFrontEndFirmwareVersion(const fpgaPosition fpgaPosition) const;
     std::string getControlServerLongVersion() const;
@@ -292,6 +315,12 @@ class Module : public virtual slsDetectorDefs {
     void setReceiverPort(uint16_t port_number);
     int getReceiverFifoDepth() const;
     void setReceiverFifoDepth(int n_frames);
+    int getReceiverFifoHugePageSize() const;
+    void setReceiverFifoHugePageSize(int size_mb);
+    int getReceiverFifoNumaNode() const;
+    void setReceiverFifoNumaNode(int node);
+    int getReceiverProcessingThreads() const;
+    void setReceiverProcessingThreads(int n);
     bool getReceiverSilentMode() const;
     void setReceiverSilentMode(bool enable);
     frameDiscardPolicy getReceiverFramesDiscardPolicy() const;
@@ -301,10 +330,16 @@ class Module : public virtual slsDetectorDefs {
     int getReceiverUDPSocketBufferSize() const;
     int getReceiverRealUDPSocketBufferSize() const;
     void setReceiverUDPSocketBufferSize(int udpsockbufsize);
+    int getReceiverUDPBatchSize() const;
+    void setReceiverUDPBatchSize(int n_packets);
+    socketBackend getReceiverSocketBackend() const;
+    void setReceiverSocketBackend(socketBackend backend);
     bool getReceiverLock() const;
     void setReceiverLock(bool lock);
     IpAddr getReceiverLastClientIP() const;
     std::array<pid_t, NUM_RX_THREAD_IDS> getReceiverThreadIds() const;
+    std::string getReceiverThreadCpus() const;
+    void setReceiverThreadCpus(const std::string &cpus);
     bool getRxArping() const;
     void setRxArping(bool enable);
     defs::ROI getRxROI() const;
@@ -334,6 +369,12 @@ class Module : public virtual slsDetectorDefs {
     int getFramesPerFile() const;
     /** 0 will set frames per file to unlimited */
     void setFramesPerFile(int n_frames);
+    writeEngine getReceiverWriteEngine() const;
+    void setReceiverWriteEngine(writeEngine engine);
+    fileCompression getReceiverFileCompression() const;
+    void setReceiverFileCompression(fileCompression compression);
+    int getReceiverCompressionThreads() const;
+    void setReceiverCompressionThreads(int n);
 
     /**************************************************
      *                                                *
@@ -359,6 +400,15 @@ class Module : public virtual slsDetectorDefs {
     void setClientStreamingIP(const IpAddr ip);
     int getReceiverStreamingHwm() const;
     void setReceiverStreamingHwm(const int limit);
+    fileCompression getReceiverStreamingCompression() const;
+    void setReceiverStreamingCompression(fileCompression compression);
+    int getReceiverStreamingCompressionLevel() const;
+    void setReceiverStreamingCompressionLevel(int level);
+    zmqHeaderFormat getReceiverStreamingHeaderFormat() const;
+    void setReceiverStreamingHeaderFormat(zmqHeaderFormat format);
+    zmqStreamingPolicy getReceiverStreamingPolicy() const;
+    void setReceiverStreamingPolicy(zmqStreamingPolicy policy);
+    std::vector<streamingStatistics> getReceiverStreamingStatistics() const;
 
     /**************************************************
      *                                                *
@@ -612,8 +662,48 @@ class Module : public virtual slsDetectorDefs {
     int64_t getMeasurementTime() const;
 
   private:
+    /** kept open between commands */
+    struct Connection {
+        std::mutex mutex;
+        std::unique_ptr<ClientSocket> socket;
+        std::string hostname;
+        uint16_t port{0};
+        /** server (hostname:port) that does not know the batch commands
+         * (eg. 8.0.x), its commands are sent one by one. Guarded by
+         * batchSendMutex */
+        std::string noBatchServer;
+    };
+
     std::string getReceiverLongVersion() const;
 
+    /** command queued for a batch */
+    struct BatchCommand {
+        int fnum;
+        std::vector<char> args;
+        size_t retval_size;
+        std::string source;
+        /** order of queueing, in both batches */
+        uint64_t sequence;
+    };
+
+    /** one connection per command, or the one kept open (if not in use by
+     * another thread) */
+    template <class Socket, class Command>
+    void sendCommand(Connection &connection, const std::string &hostname,
+                     uint16_t port, Command command) const;
+
+    /** false if not batching, command has to be sent now */
+    bool queueCommand(std::vector<BatchCommand> &batch, int fnum,
+                      const void *args, size_t args_size,
+                      size_t retval_size) const;
+
+    /** applied: number of commands applied, also if it throws */
+    template <class Socket>
+    void sendCommandBatch(Connection &connection, const std::string &hostname,
+                          uint16_t port, int fnum,
+                          const std::vector<BatchCommand> &batch,
+                          size_t &applied) const;
+
     void checkArgs(const void *args, size_t args_size, void *retval,
                    size_t retval_size) const;
 
@@ -739,6 +829,14 @@ class Module : public virtual slsDetectorDefs {
     template <typename Ret, typename Arg>
     Ret sendToReceiver(int fnum, const Arg &args) const;
 
+    /** for setters that do not use the value returned by the server, so
+     * that they can be batched */
+    template <typename Ret, typename Arg>
+    void sendToDetectorIgnoreRetval(int fnum, const Arg &args) const;
+
+    template <typename Ret, typename Arg>
+    void sendToReceiverIgnoreRetval(int fnum, const Arg &args) const;
+
     /** Get Detector Type from Shared Memory
     verify is if shm size matches existing one */
     detectorType getDetectorTypeFromShm(int det_id, bool verify = true);
@@ -802,6 +900,19 @@ class Module : public virtual slsDetectorDefs {
 
     const int moduleIndex;
     mutable SharedMemory<sharedModule> shm{0, 0};
+    std::atomic<bool> persistentConnections{false};
+    mutable Connection controlConnection;
+    mutable Connection stopConnection;
+    mutable Connection receiverConnection;
+    mutable std::mutex batchMutex;
+    /** taken before batchMutex */
+    mutable std::mutex batchSendMutex;
+    bool batchCommands{false};
+    std::string batchSource;
+    mutable std::vector<BatchCommand> detectorBatch;
+    mutable std::vector<BatchCommand> receiverBatch;
+    mutable std::set<std::string> skippedBatchSources;
+    mutable uint64_t batchSequence{0};
     static const int BLACKFIN_ERASE_FLASH_TIME = 65;
     static const int BLACKFIN_WRITE_TO_FLASH_TIME = 30;
     static const int NIOS_ERASE_FLASH_TIME_FPGA = 10;
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "ModuleWorkers.h"
+#include "sls/container_utils.h"
+
+namespace sls {
+
+constexpr size_t ModuleWorkers::MAX_OVERFLOW_THREADS;
+
+ModuleWorkers::~ModuleWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(overflowMutex);
+        killOverflow = true;
+    }
+    overflowCv.notify_all();
+    for (auto &thread : overflowThreads) {
+        thread.join();
+    }
+    for (auto &worker : workers) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->kill = true;
+        }
+        worker->cv.notify_one();
+        worker->thread.join();
+    }
+}
+
+size_t ModuleWorkers::Size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return workers.size();
+}
+
+size_t ModuleWorkers::OverflowSize() const {
+    std::lock_guard<std::mutex> lock(overflowMutex);
+    return overflowThreads.size();
+}
+
+void ModuleWorkers::Post(size_t module, Task task) {
+    Worker &worker = GetWorker(module);
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.busy) {
+            worker.busy = true;
+            worker.task = std::move(task);
+            worker.cv.notify_one();
+            return;
+        }
+    }
+    PostOverflow(std::move(task));
+}
+
+void ModuleWorkers::PostOverflow(Task task) {
+    std::lock_guard<std::mutex> lock(overflowMutex);
+    overflowTasks.push_back(std::move(task));
+    // every queued task needs an idle thread of its own
+    if (overflowTasks.size() > idleOverflowThreads &&
+        overflowThreads.size() < MAX_OVERFLOW_THREADS) {
+        overflowThreads.emplace_back(&ModuleWorkers::OverflowThread, this);
+    } else {
+        overflowCv.notify_one();
+    }
+}
+
+ModuleWorkers::Worker &ModuleWorkers::GetWorker(size_t module) {
+    std::lock_guard<std::mutex> lock(mutex);
+    while (workers.size() <= module) {
+        workers.push_back(make_unique<Worker>());
+        workers.back()->thread =
+            std::thread(&ModuleWorkers::WorkerThread, workers.back().get());
+    }
+    return *workers[module];
+}
+
+void ModuleWorkers::WorkerThread(Worker *worker) {
+    std::unique_lock<std::mutex> lock(worker->mutex);
+    while (true) {
+        worker->cv.wait(lock,
+                        [worker]() { return worker->busy || worker->kill; });
+        if (!worker->busy) {
+            return;
+        }
+        Task task = std::move(worker->task);
+        lock.unlock();
+        task.execute();
+        lock.lock();
+        worker->busy = false;
+        lock.unlock();
+        task.complete();
+        lock.lock();
+    }
+}
+
+void ModuleWorkers::OverflowThread() {
+    std::unique_lock<std::mutex> lock(overflowMutex);
+    ++idleOverflowThreads;
+    while (true) {
+        overflowCv.wait(lock, [this]() {
+            return !overflowTasks.empty() || killOverflow;
+        });
+        --idleOverflowThreads;
+        // queued calls still run when destroyed
+        if (overflowTasks.empty()) {
+            return;
+        }
+        Task task = std::move(overflowTasks.front());
+        overflowTasks.pop_front();
+        lock.unlock();
+        task.execute();
+        // idle before the caller gets the result (as the module threads)
+        lock.lock();
+        ++idleOverflowThreads;
+        lock.unlock();
+        task.complete();
+        lock.lock();
+    }
+}
+
+} // namespace sls
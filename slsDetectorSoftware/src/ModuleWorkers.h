@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sls {
+
+/**
+ * Persistent threads that run the calls of DetectorImpl::Parallel, one per
+ * module (created at its first call), instead of a new thread per module and
+ * call.
+ */
+class ModuleWorkers {
+  public:
+    ModuleWorkers() = default;
+    ModuleWorkers(const ModuleWorkers &) = delete;
+    ModuleWorkers &operator=(const ModuleWorkers &) = delete;
+    /** waits for running calls */
+    ~ModuleWorkers();
+
+    /**
+     * Calls func in the thread of the module. If that one is busy (a call
+     * from another thread, eg. a blocking acquire, or a nested call), func
+     * runs in an idle overflow thread, or a new one up to
+     * MAX_OVERFLOW_THREADS, so that calls do not wait for each other. Beyond
+     * that, func is queued for the next free overflow thread.
+     * Exceptions are passed on by the future.
+     */
+    template <typename RT>
+    std::future<RT> Run(size_t module, std::function<RT()> func) {
+        auto call = std::make_shared<Call<RT>>(std::move(func));
+        auto future = call->promise.get_future();
+        Post(module, Task{[call]() { call->Execute(); },
+                          [call]() { call->Complete(); }});
+        return future;
+    }
+
+    /** module threads created */
+    size_t Size() const;
+    /** overflow threads created */
+    size_t OverflowSize() const;
+
+    static constexpr size_t MAX_OVERFLOW_THREADS = 64;
+
+  private:
+    template <typename RT> struct Call {
+        explicit Call(std::function<RT()> f) : func(std::move(f)) {}
+        void Execute() {
+            try {
+                value.reset(new RT(func()));
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+        void Complete() {
+            if (error) {
+                promise.set_exception(error);
+            } else {
+                promise.set_value(std::move(*value));
+            }
+        }
+        std::function<RT()> func;
+        std::promise<RT> promise;
+        std::unique_ptr<RT> value;
+        std::exception_ptr error;
+    };
+
+    /** the worker is free again before the caller gets the result, so that
+     * consecutive calls of a thread run in the same worker */
+    struct Task {
+        std::function<void()> execute;
+        std::function<void()> complete;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::condition_variable cv;
+        Task task;
+        bool busy{false};
+        bool kill{false};
+        std::thread thread;
+    };
+
+    void Post(size_t module, Task task);
+    void PostOverflow(Task task);
+    Worker &GetWorker(size_t module);
+    static void WorkerThread(Worker *worker);
+    void OverflowThread();
+
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    /** calls of busy modules, shared by the overflow threads */
+    mutable std::mutex overflowMutex;
+    std::condition_variable overflowCv;
+    std::deque<Task> overflowTasks;
+    size_t idleOverflowThreads{0};
+    bool killOverflow{false};
+    std::vector<std::thread> overflowThreads;
+};
+
+template <> struct ModuleWorkers::Call<void> {
+    explicit Call(std::function<void()> f) : func(std::move(f)) {}
+    void Execute() {
+        try {
+            func();
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    void Complete() {
+        if (error) {
+            promise.set_exception(error);
+        } else {
+            promise.set_value();
+        }
+    }
+    std::function<void()> func;
+    std::promise<void> promise;
+    std::exception_ptr error;
+};
+
+} // namespace sls
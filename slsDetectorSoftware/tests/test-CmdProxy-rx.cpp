@@ -283,6 +283,84 @@ TEST_CASE("rx_fifodepth", "[.cmd][.rx]") {
     }
 }
 
+TEST_CASE("rx_fifohugepage", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxFifoHugePageSize();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_fifohugepage", {"2"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_fifohugepage 2\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_fifohugepage", {}, -1, GET, oss);
+        // normal pages if no huge pages are reserved
+        REQUIRE((oss.str() == "rx_fifohugepage 2\n" ||
+                 oss.str() == "rx_fifohugepage 0\n"));
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_fifohugepage", {"0"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_fifohugepage 0\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_fifohugepage", {"4"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxFifoHugePageSize(prev_val[i], {i});
+    }
+}
+
+TEST_CASE("rx_fifonumanode", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxFifoNumaNode();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_fifonumanode", {"0"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_fifonumanode 0\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_fifonumanode", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_fifonumanode 0\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_fifonumanode", {"-1"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_fifonumanode -1\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_fifonumanode", {"-2"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxFifoNumaNode(prev_val[i], {i});
+    }
+}
+
+TEST_CASE("rx_processingthreads", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxProcessingThreads();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_processingthreads", {"4"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_processingthreads 4\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_processingthreads", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_processingthreads 4\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_processingthreads", {"1"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_processingthreads 1\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_processingthreads", {"0"}, -1, PUT));
+    REQUIRE_THROWS(proxy.Call("rx_processingthreads", {"65"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxProcessingThreads(prev_val[i], {i});
+    }
+}
+
 TEST_CASE("rx_silent", "[.cmd][.rx]") {
     Detector det;
     CmdProxy proxy(&det);
@@ -399,6 +477,57 @@ TEST_CASE("rx_realudpsocksize", "[.cmd][.rx]") {
     }
 }
 
+TEST_CASE("rx_udpbatchsize", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxUDPBatchSize();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_udpbatchsize", {"64"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_udpbatchsize 64\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_udpbatchsize", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_udpbatchsize 64\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_udpbatchsize", {"1"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_udpbatchsize 1\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_udpbatchsize", {"0"}, -1, PUT));
+    REQUIRE_THROWS(proxy.Call("rx_udpbatchsize", {"1025"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxUDPBatchSize(prev_val[i], {i});
+    }
+}
+
+TEST_CASE("rx_socketbackend", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxSocketBackend();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_socketbackend", {"packetmmap"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_socketbackend packetmmap\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_socketbackend", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_socketbackend packetmmap\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_socketbackend", {"socket"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_socketbackend socket\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_socketbackend", {"dpdk"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxSocketBackend(prev_val[i], {i});
+    }
+}
+
 TEST_CASE("rx_lock", "[.cmd][.rx]") {
     Detector det;
     CmdProxy proxy(&det);
@@ -440,6 +569,24 @@ TEST_CASE("rx_threads", "[.cmd][.rx]") {
     REQUIRE_NOTHROW(proxy.Call("rx_threads", {}, -1, GET, oss));
 }
 
+TEST_CASE("rx_cpus", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_cpus", {"0", "0", "0"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_cpus 0 0 0\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_cpus", {}, -1, GET, oss);
+        REQUIRE(oss.str().rfind("rx_cpus 0 0 0", 0) == 0);
+    }
+    REQUIRE_THROWS(proxy.Call("rx_cpus", {"3-1"}, -1, PUT));
+    REQUIRE_NOTHROW(proxy.Call("rx_cpus", {"auto"}, -1, PUT));
+    REQUIRE_NOTHROW(proxy.Call("rx_cpus", {"-"}, -1, PUT));
+}
+
 TEST_CASE("rx_arping", "[.cmd][.rx]") {
     Detector det;
     CmdProxy proxy(&det);
@@ -736,6 +883,82 @@ TEST_CASE("rx_framesperfile", "[.cmd][.rx]") {
     }
 }
 
+TEST_CASE("rx_writeengine", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxWriteEngine();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_writeengine", {"iouring"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_writeengine iouring\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_writeengine", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_writeengine iouring\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_writeengine", {"iothread"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_writeengine iothread\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_writeengine", {"aio"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxWriteEngine(prev_val[i], {i});
+    }
+}
+
+TEST_CASE("rx_compression", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxFileCompression();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_compression", {"shuffledeflate"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_compression shuffledeflate\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_compression", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_compression shuffledeflate\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_compression", {"none"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_compression none\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_compression", {"lz4"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxFileCompression(prev_val[i], {i});
+    }
+}
+
+TEST_CASE("rx_compressionthreads", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxCompressionThreads();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_compressionthreads", {"8"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_compressionthreads 8\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_compressionthreads", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_compressionthreads 8\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_compressionthreads", {"1"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_compressionthreads 1\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_compressionthreads", {"0"}, -1, PUT));
+    REQUIRE_THROWS(proxy.Call("rx_compressionthreads", {"65"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxCompressionThreads(prev_val[i], {i});
+    }
+}
+
 /* ZMQ Streaming Parameters (Receiver<->Client) */
 
 TEST_CASE("rx_zmqstream", "[.cmd][.rx]") {
@@ -909,6 +1132,112 @@ TEST_CASE("rx_zmqhwm", "[.cmd]") {
     det.setRxZmqHwm(prev_val);
 }
 
+TEST_CASE("rx_zmqcompression", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxZmqCompression();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_zmqcompression", {"shuffledeflate"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_zmqcompression shuffledeflate\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_zmqcompression", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_zmqcompression shuffledeflate\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_zmqcompression", {"none"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_zmqcompression none\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_zmqcompression", {"zstd"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxZmqCompression(prev_val[i], {i});
+    }
+}
+
+TEST_CASE("rx_zmqheader", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxZmqHeaderFormat();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_zmqheader", {"binary"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_zmqheader binary\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_zmqheader", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_zmqheader binary\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_zmqheader", {"json"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_zmqheader json\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_zmqheader", {"xml"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxZmqHeaderFormat(prev_val[i], {i});
+    }
+}
+
+TEST_CASE("rx_zmqpolicy", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxZmqPolicy();
+    for (const std::string policy :
+         {"dropnewest", "dropoldest", "keeplatest", "block"}) {
+        {
+            std::ostringstream oss;
+            proxy.Call("rx_zmqpolicy", {policy}, -1, PUT, oss);
+            REQUIRE(oss.str() == "rx_zmqpolicy " + policy + "\n");
+        }
+        {
+            std::ostringstream oss;
+            proxy.Call("rx_zmqpolicy", {}, -1, GET, oss);
+            REQUIRE(oss.str() == "rx_zmqpolicy " + policy + "\n");
+        }
+    }
+    REQUIRE_THROWS(proxy.Call("rx_zmqpolicy", {"drop"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxZmqPolicy(prev_val[i], {i});
+    }
+}
+
+TEST_CASE("rx_zmqstats", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    REQUIRE_NOTHROW(proxy.Call("rx_zmqstats", {}, -1, GET));
+    REQUIRE_THROWS(proxy.Call("rx_zmqstats", {"0"}, -1, PUT));
+}
+
+TEST_CASE("rx_zmqcomplevel", "[.cmd][.rx]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    auto prev_val = det.getRxZmqCompressionLevel();
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_zmqcomplevel", {"9"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_zmqcomplevel 9\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_zmqcomplevel", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "rx_zmqcomplevel 9\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("rx_zmqcomplevel", {"1"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "rx_zmqcomplevel 1\n");
+    }
+    REQUIRE_THROWS(proxy.Call("rx_zmqcomplevel", {"0"}, -1, PUT));
+    REQUIRE_THROWS(proxy.Call("rx_zmqcomplevel", {"10"}, -1, PUT));
+    for (int i = 0; i != det.size(); ++i) {
+        det.setRxZmqCompressionLevel(prev_val[i], {i});
+    }
+}
+
 /* CTB Specific */
 
 TEST_CASE("rx_dbitlist", "[.cmd][.rx]") {
@@ -7,7 +7,12 @@
 #include "sls/sls_detector_defs.h"
 #include "test-CmdProxy-global.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <numeric>
 #include <sstream>
 #include <thread>
 
@@ -28,6 +33,16 @@ TEST_CASE("Calling help doesn't throw or cause segfault") {
             proxy.Call(cmd, {}, -1, slsDetectorDefs::HELP_ACTION, os));
 }
 
+TEST_CASE("Detector wide commands are commands") {
+    CmdProxy proxy(nullptr);
+    auto commands = proxy.GetProxyCommands();
+    for (const auto &cmd : CmdProxy::GetDetectorWideCommands()) {
+        CAPTURE(cmd);
+        CHECK(std::find(commands.begin(), commands.end(), cmd) !=
+              commands.end());
+    }
+}
+
 TEST_CASE("Unknown command", "[.cmd]") {
     Detector det;
     CmdProxy proxy(&det);
@@ -71,6 +86,86 @@ TEST_CASE("parameters", "[.cmd]") {
         */
 }
 
+TEST_CASE("loadParameters with batched commands", "[.cmd]") {
+    Detector det;
+    auto prev_timing = det.getTimingMode();
+    auto prev_frames = det.getNumberOfFrames().tsquash(
+        "Number of frames has to be same to test");
+    det.loadParameters(std::vector<std::string>{"timing trigger", "frames 3",
+                                                "timing auto"});
+    REQUIRE(det.getTimingMode().squash() == defs::AUTO_TIMING);
+    REQUIRE(det.getNumberOfFrames().squash() == 3);
+    // error of a batched command reported with its line
+    try {
+        det.loadParameters(
+            std::vector<std::string>{"timing auto", "timing burst_trigger"});
+        REQUIRE(det.getTimingMode().squash() == defs::BURST_TRIGGER);
+    } catch (const RuntimeError &e) {
+        REQUIRE(std::string(e.what()).find("timing burst_trigger") !=
+                std::string::npos);
+    }
+    for (int i = 0; i != det.size(); ++i) {
+        det.setTimingMode(prev_timing[i], {i});
+    }
+    det.setNumberOfFrames(prev_frames);
+}
+
+TEST_CASE("loadParameters with module specific lines", "[.cmd]") {
+    Detector det;
+    auto prev_timing = det.getTimingMode();
+    auto prev_frames = det.getNumberOfFrames().tsquash(
+        "Number of frames has to be same to test");
+    // runs of module specific lines between global lines
+    std::vector<std::string> parameters{"frames 2"};
+    for (int i = 0; i != det.size(); ++i) {
+        parameters.push_back(std::to_string(i) + ":timing trigger");
+    }
+    parameters.push_back("frames 3");
+    for (int i = det.size() - 1; i >= 0; --i) {
+        parameters.push_back(std::to_string(i) + ":timing auto");
+        parameters.push_back(std::to_string(i) + ":timing trigger");
+    }
+    det.loadParameters(parameters);
+    REQUIRE(det.getTimingMode().squash() == defs::TRIGGER_EXPOSURE);
+    REQUIRE(det.getNumberOfFrames().squash() == 3);
+    for (int i = 0; i != det.size(); ++i) {
+        det.setTimingMode(prev_timing[i], {i});
+    }
+    det.setNumberOfFrames(prev_frames);
+}
+
+TEST_CASE("loadConfig of a file starting with hostname", "[.cmd]") {
+    Detector det;
+    auto prev_frames = det.getNumberOfFrames().tsquash(
+        "Number of frames has to be same to test");
+    bool receiver = det.getUseReceiverFlag().squash(false);
+    std::ostringstream hostname, rx_hostname;
+    hostname << "hostname ";
+    rx_hostname << "rx_hostname ";
+    for (int i = 0; i != det.size(); ++i) {
+        hostname << det.getHostname({i})[0] << ':'
+                 << det.getControlPort({i})[0] << '+';
+        if (receiver) {
+            rx_hostname << det.getRxHostname({i})[0] << ':'
+                        << det.getRxPort({i})[0] << '+';
+        }
+    }
+    // shared memory freed first, no modules when batching starts
+    std::string fname = "/tmp/sls_test_hostname.config";
+    {
+        std::ofstream file(fname);
+        file << hostname.str() << '\n';
+        if (receiver) {
+            file << rx_hostname.str() << '\n';
+        }
+        file << "frames 5\n";
+    }
+    det.loadConfig(fname);
+    REQUIRE(det.getNumberOfFrames().squash() == 5);
+    det.setNumberOfFrames(prev_frames);
+    std::remove(fname.c_str());
+}
+
 TEST_CASE("hostname", "[.cmd]") {
     Detector det;
     CmdProxy proxy(&det);
@@ -85,6 +180,34 @@ TEST_CASE("virtual", "[.cmd]") {
     REQUIRE_THROWS(proxy.Call("virtual", {"3", "65534"}, -1, PUT));
 }
 
+TEST_CASE("persistentconnections", "[.cmd]") {
+    Detector det;
+    CmdProxy proxy(&det);
+    {
+        std::ostringstream oss;
+        proxy.Call("persistentconnections", {"1"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "persistentconnections 1\n");
+    }
+    // commands on the connections kept open
+    for (int i = 0; i != 3; ++i) {
+        REQUIRE_NOTHROW(proxy.Call("frames", {}, -1, GET));
+        if (det.getUseReceiverFlag().squash(false)) {
+            REQUIRE_NOTHROW(proxy.Call("rx_status", {}, -1, GET));
+        }
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("persistentconnections", {}, -1, GET, oss);
+        REQUIRE(oss.str() == "persistentconnections 1\n");
+    }
+    {
+        std::ostringstream oss;
+        proxy.Call("persistentconnections", {"0"}, -1, PUT, oss);
+        REQUIRE(oss.str() == "persistentconnections 0\n");
+    }
+    REQUIRE_THROWS(proxy.Call("persistentconnections", {"1"}, 0, PUT));
+}
+
 TEST_CASE("versions", "[.cmd]") {
     Detector det;
     CmdProxy proxy(&det);
@@ -3542,4 +3665,22 @@ TEST_CASE("user", "[.cmd]") {
     REQUIRE_NOTHROW(proxy.Call("user", {}, -1, GET));
 }
 
+TEST_CASE("Benchmark command round trip against number of modules",
+          "[.cmd][.bench]") {
+    Detector det;
+    constexpr int nCalls = 200;
+    for (int nModules = 1; nModules <= det.size(); nModules *= 2) {
+        std::vector<int> pos(nModules);
+        std::iota(pos.begin(), pos.end(), 0);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i != nCalls; ++i) {
+            det.getNumberOfFrames(pos);
+        }
+        std::chrono::duration<double> t =
+            std::chrono::steady_clock::now() - start;
+        std::cout << nModules << " modules: " << t.count() * 1e6 / nCalls
+                  << " us/command\n";
+    }
+}
+
 } // namespace sls
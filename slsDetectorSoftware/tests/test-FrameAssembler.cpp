@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "FrameAssembler.h"
+#include "catch.hpp"
+#include "sls/sls_detector_defs.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace sls {
+
+constexpr uint32_t partSize = 16;
+
+using defs = slsDetectorDefs;
+
+struct AssembledFrame {
+    uint64_t frameIndex;
+    uint32_t expLength;
+    bool complete;
+    std::vector<char> data;
+};
+
+// each part sends its frames in its own thread, filling its place with the
+// part index. expLength of each part (default 0) with detector type and
+// dynamic range of the header
+std::vector<AssembledFrame>
+assemble(const std::vector<std::vector<uint64_t>> &frames,
+         const std::vector<uint32_t> &expLength = {},
+         defs::detectorType detType = defs::JUNGFRAU,
+         uint32_t dynamicRange = 16) {
+    FrameAssembler assembler(frames.size());
+    std::vector<std::thread> threads;
+    for (size_t part = 0; part != frames.size(); ++part) {
+        threads.emplace_back([&, part]() {
+            auto it = frames[part].begin();
+            while (it != frames[part].end()) {
+                zmqHeader header;
+                header.imageSize = partSize;
+                header.frameIndex = *it;
+                header.completeImage = true;
+                header.expLength = expLength.empty() ? 0 : expLength[part];
+                header.detType = static_cast<uint8_t>(detType);
+                header.dynamicRange = dynamicRange;
+                char *frame = assembler.Arrive(part, header);
+                if (frame != nullptr) {
+                    memset(frame + part * partSize, static_cast<int>(part),
+                           partSize);
+                    ++it;
+                }
+                assembler.Done(part);
+            }
+            assembler.Stop(part);
+        });
+    }
+    std::vector<AssembledFrame> result;
+    FrameAssembler::Frame frame;
+    while (assembler.Next(frame)) {
+        result.push_back(AssembledFrame{
+            frame.header.frameIndex, frame.header.expLength, frame.complete,
+            std::vector<char>(frame.data, frame.data + frame.size)});
+        assembler.Release();
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    return result;
+}
+
+TEST_CASE("Parts of the same frame assembled into one frame") {
+    auto result = assemble({{0, 1, 2}, {0, 1, 2}, {0, 1, 2}});
+    REQUIRE(result.size() == 3);
+    for (uint64_t i = 0; i != 3; ++i) {
+        CHECK(result[i].frameIndex == i);
+        CHECK(result[i].complete);
+        REQUIRE(result[i].data.size() == 3 * partSize);
+        for (size_t part = 0; part != 3; ++part) {
+            CHECK(result[i].data[part * partSize] == static_cast<char>(part));
+            CHECK(result[i].data[(part + 1) * partSize - 1] ==
+                  static_cast<char>(part));
+        }
+    }
+}
+
+TEST_CASE("Part missing a frame keeps its next frame for later") {
+    auto result = assemble({{0, 1, 2, 3}, {0, 2, 3}});
+    REQUIRE(result.size() == 4);
+    for (uint64_t i = 0; i != 4; ++i) {
+        CHECK(result[i].frameIndex == i);
+    }
+    CHECK(result[0].complete);
+    CHECK_FALSE(result[1].complete);
+    // missing part not written
+    CHECK(result[1].data[0] == 0);
+    CHECK(result[1].data[partSize] == static_cast<char>(0xFF));
+    CHECK(result[2].complete);
+    CHECK(result[2].data[partSize] == 1);
+    CHECK(result[3].complete);
+}
+
+TEST_CASE("Frames incomplete after a part stopped") {
+    auto result = assemble({{0, 1, 2}, {0}});
+    REQUIRE(result.size() == 3);
+    CHECK(result[0].complete);
+    CHECK_FALSE(result[1].complete);
+    CHECK_FALSE(result[2].complete);
+    CHECK(result[2].data[0] == 0);
+    CHECK(result[2].data[partSize] == static_cast<char>(0xFF));
+}
+
+TEST_CASE("Parts with a different exposure time assembled into one frame") {
+    auto result = assemble({{0, 1}, {0, 1}}, {100, 200});
+    REQUIRE(result.size() == 2);
+    for (uint64_t i = 0; i != 2; ++i) {
+        CHECK(result[i].frameIndex == i);
+        CHECK(result[i].complete);
+        CHECK(result[i].data[0] == 0);
+        CHECK(result[i].data[partSize] == 1);
+    }
+}
+
+TEST_CASE("Sub frames of eiger 32 bit are matched by sub frame index") {
+    // same frame index, but different sub frames
+    auto result = assemble({{0}, {0}}, {0, 1}, defs::EIGER, 32);
+    REQUIRE(result.size() == 2);
+    CHECK(result[0].expLength == 0);
+    CHECK_FALSE(result[0].complete);
+    CHECK(result[0].data[0] == 0);
+    CHECK(result[0].data[partSize] == static_cast<char>(0xFF));
+    CHECK(result[1].expLength == 1);
+    CHECK_FALSE(result[1].complete);
+    CHECK(result[1].data[partSize] == 1);
+}
+
+TEST_CASE("No frames if all parts stopped") {
+    auto result = assemble({{}, {}});
+    CHECK(result.empty());
+}
+
+} // namespace sls
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "ModuleWorkers.h"
+#include "catch.hpp"
+#include "sls/sls_detector_exceptions.h"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace sls {
+
+TEST_CASE("Calls of a module run in its persistent thread") {
+    ModuleWorkers workers;
+    std::vector<std::thread::id> ids;
+    for (int call = 0; call != 3; ++call) {
+        std::vector<std::future<std::thread::id>> futures;
+        for (size_t module = 0; module != 4; ++module) {
+            futures.push_back(workers.Run<std::thread::id>(
+                module, []() { return std::this_thread::get_id(); }));
+        }
+        for (size_t module = 0; module != 4; ++module) {
+            auto id = futures[module].get();
+            CHECK(id != std::this_thread::get_id());
+            if (call == 0) {
+                ids.push_back(id);
+            } else {
+                CHECK(id == ids[module]);
+            }
+        }
+    }
+    CHECK(workers.Size() == 4);
+}
+
+TEST_CASE("Exceptions of a module call are passed to the caller") {
+    ModuleWorkers workers;
+    auto ok = workers.Run<int>(0, []() { return 5; });
+    auto fails = workers.Run<int>(
+        1, []() -> int { throw RuntimeError("module failed"); });
+    auto failsVoid =
+        workers.Run<void>(2, []() { throw RuntimeError("module failed"); });
+    CHECK(ok.get() == 5);
+    REQUIRE_THROWS_AS(fails.get(), RuntimeError);
+    REQUIRE_THROWS_AS(failsVoid.get(), RuntimeError);
+    // worker still usable
+    CHECK(workers.Run<int>(1, []() { return 3; }).get() == 3);
+}
+
+TEST_CASE("Call of a busy module does not wait for the running one") {
+    ModuleWorkers workers;
+    std::promise<void> release;
+    auto blocked = workers.Run<void>(
+        0, [&release]() { release.get_future().wait(); });
+    auto other = workers.Run<int>(0, []() { return 7; });
+    REQUIRE(other.wait_for(std::chrono::seconds(5)) ==
+            std::future_status::ready);
+    CHECK(other.get() == 7);
+    release.set_value();
+    blocked.get();
+}
+
+TEST_CASE("Calls of busy modules reuse a bounded set of overflow threads") {
+    ModuleWorkers workers;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    auto blocked =
+        workers.Run<void>(0, [released]() { released.wait(); });
+    for (int call = 0; call != 10; ++call) {
+        CHECK(workers.Run<int>(0, []() { return 7; }).get() == 7);
+    }
+    CHECK(workers.OverflowSize() == 1);
+
+    // more blocking calls than overflow threads are queued, not dropped
+    const size_t nCalls = ModuleWorkers::MAX_OVERFLOW_THREADS + 4;
+    std::vector<std::future<void>> futures;
+    for (size_t call = 0; call != nCalls; ++call) {
+        futures.push_back(
+            workers.Run<void>(0, [released]() { released.wait(); }));
+    }
+    CHECK(workers.OverflowSize() == ModuleWorkers::MAX_OVERFLOW_THREADS);
+    release.set_value();
+    for (auto &f : futures) {
+        REQUIRE(f.wait_for(std::chrono::seconds(5)) ==
+                std::future_status::ready);
+    }
+    blocked.get();
+}
+
+/** calls per second of a no-op call on all modules */
+template <typename Launch>
+double callRate(size_t nModules, size_t nCalls, Launch launch) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t call = 0; call != nCalls; ++call) {
+        std::vector<std::future<int>> futures;
+        for (size_t module = 0; module != nModules; ++module) {
+            futures.push_back(launch(module));
+        }
+        for (auto &f : futures) {
+            f.get();
+        }
+    }
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    return nCalls / t.count();
+}
+
+TEST_CASE("Benchmark module workers against a thread per call",
+          "[.bench]") {
+    constexpr size_t nCalls = 2000;
+    for (size_t nModules : {1, 2, 4, 8, 16, 32}) {
+        ModuleWorkers workers;
+        auto pool = callRate(nModules, nCalls, [&workers](size_t module) {
+            return workers.Run<int>(module, [module]() { return (int)module; });
+        });
+        auto async = callRate(nModules, nCalls, [](size_t module) {
+            return std::async(std::launch::async,
+                              [module]() { return (int)module; });
+        });
+        std::cout << nModules << " modules: workers " << 1e6 / pool
+                  << " us/call, thread per module " << 1e6 / async
+                  << " us/call\n";
+    }
+}
+
+} // namespace sls
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#pragma once
+/* SpscRing.h
+ * Lock-free replacement of CircularFifo without semaphore operations on
+ * every push and pop. A thread that has to wait (full or empty) spins
+ * first, then yields and only then parks on a condition variable, which
+ * the other side notifies only if someone is parked.
+ * */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sls {
+
+/** Ring of pointers
+ * Thread safe for one reader, and one writer */
+template <typename Element> class SpscRing {
+  private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    static constexpr int SPIN_COUNT = 1000;
+    static constexpr int YIELD_COUNT = 100;
+
+    const size_t capacity;
+    const size_t mask;
+    std::vector<Element *> data;
+    // indices only ever increase, (index & mask) is the slot
+
+    // padding keeps consumer and producer on their own cache lines
+    char padData[CACHE_LINE_SIZE];
+    /** consumer side, with its last seen tail */
+    std::atomic<size_t> head{0};
+    size_t tailCache{0};
+    char padHead[CACHE_LINE_SIZE];
+    /** producer side, with its last seen head */
+    std::atomic<size_t> tail{0};
+    size_t headCache{0};
+    char padTail[CACHE_LINE_SIZE];
+
+    std::atomic<bool> consumerParked{false};
+    std::atomic<bool> producerParked{false};
+    std::mutex parkMutex;
+    std::condition_variable dataReady;
+    std::condition_variable freeReady;
+
+    static size_t storageSize(size_t size);
+    template <typename Ready>
+    void wait(Ready ready, std::atomic<bool> &parked,
+              std::condition_variable &cv);
+    void wakeUp(std::atomic<bool> &parked, std::condition_variable &cv);
+
+  public:
+    explicit SpscRing(size_t size)
+        : capacity(size), mask(storageSize(size) - 1),
+          data(storageSize(size)) {}
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing(SpscRing &&) = delete;
+
+    bool push(Element *&item, bool no_block = false);
+    bool pop(Element *&item, bool no_block = false);
+    size_t pop(Element **items, size_t max_items, bool no_block = false);
+
+    bool isEmpty() const;
+    bool isFull() const;
+
+    int getDataValue() const;
+    int getFreeValue() const;
+};
+
+template <typename Element>
+size_t SpscRing<Element>::storageSize(size_t size) {
+    size_t n = 1;
+    while (n < size)
+        n <<= 1;
+    return n;
+}
+
+template <typename Element> int SpscRing<Element>::getDataValue() const {
+    // head first, so that it cannot overtake the tail read
+    const size_t h = head.load();
+    const size_t n = tail.load() - h;
+    return static_cast<int>(n > capacity ? capacity : n);
+}
+
+template <typename Element> int SpscRing<Element>::getFreeValue() const {
+    return static_cast<int>(capacity) - getDataValue();
+}
+
+/** Spins, yields and finally parks until ready() */
+template <typename Element>
+template <typename Ready>
+void SpscRing<Element>::wait(Ready ready, std::atomic<bool> &parked,
+                             std::condition_variable &cv) {
+    // spinning only helps if the other side runs at the same time
+    static const int spinCount =
+        std::thread::hardware_concurrency() > 1 ? SPIN_COUNT : 0;
+    for (int i = 0; i != spinCount; ++i) {
+        if (ready())
+            return;
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+    for (int i = 0; i != YIELD_COUNT; ++i) {
+        if (ready())
+            return;
+        std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(parkMutex);
+    // seq_cst with the index update and check in wakeUp, so that either
+    // ready() sees the update or the other side sees the parked flag
+    parked.store(true);
+    cv.wait(lock, ready);
+    parked.store(false);
+}
+
+template <typename Element>
+void SpscRing<Element>::wakeUp(std::atomic<bool> &parked,
+                               std::condition_variable &cv) {
+    if (parked.load()) {
+        std::lock_guard<std::mutex> lock(parkMutex);
+        cv.notify_one();
+    }
+}
+
+/** Producer only: Adds item to the ring, waiting for a free slot
+ *
+ * \param item copy by reference the input item
+ * \param no_block if true, return immediately if fifo is full
+ * \return whether operation was successful or not */
+template <typename Element>
+bool SpscRing<Element>::push(Element *&item, bool no_block) {
+    const size_t t = tail.load(std::memory_order_relaxed);
+    if (t - headCache == capacity) {
+        headCache = head.load(std::memory_order_acquire);
+        if (t - headCache == capacity) {
+            if (no_block)
+                return false;
+            wait(
+                [this, t]() {
+                    headCache = head.load();
+                    return t - headCache != capacity;
+                },
+                producerParked, freeReady);
+        }
+    }
+    data[t & mask] = item;
+    tail.store(t + 1);
+    wakeUp(consumerParked, dataReady);
+    return true;
+}
+
+/** Consumer only: Removes and returns item from the ring, waiting for one
+ *
+ * \param item return by reference the wanted item
+ * \param no_block if true, return immediately if fifo is empty
+ * \return whether operation was successful or not */
+template <typename Element>
+bool SpscRing<Element>::pop(Element *&item, bool no_block) {
+    return pop(&item, 1, no_block) == 1;
+}
+
+/** Consumer only: Removes up to max_items at once, waiting only for the
+ * first one
+ *
+ * \param items array to return the items in
+ * \param no_block if true, return immediately if fifo is empty
+ * \return number of items removed */
+template <typename Element>
+size_t SpscRing<Element>::pop(Element **items, size_t max_items,
+                              bool no_block) {
+    const size_t h = head.load(std::memory_order_relaxed);
+    if (tailCache == h) {
+        tailCache = tail.load(std::memory_order_acquire);
+        if (tailCache == h) {
+            if (no_block || max_items == 0)
+                return 0;
+            wait(
+                [this, h]() {
+                    tailCache = tail.load();
+                    return tailCache != h;
+                },
+                consumerParked, dataReady);
+        }
+    }
+    size_t n = tailCache - h;
+    if (n > max_items)
+        n = max_items;
+    for (size_t i = 0; i != n; ++i) {
+        items[i] = data[(h + i) & mask];
+    }
+    head.store(h + n);
+    wakeUp(producerParked, freeReady);
+    return n;
+}
+
+/** Useful for testing and Consumer check of status
+ * Remember that the 'empty' status can change quickly
+ * as the Producer adds more items.
+ *
+ * \return true if ring is empty */
+template <typename Element> bool SpscRing<Element>::isEmpty() const {
+    return (getDataValue() == 0);
+}
+
+/** Useful for testing and Producer check of status
+ * Remember that the 'full' status can change quickly
+ * as the Consumer catches up.
+ *
+ * \return true if ring is full.  */
+template <typename Element> bool SpscRing<Element>::isFull() const {
+    return (getFreeValue() == 0);
+}
+
+} // namespace sls
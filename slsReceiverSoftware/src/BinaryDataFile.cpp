@@ -4,7 +4,8 @@
 
 namespace sls {
 
-BinaryDataFile::BinaryDataFile(const int index) : index(index) {}
+BinaryDataFile::BinaryDataFile(const int index)
+    : index(index), writer(index) {}
 
 BinaryDataFile::~BinaryDataFile() { CloseFile(); }
 
@@ -13,10 +14,32 @@ slsDetectorDefs::fileFormat BinaryDataFile::GetFileFormat() const {
 }
 
 void BinaryDataFile::CloseFile() {
-    if (fd) {
-        fclose(fd);
+    CloseCurrentFile();
+    writer.DiscardPrepared();
+}
+
+void BinaryDataFile::CloseCurrentFile() {
+    if (!writer.IsOpen()) {
+        return;
+    }
+    // flushes the buffered frames
+    try {
+        writer.Close();
+    } catch (const RuntimeError &e) {
+        LOG(logERROR) << "Could not close file " << fileName << ": "
+                      << e.what();
+        return;
+    }
+    if (!silentMode) {
+        auto stats = writer.GetStatistics();
+        LOG(logINFO) << "[" << udpPortNumber << "]: Binary File closed: "
+                     << fileName << " (" << stats.writes << " writes"
+                     << (stats.direct ? " with O_DIRECT" : "")
+                     << (stats.preallocated ? ", preallocated" : "")
+                     << ", max queue depth " << stats.maxQueueDepth
+                     << ", latency mean " << stats.meanLatencyMs
+                     << " ms, max " << stats.maxLatencyMs << " ms)";
     }
-    fd = nullptr;
 }
 
 void BinaryDataFile::CreateFirstBinaryDataFile(const std::string &fNamePrefix,
@@ -39,24 +62,17 @@ void BinaryDataFile::CreateFirstBinaryDataFile(const std::string &fNamePrefix,
     CreateFile();
 }
 
+std::string BinaryDataFile::GetSubFileName(const uint32_t subIndex) const {
+    std::ostringstream os;
+    os << fileNamePrefix << "_f" << subIndex << '_' << fileIndex << ".raw";
+    return os.str();
+}
+
 void BinaryDataFile::CreateFile() {
     numFramesInFile = 0;
+    fileName = GetSubFileName(subFileIndex);
 
-    std::ostringstream os;
-    os << fileNamePrefix << "_f" << subFileIndex << '_' << fileIndex << ".raw";
-    fileName = os.str();
-
-    if (!overWriteEnable) {
-        if (nullptr == (fd = fopen(fileName.c_str(), "wx"))) {
-            fd = nullptr;
-            throw RuntimeError("Could not create/overwrite file " + fileName);
-        }
-    } else if (nullptr == (fd = fopen(fileName.c_str(), "w"))) {
-        fd = nullptr;
-        throw RuntimeError("Could not create file " + fileName);
-    }
-    // setting to no file buffering
-    setvbuf(fd, nullptr, _IONBF, 0);
+    writer.Open(fileName, overWriteEnable);
 
     if (!silentMode) {
         LOG(logINFO) << "[" << udpPortNumber
@@ -64,49 +80,102 @@ void BinaryDataFile::CreateFile() {
     }
 }
 
-void BinaryDataFile::WriteToFile(char *imageData, sls_receiver_header &header,
-                                 const int imageSize,
-                                 const uint64_t currentFrameNumber,
-                                 const uint32_t numPacketsCaught) {
+void BinaryDataFile::AddFrameToFile(const int imageSize) {
     // check if maxframesperfile = 0 for infinite
     if (maxFramesPerFile && (numFramesInFile >= maxFramesPerFile)) {
-        CloseFile();
+        CloseCurrentFile();
         ++subFileIndex;
         CreateFile();
     }
     ++numFramesInFile;
 
-    // write to file
-    size_t ret = 0;
+    // image size only known now (roi)
+    if (maxFramesPerFile && numFramesInFile == 1) {
+        uint64_t frameSize = sizeof(sls_detector_header) +
+                             sizeof(bitset_storage) + imageSize;
+        writer.Prepare(GetSubFileName(subFileIndex + 1),
+                       maxFramesPerFile * frameSize);
+    }
+}
+
+void BinaryDataFile::WriteToFile(char *imageData, sls_receiver_header &header,
+                                 const int imageSize,
+                                 const uint64_t currentFrameNumber,
+                                 const uint32_t numPacketsCaught) {
+    AddFrameToFile(imageSize);
+
+    // write to file (buffer), the io thread writes it to disk
+    try {
+        // contiguous bitset (write header + image)
+        if (sizeof(sls_bitset) == sizeof(bitset_storage)) {
+            writer.Write(&header, sizeof(sls_receiver_header) + imageSize);
+        }
 
-    // contiguous bitset (write header + image)
-    if (sizeof(sls_bitset) == sizeof(bitset_storage)) {
-        ret = fwrite(&header, sizeof(sls_receiver_header) + imageSize, 1, fd);
+        // not contiguous bitset
+        else {
+            // write detector header
+            writer.Write(&header, sizeof(sls_detector_header));
+
+            // get contiguous representation of bit mask
+            bitset_storage storage;
+            memset(storage, 0, sizeof(bitset_storage));
+            sls_bitset bits = header.packetsMask;
+            for (int i = 0; i < MAX_NUM_PACKETS; ++i)
+                storage[i >> 3] |= (bits[i] << (i & 7));
+            // write bitmask
+            writer.Write(storage, sizeof(bitset_storage));
+
+            // write data
+            writer.Write(imageData, imageSize);
+        }
+    } catch (const RuntimeError &e) {
+        throw RuntimeError(std::to_string(index) +
+                           " : Write to file failed for image number " +
+                           std::to_string(currentFrameNumber) + " [" +
+                           e.what() + "]");
     }
+}
 
-    // not contiguous bitset
-    else {
-        // write detector header
-        ret = fwrite(&header, sizeof(sls_detector_header), 1, fd);
-
-        // get contiguous representation of bit mask
-        bitset_storage storage;
-        memset(storage, 0, sizeof(bitset_storage));
-        sls_bitset bits = header.packetsMask;
-        for (int i = 0; i < MAX_NUM_PACKETS; ++i)
-            storage[i >> 3] |= (bits[i] << (i & 7));
-        // write bitmask
-        ret += fwrite(storage, sizeof(bitset_storage), 1, fd);
-
-        // write data
-        ret += fwrite(imageData, imageSize, 1, fd);
+bool BinaryDataFile::SetupWriteEngine(const writeEngine engine, char *memory,
+                                      const size_t length, const int fifoDepth,
+                                      std::function<void(char *)> release) {
+    // header and image are written from the fifo in one piece
+    bool useRing = (engine == IO_URING) &&
+                   (sizeof(sls_bitset) == sizeof(bitset_storage));
+    if (!writer.UseIoUring(useRing)) {
+        LOG(logWARNING) << index
+                        << ": io_uring not available, writing files with an "
+                           "io thread";
+        return false;
     }
+    if (useRing) {
+        writer.RegisterMemory(memory, length);
+        writer.SetReleaseCallBack(release);
+        // the listener keeps free addresses while writes hold the others
+        writer.SetMaxWritesInFlight(fifoDepth / 2);
+    }
+    return useRing;
+}
+
+bool BinaryDataFile::IsWritingAsynchronously() const {
+    return writer.IsIoUring();
+}
 
-    // if write error
-    if (ret != 1) {
+void BinaryDataFile::WriteToFileAsync(char *buffer,
+                                      sls_receiver_header &header,
+                                      const int imageSize,
+                                      const uint64_t currentFrameNumber,
+                                      const uint32_t numPacketsCaught) {
+    AddFrameToFile(imageSize);
+
+    try {
+        writer.WriteFrom(&header, sizeof(sls_receiver_header) + imageSize,
+                         buffer);
+    } catch (const RuntimeError &e) {
         throw RuntimeError(std::to_string(index) +
                            " : Write to file failed for image number " +
-                           std::to_string(currentFrameNumber));
+                           std::to_string(currentFrameNumber) + " [" +
+                           e.what() + "]");
     }
 }
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "File.h"
+#include "FileWriter.h"
 
 namespace sls {
 
@@ -23,11 +24,26 @@ class BinaryDataFile : private virtual slsDetectorDefs, public File {
                      const int imageSize, const uint64_t currentFrameNumber,
                      const uint32_t numPacketsCaught) override;
 
+    bool SetupWriteEngine(const writeEngine engine, char *memory,
+                          const size_t length, const int fifoDepth,
+                          std::function<void(char *)> release) override;
+    bool IsWritingAsynchronously() const override;
+    void WriteToFileAsync(char *buffer, sls_receiver_header &header,
+                          const int imageSize,
+                          const uint64_t currentFrameNumber,
+                          const uint32_t numPacketsCaught) override;
+
   private:
+    std::string GetSubFileName(const uint32_t subIndex) const;
     void CreateFile();
+    void CloseCurrentFile();
+    /** rolls over to the (prepared) next file if the current one is full.
+     * With the first frame of a file, the next one is prepared in the
+     * background */
+    void AddFrameToFile(const int imageSize);
 
     uint32_t index;
-    FILE *fd{nullptr};
+    FileWriter writer;
     std::string fileName;
     uint32_t numFramesInFile{0};
     uint32_t subFileIndex{0};
@@ -19,6 +19,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <sys/socket.h>
 #include <unistd.h>
 #include <vector>
 
@@ -89,7 +90,8 @@ void ClientInterface::startTCPServer() {
     while (!killTcpThread) {
         LOG(logDEBUG1) << "Start accept loop";
         try {
-            auto socket = server.accept();
+            // clients can keep the connection open for further commands
+            auto &socket = server.waitForCommand();
             try {
                 verifyLock(); // lock should be checked only for set (not get),
                               // Move it back?
@@ -98,6 +100,7 @@ void ClientInterface::startTCPServer() {
                 // We had an error needs to be sent to client
                 char mess[MAX_STR_LENGTH]{};
                 strcpy_safe(mess, e.what());
+                ret = FAIL;
                 socket.Send(FAIL);
                 socket.Send(mess);
             }
@@ -105,6 +108,10 @@ void ClientInterface::startTCPServer() {
             if (ret == GOODBYE) {
                 break;
             }
+            // arguments of a failed command might not have been read
+            if (ret == FAIL) {
+                server.closeConnection(socket);
+            }
         } catch (const RuntimeError &e) {
             LOG(logERROR) << "Accept failed";
         }
@@ -223,6 +230,34 @@ int ClientInterface::functionTable(){
     flist[F_RECEIVER_SET_TRANSCEIVER_MASK]  =   &ClientInterface::set_transceiver_mask;
     flist[F_RECEIVER_SET_ROW]               =   &ClientInterface::set_row;
     flist[F_RECEIVER_SET_COLUMN]            =   &ClientInterface::set_column;    
+    flist[F_GET_RECEIVER_UDP_BATCH_SIZE]    =   &ClientInterface::get_udp_batch_size;
+    flist[F_SET_RECEIVER_UDP_BATCH_SIZE]    =   &ClientInterface::set_udp_batch_size;
+    flist[F_GET_RECEIVER_SOCKET_BACKEND]    =   &ClientInterface::get_socket_backend;
+    flist[F_SET_RECEIVER_SOCKET_BACKEND]    =   &ClientInterface::set_socket_backend;
+    flist[F_GET_RECEIVER_FIFO_HUGEPAGE]     =   &ClientInterface::get_fifo_hugepage;
+    flist[F_SET_RECEIVER_FIFO_HUGEPAGE]     =   &ClientInterface::set_fifo_hugepage;
+    flist[F_GET_RECEIVER_FIFO_NUMA_NODE]    =   &ClientInterface::get_fifo_numa_node;
+    flist[F_SET_RECEIVER_FIFO_NUMA_NODE]    =   &ClientInterface::set_fifo_numa_node;
+    flist[F_GET_RECEIVER_THREAD_CPUS]       =   &ClientInterface::get_thread_cpus;
+    flist[F_SET_RECEIVER_THREAD_CPUS]       =   &ClientInterface::set_thread_cpus;
+    flist[F_GET_RECEIVER_PROCESSING_THREADS]=   &ClientInterface::get_processing_threads;
+    flist[F_SET_RECEIVER_PROCESSING_THREADS]=   &ClientInterface::set_processing_threads;
+    flist[F_GET_RECEIVER_WRITE_ENGINE]      =   &ClientInterface::get_write_engine;
+    flist[F_SET_RECEIVER_WRITE_ENGINE]      =   &ClientInterface::set_write_engine;
+    flist[F_GET_RECEIVER_FILE_COMPRESSION]  =   &ClientInterface::get_file_compression;
+    flist[F_SET_RECEIVER_FILE_COMPRESSION]  =   &ClientInterface::set_file_compression;
+    flist[F_GET_RECEIVER_STREAMING_COMPRESSION]         =   &ClientInterface::get_streaming_compression;
+    flist[F_SET_RECEIVER_STREAMING_COMPRESSION]         =   &ClientInterface::set_streaming_compression;
+    flist[F_GET_RECEIVER_STREAMING_COMPRESSION_LEVEL]   =   &ClientInterface::get_streaming_compression_level;
+    flist[F_SET_RECEIVER_STREAMING_COMPRESSION_LEVEL]   =   &ClientInterface::set_streaming_compression_level;
+    flist[F_GET_RECEIVER_STREAMING_HEADER_FORMAT]       =   &ClientInterface::get_streaming_header_format;
+    flist[F_SET_RECEIVER_STREAMING_HEADER_FORMAT]       =   &ClientInterface::set_streaming_header_format;
+    flist[F_GET_RECEIVER_STREAMING_POLICY]              =   &ClientInterface::get_streaming_policy;
+    flist[F_SET_RECEIVER_STREAMING_POLICY]              =   &ClientInterface::set_streaming_policy;
+    flist[F_GET_RECEIVER_STREAMING_STATISTICS]          =   &ClientInterface::get_streaming_statistics;
+    flist[F_RECEIVER_EXEC_COMMAND_BATCH]                =   &ClientInterface::exec_command_batch;
+    flist[F_GET_RECEIVER_COMPRESSION_THREADS]           =   &ClientInterface::get_compression_threads;
+    flist[F_SET_RECEIVER_COMPRESSION_THREADS]           =   &ClientInterface::set_compression_threads;
 
 
 	for (int i = NUM_DET_FUNCTIONS + 1; i < NUM_REC_FUNCTIONS ; i++) {
@@ -837,6 +872,115 @@ int ClientInterface::get_frame_index(Interface &socket) {
     return OK;
 }
 
+int ClientInterface::exec_command_batch(Interface &socket) {
+    auto ncommands = socket.Receive<int>();
+    if (ncommands <= 0 || ncommands > MAX_BATCH_COMMANDS) {
+        throw RuntimeError("Invalid number of commands " +
+                           std::to_string(ncommands) +
+                           " in command batch. Options: [1 - " +
+                           std::to_string(MAX_BATCH_COMMANDS) + "]");
+    }
+    // read all the commands first, so that the connection stays in sync when
+    // one of them fails
+    struct BatchCommand {
+        int fnum;
+        int retvalSize;
+        std::vector<char> args;
+    };
+    std::vector<BatchCommand> commands(ncommands);
+    for (auto &command : commands) {
+        int header[3]{}; // fnum, args size, retval size
+        socket.Receive(header);
+        if (header[1] < 0 || header[1] > MAX_BATCH_ARGS_SIZE ||
+            header[2] < 0 || header[2] > MAX_BATCH_ARGS_SIZE) {
+            throw RuntimeError("Invalid argument size " +
+                               std::to_string(header[1]) +
+                               " or return value size " +
+                               std::to_string(header[2]) +
+                               " in command batch. Max: " +
+                               std::to_string(MAX_BATCH_ARGS_SIZE));
+        }
+        command.fnum = header[0];
+        command.retvalSize = header[2];
+        command.args.resize(header[1]);
+        socket.Receive(command.args);
+    }
+    LOG(logDEBUG1) << "Executing command batch of " << ncommands
+                   << " commands";
+
+    // stop at the first failed command, like commands sent one by one, and
+    // at one exiting the server (after replying)
+    std::vector<char> reply;
+    int result = OK;
+    for (const auto &command : commands) {
+        result = executeBatchCommand(command.fnum, command.args,
+                                     command.retvalSize, reply);
+        if (result != OK) {
+            break;
+        }
+    }
+    fnum = F_RECEIVER_EXEC_COMMAND_BATCH;
+    socket.Send(OK);
+    socket.Send(reply);
+    return (result == GOODBYE ? GOODBYE : OK);
+}
+
+int ClientInterface::executeBatchCommand(int cmdFnum,
+                                         const std::vector<char> &args,
+                                         int retvalSize,
+                                         std::vector<char> &reply) {
+    // the command gets its own connection, so that its function reads the
+    // arguments and sends the reply as usual
+    int fds[2]{-1, -1};
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+        throw RuntimeError("Could not create socket pair for command batch");
+    }
+    DataSocket caller(fds[0]);
+    ServerInterface callee(fds[1]);
+    caller.Send(cmdFnum);
+    caller.Send(args);
+    // function reads end of file instead of waiting for missing arguments
+    ::shutdown(fds[0], SHUT_WR);
+
+    int ret = FAIL;
+    try {
+        if (cmdFnum == F_RECEIVER_EXEC_COMMAND_BATCH) {
+            throw RuntimeError("Cannot execute a command batch within a batch");
+        }
+        ret = decodeFunction(callee);
+    } catch (const RuntimeError &e) {
+        char mess[MAX_STR_LENGTH]{};
+        strcpy_safe(mess, e.what());
+        callee.Send(FAIL);
+        callee.Send(mess);
+    }
+    ::shutdown(fds[1], SHUT_WR);
+
+    // reply as sent by the function: result, then error message or return
+    // value (functions return the bytes sent, so the result is read back)
+    int result = FAIL;
+    if (caller.read(&result, sizeof(result)) != sizeof(result)) {
+        throw RuntimeError("Could not read reply of command " +
+                           std::string(getFunctionNameFromEnum(
+                               static_cast<detFuncs>(cmdFnum))) +
+                           " in command batch");
+    }
+    size_t size = (result == FAIL ? MAX_STR_LENGTH : retvalSize);
+    size_t offset = reply.size();
+    reply.resize(offset + sizeof(result) + size);
+    memcpy(&reply[offset], &result, sizeof(result));
+    offset += sizeof(result);
+    size_t nread = 0;
+    while (nread < size) {
+        auto n = caller.read(&reply[offset + nread], size - nread);
+        if (n <= 0) {
+            break;
+        }
+        nread += n;
+    }
+    return (ret == GOODBYE ? GOODBYE : result);
+}
+
 int ClientInterface::get_missing_packets(Interface &socket) {
     auto missing_packets = impl()->getNumMissingPackets();
     LOG(logDEBUG1) << "missing packets:" << ToString(missing_packets);
@@ -1195,6 +1339,180 @@ int ClientInterface::get_real_udp_socket_buffer_size(Interface &socket) {
     return socket.sendResult(size);
 }
 
+int ClientInterface::get_udp_batch_size(Interface &socket) {
+    int retval = impl()->getUDPBatchSize();
+    LOG(logDEBUG1) << "UDP batch size:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_udp_batch_size(Interface &socket) {
+    auto value = socket.Receive<int>();
+    if (value < 1 || value > MAX_RX_UDP_BATCH_SIZE) {
+        throw RuntimeError("Invalid udp batch size " + std::to_string(value) +
+                           ". Options: 1 - " +
+                           std::to_string(MAX_RX_UDP_BATCH_SIZE));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting UDP batch size: " << value;
+    impl()->setUDPBatchSize(value);
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_socket_backend(Interface &socket) {
+    int retval = impl()->getSocketBackend();
+    LOG(logDEBUG1) << "socket backend:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_socket_backend(Interface &socket) {
+    auto index = socket.Receive<int>();
+    if (index < 0 || index >= NUM_SOCKET_BACKENDS) {
+        throw RuntimeError("Invalid socket backend " + std::to_string(index));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting socket backend: " << index;
+    impl()->setSocketBackend(static_cast<socketBackend>(index));
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_fifo_hugepage(Interface &socket) {
+    int retval = impl()->getFifoHugePageSize();
+    LOG(logDEBUG1) << "fifo huge page size:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_fifo_hugepage(Interface &socket) {
+    auto value = socket.Receive<int>();
+    if (value != 0 && value != 2 && value != 1024) {
+        throw RuntimeError("Invalid fifo huge page size " +
+                           std::to_string(value) + ". Options: 0, 2, 1024");
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting fifo huge page size: " << value;
+    try {
+        impl()->setFifoHugePageSize(value);
+    } catch (const std::exception &e) {
+        throw RuntimeError("Could not set fifo huge page size [" +
+                           std::string(e.what()) + ']');
+    }
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_fifo_numa_node(Interface &socket) {
+    int retval = impl()->getFifoNumaNode();
+    LOG(logDEBUG1) << "fifo numa node:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_fifo_numa_node(Interface &socket) {
+    auto value = socket.Receive<int>();
+    if (value < -1) {
+        throw RuntimeError("Invalid fifo numa node " + std::to_string(value));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting fifo numa node: " << value;
+    try {
+        impl()->setFifoNumaNode(value);
+    } catch (const std::exception &e) {
+        throw RuntimeError("Could not set fifo numa node [" +
+                           std::string(e.what()) + ']');
+    }
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_thread_cpus(Interface &socket) {
+    auto cpus = impl()->getThreadCpus();
+    LOG(logDEBUG1) << "thread cpus:" << cpus;
+    cpus.resize(MAX_STR_LENGTH);
+    return socket.sendResult(cpus);
+}
+
+int ClientInterface::set_thread_cpus(Interface &socket) {
+    std::string cpus = socket.Receive(MAX_STR_LENGTH);
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting thread cpus: " << cpus;
+    try {
+        impl()->setThreadCpus(cpus);
+    } catch (const std::exception &e) {
+        throw RuntimeError("Could not set thread cpus [" +
+                           std::string(e.what()) + ']');
+    }
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_processing_threads(Interface &socket) {
+    int retval = impl()->getProcessingThreads();
+    LOG(logDEBUG1) << "processing threads:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_processing_threads(Interface &socket) {
+    auto value = socket.Receive<int>();
+    if (value < 1 || value > MAX_RX_PROCESSING_THREADS) {
+        throw RuntimeError("Invalid number of processing threads " +
+                           std::to_string(value) + ". Options: 1 - " +
+                           std::to_string(MAX_RX_PROCESSING_THREADS));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting processing threads: " << value;
+    impl()->setProcessingThreads(value);
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_write_engine(Interface &socket) {
+    int retval = impl()->getWriteEngine();
+    LOG(logDEBUG1) << "write engine:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_write_engine(Interface &socket) {
+    auto index = socket.Receive<int>();
+    if (index < 0 || index >= NUM_WRITE_ENGINES) {
+        throw RuntimeError("Invalid write engine " + std::to_string(index));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting write engine: " << index;
+    impl()->setWriteEngine(static_cast<writeEngine>(index));
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_file_compression(Interface &socket) {
+    int retval = impl()->getFileCompression();
+    LOG(logDEBUG1) << "file compression:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_file_compression(Interface &socket) {
+    auto index = socket.Receive<int>();
+    if (index < 0 || index >= NUM_FILE_COMPRESSIONS) {
+        throw RuntimeError("Invalid file compression " +
+                           std::to_string(index));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting file compression: " << index;
+    impl()->setFileCompression(static_cast<fileCompression>(index));
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_compression_threads(Interface &socket) {
+    int retval = impl()->getCompressionThreads();
+    LOG(logDEBUG1) << "compression threads:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_compression_threads(Interface &socket) {
+    auto n = socket.Receive<int>();
+    if (n < 1 || n > MAX_RX_COMPRESSION_THREADS) {
+        throw RuntimeError("Invalid number of compression threads " +
+                           std::to_string(n) + ". Options: 1 - " +
+                           std::to_string(MAX_RX_COMPRESSION_THREADS));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting compression threads: " << n;
+    impl()->setCompressionThreads(n);
+    return socket.Send(OK);
+}
+
 int ClientInterface::set_frames_per_file(Interface &socket) {
     auto index = socket.Receive<int>();
     if (index < 0) {
@@ -1674,6 +1992,88 @@ int ClientInterface::set_streaming_hwm(Interface &socket) {
     return socket.Send(OK);
 }
 
+int ClientInterface::get_streaming_compression(Interface &socket) {
+    int retval = impl()->getStreamingCompression();
+    LOG(logDEBUG1) << "streaming compression:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_streaming_compression(Interface &socket) {
+    auto index = socket.Receive<int>();
+    if (index < 0 || index >= NUM_FILE_COMPRESSIONS) {
+        throw RuntimeError("Invalid streaming compression " +
+                           std::to_string(index));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting streaming compression: " << index;
+    impl()->setStreamingCompression(static_cast<fileCompression>(index));
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_streaming_compression_level(Interface &socket) {
+    int retval = impl()->getStreamingCompressionLevel();
+    LOG(logDEBUG1) << "streaming compression level:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_streaming_compression_level(Interface &socket) {
+    auto level = socket.Receive<int>();
+    if (level < 1 || level > 9) {
+        throw RuntimeError("Invalid streaming compression level " +
+                           std::to_string(level) + ". Options: 1-9");
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting streaming compression level: " << level;
+    impl()->setStreamingCompressionLevel(level);
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_streaming_header_format(Interface &socket) {
+    int retval = impl()->getStreamingHeaderFormat();
+    LOG(logDEBUG1) << "streaming header format:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_streaming_header_format(Interface &socket) {
+    auto index = socket.Receive<int>();
+    if (index < 0 || index >= NUM_ZMQ_HEADER_FORMATS) {
+        throw RuntimeError("Invalid streaming header format " +
+                           std::to_string(index));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting streaming header format: " << index;
+    impl()->setStreamingHeaderFormat(static_cast<zmqHeaderFormat>(index));
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_streaming_policy(Interface &socket) {
+    int retval = impl()->getStreamingPolicy();
+    LOG(logDEBUG1) << "streaming policy:" << retval;
+    return socket.sendResult(retval);
+}
+
+int ClientInterface::set_streaming_policy(Interface &socket) {
+    auto index = socket.Receive<int>();
+    if (index < 0 || index >= NUM_ZMQ_STREAMING_POLICIES) {
+        throw RuntimeError("Invalid streaming policy " +
+                           std::to_string(index));
+    }
+    verifyIdle(socket);
+    LOG(logDEBUG1) << "Setting streaming policy: " << index;
+    impl()->setStreamingPolicy(static_cast<zmqStreamingPolicy>(index));
+    return socket.Send(OK);
+}
+
+int ClientInterface::get_streaming_statistics(Interface &socket) {
+    auto retval = impl()->getStreamingStatistics();
+    LOG(logDEBUG1) << "streaming statistics:" << ToString(retval);
+    auto size = static_cast<int>(retval.size());
+    socket.Send(OK);
+    socket.Send(size);
+    socket.Send(retval);
+    return OK;
+}
+
 int ClientInterface::set_all_threshold(Interface &socket) {
     auto eVs = socket.Receive<std::array<int, 3>>();
     LOG(logDEBUG) << "Threshold:" << ToString(eVs);
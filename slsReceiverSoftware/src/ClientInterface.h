@@ -163,6 +163,20 @@ class ClientInterface : private virtual slsDetectorDefs {
     int set_threshold(ServerInterface &socket);
     int get_streaming_hwm(ServerInterface &socket);
     int set_streaming_hwm(ServerInterface &socket);
+    int get_streaming_compression(ServerInterface &socket);
+    int set_streaming_compression(ServerInterface &socket);
+    int get_streaming_compression_level(ServerInterface &socket);
+    int set_streaming_compression_level(ServerInterface &socket);
+    int get_streaming_header_format(ServerInterface &socket);
+    int set_streaming_header_format(ServerInterface &socket);
+    int get_streaming_policy(ServerInterface &socket);
+    int set_streaming_policy(ServerInterface &socket);
+    int get_streaming_statistics(ServerInterface &socket);
+    int exec_command_batch(ServerInterface &socket);
+    /** result of the command appended to reply, returns OK, FAIL or
+     * GOODBYE (server exits) */
+    int executeBatchCommand(int cmdFnum, const std::vector<char> &args,
+                            int retvalSize, std::vector<char> &reply);
     int set_all_threshold(ServerInterface &socket);
     int set_detector_datastream(ServerInterface &socket);
     int get_arping(ServerInterface &socket);
@@ -174,6 +188,24 @@ class ClientInterface : private virtual slsDetectorDefs {
     int set_transceiver_mask(ServerInterface &socket);
     int set_row(ServerInterface &socket);
     int set_column(ServerInterface &socket);
+    int get_udp_batch_size(ServerInterface &socket);
+    int set_udp_batch_size(ServerInterface &socket);
+    int get_socket_backend(ServerInterface &socket);
+    int set_socket_backend(ServerInterface &socket);
+    int get_fifo_hugepage(ServerInterface &socket);
+    int set_fifo_hugepage(ServerInterface &socket);
+    int get_fifo_numa_node(ServerInterface &socket);
+    int set_fifo_numa_node(ServerInterface &socket);
+    int get_thread_cpus(ServerInterface &socket);
+    int set_thread_cpus(ServerInterface &socket);
+    int get_processing_threads(ServerInterface &socket);
+    int set_processing_threads(ServerInterface &socket);
+    int get_write_engine(ServerInterface &socket);
+    int set_write_engine(ServerInterface &socket);
+    int get_file_compression(ServerInterface &socket);
+    int set_file_compression(ServerInterface &socket);
+    int get_compression_threads(ServerInterface &socket);
+    int set_compression_threads(ServerInterface &socket);
 
     Implementation *impl() {
         if (receiver != nullptr) {
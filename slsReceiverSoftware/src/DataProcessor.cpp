@@ -33,7 +33,10 @@ DataProcessor::DataProcessor(int index) : ThreadObject(index, typeName) {
     LOG(logDEBUG) << "DataProcessor " << index << " created";
 }
 
-DataProcessor::~DataProcessor() { DeleteFiles(); }
+DataProcessor::~DataProcessor() {
+    StopWorkers();
+    DeleteFiles();
+}
 
 bool DataProcessor::GetStartedFlag() const { return startedFlag; }
 
@@ -73,6 +76,53 @@ void DataProcessor::SetCtbDbitList(std::vector<int> value) {
 
 void DataProcessor::SetCtbDbitOffset(int value) { ctbDbitOffset = value; }
 
+void DataProcessor::SetWriteEngine(writeEngine engine) {
+    fileWriteEngine = engine;
+}
+
+void DataProcessor::SetFileCompression(fileCompression c) { compression = c; }
+
+void DataProcessor::SetCompressionThreads(int n) { compressionThreads = n; }
+
+void DataProcessor::SetNumberOfThreads(int n) {
+    StopWorkers();
+    killWorkers = false;
+    for (int i = 1; i < n; ++i) {
+        workers.emplace_back(&DataProcessor::WorkerThread, this);
+    }
+    if (!workerCpus.empty()) {
+        SetThreadAffinity(workerCpus);
+    }
+    LOG(logDEBUG) << "DataProcessor " << index << " threads: " << n;
+}
+
+void DataProcessor::SetThreadAffinity(const std::vector<int> &cpus) {
+    ThreadObject::SetThreadAffinity(cpus);
+    workerCpus = cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    for (auto &it : workers) {
+        pthread_setaffinity_np(it.native_handle(), sizeof(set), &set);
+    }
+}
+
+void DataProcessor::StopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        killWorkers = true;
+    }
+    batchReady.notify_all();
+    for (auto &it : workers) {
+        it.join();
+    }
+    workers.clear();
+}
+
 void DataProcessor::ResetParametersforNewAcquisition() {
     StopRunning();
     startedFlag = false;
@@ -80,9 +130,16 @@ void DataProcessor::ResetParametersforNewAcquisition() {
     firstIndex = 0;
     currentFrameIndex = 0;
     firstStreamerFrame = true;
-    streamCurrentFrame = false;
-    completeImageToStreamBeforeCropping =
-        make_unique<char[]>(generalData->imageSize);
+    size_t numSlots =
+        workers.empty() ? 1 : BATCH_PER_THREAD * (workers.size() + 1);
+    slots.resize(numSlots);
+    batchBuffers.resize(numSlots);
+    for (auto &it : slots) {
+        it.completeImage.reset();
+        if (receiverRoiEnabled) {
+            it.completeImage = make_unique<char[]>(generalData->imageSize);
+        }
+    }
 }
 
 void DataProcessor::RecordFirstIndex(uint64_t fnum) {
@@ -157,10 +214,15 @@ void DataProcessor::CreateFirstFiles(const std::string &fileNamePrefix,
         dataFile->CreateFirstHDF5DataFile(
             fileNamePrefix, fileIndex, overWriteEnable, silentMode,
             udpPortNumber, generalData->framesPerFile, numImages, nx, ny,
-            generalData->dynamicRange);
+            generalData->dynamicRange, compression, compressionThreads);
         break;
 #endif
     case BINARY:
+        // frames not streamed are then written directly from the fifo
+        dataFile->SetupWriteEngine(
+            fileWriteEngine, fifo->GetMemory(), fifo->GetMemoryLength(),
+            fifo->GetDepth(),
+            [this](char *buffer) { fifo->FreeAddress(buffer); });
         dataFile->CreateFirstBinaryDataFile(
             fileNamePrefix, fileIndex, overWriteEnable, silentMode,
             udpPortNumber, generalData->framesPerFile);
@@ -258,39 +320,92 @@ std::string DataProcessor::CreateMasterFile(
 }
 
 void DataProcessor::ThreadExecution() {
-    char *buffer = nullptr;
-    fifo->PopAddress(buffer);
-    LOG(logDEBUG5) << "DataProcessor " << index << ", " << std::hex
-                   << static_cast<void *>(buffer) << std::dec << ":" << buffer;
-    auto *memImage = reinterpret_cast<image_structure *>(buffer);
-
-    // check dummy
-    LOG(logDEBUG1) << "DataProcessor " << index
-                   << ", Numbytes:" << memImage->size;
-    if (memImage->size == DUMMY_PACKET_VALUE) {
-        StopProcessing(buffer);
-        return;
+    size_t numPopped =
+        fifo->PopAddresses(batchBuffers.data(), batchBuffers.size());
+
+    // frame order is kept for everything that depends on it
+    size_t numImages = 0;
+    char *dummy = nullptr;
+    for (size_t i = 0; i != numPopped; ++i) {
+        char *buffer = batchBuffers[i];
+        LOG(logDEBUG5) << "DataProcessor " << index << ", " << std::hex
+                       << static_cast<void *>(buffer) << std::dec << ":"
+                       << buffer;
+        auto *memImage = reinterpret_cast<image_structure *>(buffer);
+
+        // check dummy
+        LOG(logDEBUG1) << "DataProcessor " << index
+                       << ", Numbytes:" << memImage->size;
+        if (memImage->size == DUMMY_PACKET_VALUE) {
+            dummy = buffer;
+            // nothing follows the dummy in an acquisition
+            for (++i; i != numPopped; ++i) {
+                fifo->FreeAddress(batchBuffers[i]);
+            }
+            break;
+        }
+        auto &slot = slots[numImages++];
+        slot.buffer = buffer;
+        slot.frameNumber = memImage->header.detHeader.frameNumber;
+        slot.numPackets = memImage->header.detHeader.packetNumber;
+        slot.failed = false;
+        slot.stream = PrepareImage(memImage->header, memImage->firstIndex);
     }
 
-    try {
-        ProcessAnImage(memImage->header, memImage->size, memImage->firstIndex,
-                       memImage->data);
-    } catch (const std::exception &e) {
-        fifo->FreeAddress(buffer);
+    ProcessBatch(numImages);
+    for (size_t i = 0; i != numImages; ++i) {
+        CommitImage(slots[i]);
+    }
+
+    if (dummy != nullptr) {
+        StopProcessing(dummy);
+    }
+}
+
+void DataProcessor::ProcessBatch(size_t numImages) {
+    if (workers.empty() || numImages < 2) {
+        for (size_t i = 0; i != numImages; ++i) {
+            ProcessAnImage(slots[i]);
+        }
         return;
     }
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        batchSize = numImages;
+        nextImage = 0;
+        busyWorkers = workers.size();
+        ++batchCount;
+    }
+    batchReady.notify_all();
+    ProcessBatchImages();
+    std::unique_lock<std::mutex> lock(workerMutex);
+    batchDone.wait(lock, [this]() { return busyWorkers == 0; });
+}
 
-    // stream (if time/freq to stream) or free
-    if (streamCurrentFrame) {
-        // copy the complete image back if roi enabled
-        if (receiverRoiEnabled) {
-            memImage->size = generalData->imageSize;
-            memcpy(memImage->data, &completeImageToStreamBeforeCropping[0],
-                   generalData->imageSize);
+void DataProcessor::ProcessBatchImages() {
+    for (size_t i = nextImage++; i < batchSize; i = nextImage++) {
+        ProcessAnImage(slots[i]);
+    }
+}
+
+void DataProcessor::WorkerThread() {
+    uint64_t lastBatch = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(workerMutex);
+            batchReady.wait(lock, [this, lastBatch]() {
+                return killWorkers || batchCount != lastBatch;
+            });
+            if (killWorkers) {
+                return;
+            }
+            lastBatch = batchCount;
+        }
+        ProcessBatchImages();
+        std::lock_guard<std::mutex> lock(workerMutex);
+        if (--busyWorkers == 0) {
+            batchDone.notify_one();
         }
-        fifo->PushAddressToStream(buffer);
-    } else {
-        fifo->FreeAddress(buffer);
     }
 }
 
@@ -308,13 +423,12 @@ void DataProcessor::StopProcessing(char *buf) {
     LOG(logDEBUG1) << index << ": Processing Completed";
 }
 
-void DataProcessor::ProcessAnImage(sls_receiver_header &header, size_t &size,
-                                   size_t &firstImageIndex, char *data) {
+bool DataProcessor::PrepareImage(sls_receiver_header &header,
+                                 size_t &firstImageIndex) {
     uint64_t fnum = header.detHeader.frameNumber;
     LOG(logDEBUG1) << "DataProcessing " << index << ": fnum:" << fnum;
     currentFrameIndex = fnum;
     numFramesCaught++;
-    uint32_t nump = header.detHeader.packetNumber;
 
     if (!startedFlag) {
         RecordFirstIndex(fnum);
@@ -329,15 +443,6 @@ void DataProcessor::ProcessAnImage(sls_receiver_header &header, size_t &size,
         }
     }
 
-    // frame padding
-    if (framePadding && nump < generalData->packetsPerFrame)
-        PadMissingPackets(header, data);
-
-    // rearrange ctb digital bits (if ctbDbitlist is not empty)
-    if (!ctbDbitList.empty()) {
-        RearrangeDbitData(size, data);
-    }
-
     // 'stream Image' check has to be done here before crop image
     // stream (if time/freq to stream) or free
     if (dataStreamEnable && SendToStreamer()) {
@@ -346,16 +451,30 @@ void DataProcessor::ProcessAnImage(sls_receiver_header &header, size_t &size,
             // write to memory structure of first streamer frame
             firstImageIndex = firstIndex;
         }
-        streamCurrentFrame = true;
-    } else {
-        streamCurrentFrame = false;
+        return true;
+    }
+    return false;
+}
+
+void DataProcessor::ProcessAnImage(ImageSlot &slot) {
+    auto *memImage = reinterpret_cast<image_structure *>(slot.buffer);
+    sls_receiver_header &header = memImage->header;
+    size_t &size = memImage->size;
+    char *data = memImage->data;
+
+    // frame padding
+    if (framePadding && slot.numPackets < generalData->packetsPerFrame)
+        PadMissingPackets(header, data);
+
+    // rearrange ctb digital bits (if ctbDbitlist is not empty)
+    if (!ctbDbitList.empty()) {
+        RearrangeDbitData(size, data);
     }
 
     if (receiverRoiEnabled) {
         // copy the complete image to stream before cropping
-        if (streamCurrentFrame) {
-            memcpy(&completeImageToStreamBeforeCropping[0], data,
-                   generalData->imageSize);
+        if (slot.stream) {
+            memcpy(&slot.completeImage[0], data, generalData->imageSize);
         }
         CropImage(size, data);
     }
@@ -371,18 +490,54 @@ void DataProcessor::ProcessAnImage(sls_receiver_header &header, size_t &size,
             rawDataModifyReadyCallBack(header, data, size, pRawDataReady);
         }
     } catch (const std::exception &e) {
-        throw RuntimeError("Get Data Callback Error: " + std::string(e.what()));
+        LOG(logERROR) << "Get Data Callback Error: " << e.what();
+        slot.failed = true;
     }
+}
 
-    // write to file
+void DataProcessor::CommitImage(ImageSlot &slot) {
+    auto *memImage = reinterpret_cast<image_structure *>(slot.buffer);
+    if (slot.failed) {
+        fifo->FreeAddress(slot.buffer);
+        return;
+    }
+
+    // write to file, freed once written if asynchronous
+    if (dataFile && !slot.stream && dataFile->IsWritingAsynchronously()) {
+        try {
+            dataFile->WriteToFileAsync(slot.buffer, memImage->header,
+                                       memImage->size,
+                                       slot.frameNumber - firstIndex,
+                                       slot.numPackets);
+        } catch (const RuntimeError &e) {
+            fifo->FreeAddress(slot.buffer);
+        }
+        return;
+    }
     if (dataFile) {
         try {
-            dataFile->WriteToFile(data, header, size, fnum - firstIndex, nump);
+            dataFile->WriteToFile(memImage->data, memImage->header,
+                                  memImage->size,
+                                  slot.frameNumber - firstIndex,
+                                  slot.numPackets);
         } catch (const RuntimeError &e) {
             ; // ignore write exception for now (TODO: send error message
               // via stopReceiver tcp)
         }
     }
+
+    // stream (if time/freq to stream) or free
+    if (slot.stream) {
+        // copy the complete image back if roi enabled
+        if (receiverRoiEnabled) {
+            memImage->size = generalData->imageSize;
+            memcpy(memImage->data, &slot.completeImage[0],
+                   generalData->imageSize);
+        }
+        fifo->PushAddressToStream(slot.buffer);
+    } else {
+        fifo->FreeAddress(slot.buffer);
+    }
 }
 
 bool DataProcessor::SendToStreamer() {
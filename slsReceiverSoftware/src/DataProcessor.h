@@ -15,7 +15,9 @@
 #include "receiver_defs.h"
 
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace sls {
@@ -46,6 +48,18 @@ class DataProcessor : private virtual slsDetectorDefs, public ThreadObject {
     void SetFramePadding(bool enable);
     void SetCtbDbitList(std::vector<int> value);
     void SetCtbDbitOffset(int value);
+    /** from the next CreateFirstFiles (binary only) */
+    void SetWriteEngine(writeEngine engine);
+    /** from the next CreateFirstFiles (hdf5 only) */
+    void SetFileCompression(fileCompression c);
+    /** chunks compressed in parallel, from the next CreateFirstFiles */
+    void SetCompressionThreads(int n);
+    /** threads processing images in parallel (including this one). Images
+     * are still written and streamed in order. Call backs must then be
+     * thread safe. */
+    void SetNumberOfThreads(int n);
+    /** also for the additional processing threads */
+    void SetThreadAffinity(const std::vector<int> &cpus) override;
 
     void ResetParametersforNewAcquisition();
     void CloseFiles();
@@ -93,12 +107,24 @@ class DataProcessor : private virtual slsDetectorDefs, public ThreadObject {
                                             void *arg);
 
   private:
+    /** image popped from the fifo and what to do with it */
+    struct ImageSlot {
+        char *buffer{nullptr};
+        /** before the call back can modify the header */
+        uint64_t frameNumber{0};
+        uint32_t numPackets{0};
+        bool stream{false};
+        bool failed{false};
+        /** complete image to stream before cropping */
+        std::unique_ptr<char[]> completeImage;
+    };
+
     void RecordFirstIndex(uint64_t fnum);
 
     /**
      * Thread Exeution for DataProcessor Class
-     * Pop bound addresses, process them,
-     * write to file if needed & free the address
+     * Pop a batch of bound addresses, process them in parallel,
+     * write to file in order if needed & free the addresses
      */
     void ThreadExecution() override;
 
@@ -109,11 +135,26 @@ class DataProcessor : private virtual slsDetectorDefs, public ThreadObject {
     void StopProcessing(char *buf);
 
     /**
-     * Process an image popped from fifo,
-     * write to file if fw enabled & update parameters
+     * Update parameters for an image popped from fifo (in order)
+     * @returns true if it should be sent to streamer
      */
-    void ProcessAnImage(sls_receiver_header &header, size_t &size,
-                        size_t &firstImageIndex, char *data);
+    bool PrepareImage(sls_receiver_header &header, size_t &firstImageIndex);
+
+    /**
+     * Pad, rearrange, crop and call back (in any order and thread)
+     */
+    void ProcessAnImage(ImageSlot &slot);
+
+    /**
+     * Write to file if fw enabled, then stream or free (in order)
+     */
+    void CommitImage(ImageSlot &slot);
+
+    /** ProcessAnImage on all images in the batch with all threads */
+    void ProcessBatch(size_t numImages);
+    void ProcessBatchImages();
+    void WorkerThread();
+    void StopWorkers();
 
     /**
      * Calls CheckTimer and CheckCount for streaming frequency and timer
@@ -147,6 +188,8 @@ class DataProcessor : private virtual slsDetectorDefs, public ThreadObject {
     void CropImage(size_t &size, char *data);
 
     static const std::string typeName;
+    /** images popped at once per processing thread */
+    static const int BATCH_PER_THREAD = 4;
 
     GeneralData *generalData{nullptr};
     Fifo *fifo;
@@ -155,7 +198,8 @@ class DataProcessor : private virtual slsDetectorDefs, public ThreadObject {
     ROI receiverRoi{};
     bool receiverRoiEnabled{false};
     bool receiverNoRoi{false};
-    std::unique_ptr<char[]> completeImageToStreamBeforeCropping;
+    std::vector<ImageSlot> slots;
+    std::vector<char *> batchBuffers;
     /** if 0, sending random images with a timer */
     uint32_t streamingFrequency;
     uint32_t streamingTimerInMs;
@@ -177,9 +221,22 @@ class DataProcessor : private virtual slsDetectorDefs, public ThreadObject {
     /** first streamer frame to add frame index in fifo header */
     bool firstStreamerFrame{false};
 
-    bool streamCurrentFrame{false};
-
     File *dataFile{nullptr};
+    writeEngine fileWriteEngine{IO_THREAD};
+    fileCompression compression{NO_COMPRESSION};
+    int compressionThreads{4};
+
+    // additional processing threads, woken up for each batch
+    std::vector<std::thread> workers;
+    std::vector<int> workerCpus;
+    std::mutex workerMutex;
+    std::condition_variable batchReady;
+    std::condition_variable batchDone;
+    uint64_t batchCount{0};
+    size_t batchSize{0};
+    std::atomic<size_t> nextImage{0};
+    int busyWorkers{0};
+    bool killWorkers{false};
 
     // call back
     /**
@@ -8,10 +8,14 @@
 #include "DataStreamer.h"
 #include "Fifo.h"
 #include "GeneralData.h"
+#include "sls/ToString.h"
 #include "sls/ZmqSocket.h"
+#include "sls/compression_utils.h"
 #include "sls/sls_detector_exceptions.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <chrono>
 #include <iostream>
 
 namespace sls {
@@ -23,11 +27,18 @@ DataStreamer::DataStreamer(int index) : ThreadObject(index, TypeName) {
 }
 
 DataStreamer::~DataStreamer() {
+    StopCompressionThreads();
     CloseZmqSocket();
     delete[] completeBuffer;
 }
 
-void DataStreamer::SetFifo(Fifo *f) { fifo = f; }
+void DataStreamer::SetFifo(Fifo *f) {
+    fifo = f;
+    maxImagesInZmq =
+        std::max(1, fifo->GetDepth() / ZMQ_SEND_QUEUE_FIFO_DIVISOR);
+    maxBuffersInZmq =
+        std::max(1, fifo->GetDepth() / ZMQ_ZERO_COPY_FIFO_DIVISOR);
+}
 
 void DataStreamer::SetGeneralData(GeneralData *g) { generalData = g; }
 
@@ -58,10 +69,56 @@ void DataStreamer::SetAdditionalJsonHeader(
 
 void DataStreamer::SetReceiverROI(ROI roi) { receiverRoi = roi; }
 
+void DataStreamer::SetCompression(fileCompression c) {
+    compressionType = c;
+    if (compressionType == NO_COMPRESSION) {
+        StopCompressionThreads();
+    } else if (compressionThreads.empty()) {
+        StartCompressionThreads();
+    }
+}
+
+void DataStreamer::SetHeaderFormat(zmqHeaderFormat f) {
+    headerFormat = f;
+    if (zmqSocket) {
+        zmqSocket->SetBinaryHeader(headerFormat == BINARY_HEADER);
+    }
+}
+
+void DataStreamer::SetPolicy(zmqStreamingPolicy p) { policy = p; }
+
+slsDetectorDefs::streamingStatistics DataStreamer::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    streamingStatistics retval = statistics;
+    if (retval.streamed != 0) {
+        retval.averageLatency_ns = totalLatency_ns / retval.streamed;
+    }
+    return retval;
+}
+
+void DataStreamer::SetCompressionThreads(int n) {
+    numCompressionThreads = n;
+    if (!compressionThreads.empty() &&
+        compressionThreads.size() != (size_t)numCompressionThreads) {
+        StopCompressionThreads();
+        StartCompressionThreads();
+    }
+}
+
+void DataStreamer::SetCompressionLevel(int level) {
+    std::lock_guard<std::mutex> lock(compressionMutex);
+    compressionLevel = level;
+}
+
 void DataStreamer::ResetParametersforNewAcquisition(const std::string &fname) {
     StopRunning();
     startedFlag = false;
     firstIndex = 0;
+    {
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+        statistics = streamingStatistics{};
+        totalLatency_ns = 0;
+    }
 
     fileNametoStream = fname;
     if (completeBuffer) {
@@ -85,10 +142,14 @@ void DataStreamer::RecordFirstIndex(uint64_t fnum, size_t firstImageIndex) {
 }
 
 void DataStreamer::CreateZmqSockets(uint16_t port, const IpAddr ip, int hwm) {
+    zmqPort = port;
+    zmqIp = ip;
+    zmqHwm = hwm;
     uint16_t portnum = port + index;
     std::string sip = ip.str();
     try {
         zmqSocket = new ZmqSocket(portnum, (ip != 0 ? sip.c_str() : nullptr));
+        zmqSocket->SetBinaryHeader(headerFormat == BINARY_HEADER);
 
         // set if custom
         if (hwm >= 0) {
@@ -117,6 +178,7 @@ void DataStreamer::CloseZmqSocket() {
 void DataStreamer::ThreadExecution() {
     char *buffer = nullptr;
     fifo->PopAddressToStream(buffer);
+    auto taken = Clock::now();
     LOG(logDEBUG5) << "DataStreamer " << index << ", pop 0x" << std::hex
                    << (void *)(buffer) << std::dec << ":" << buffer;
     auto *memImage = reinterpret_cast<image_structure *>(buffer);
@@ -135,14 +197,79 @@ void DataStreamer::ThreadExecution() {
                          memImage->firstIndex);
     }
 
-    ProcessAnImage(memImage->header.detHeader, memImage->size, memImage->data);
+    if (!WaitForSendQueue(buffer)) {
+        return;
+    }
 
-    // free
+    // compressed in parallel, freed once sent
+    if (compressionType != NO_COMPRESSION) {
+        QueueForCompression(buffer, memImage->header.detHeader, memImage->size,
+                            memImage->data, taken);
+        return;
+    }
+
+    ProcessAnImage(buffer, memImage->header.detHeader, memImage->size,
+                   memImage->data, taken);
+}
+
+bool DataStreamer::WaitForSendQueue(char *buffer) {
+    bool drop = false;
+    // woken when zmq releases an image (in its io thread), a compressed
+    // image is sent or a new image is pushed to stream
+    fifo->WaitForStream([&]() {
+        if (!IsSendQueueFull()) {
+            return true;
+        }
+        drop = IsImageDropped();
+        return drop;
+    });
+    if (drop) {
+        DropImage(buffer);
+        return false;
+    }
+    return true;
+}
+
+bool DataStreamer::IsImageDropped() const {
+    switch (policy) {
+    case DROP_NEWEST:
+        return true;
+    case DROP_OLDEST:
+        // oldest of a full backlog
+        return fifo->GetStreamLevel() >= maxImagesInZmq;
+    case KEEP_LATEST:
+        // newer images waiting, 2 so that the last image of an acquisition
+        // (before the dummy) is not dropped
+        return fifo->GetStreamLevel() > 1;
+    default:
+        return false;
+    }
+}
+
+bool DataStreamer::IsSendQueueFull() {
+    if (imagesInZmq >= maxImagesInZmq) {
+        return true;
+    }
+    if (compressionType != NO_COMPRESSION) {
+        std::lock_guard<std::mutex> lock(compressionMutex);
+        return compressionJobs.size() >= 2 * compressionThreads.size();
+    }
+    return false;
+}
+
+void DataStreamer::DropImage(char *buffer) {
     fifo->FreeAddress(buffer);
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    // once per acquisition, the total at the end
+    if (statistics.dropped++ == 0) {
+        LOG(logWARNING) << index << " Streamer: zmq client too slow, dropping "
+                        << "images (" << ToString(policy) << ")";
+    }
 }
 
 void DataStreamer::StopProcessing(char *buf) {
     LOG(logDEBUG1) << "DataStreamer " << index << ": Dummy";
+    WaitForCompression();
     if (!SendDummyHeader()) {
         LOG(logERROR)
             << "Could not send zmq dummy header for streamer for port "
@@ -151,12 +278,18 @@ void DataStreamer::StopProcessing(char *buf) {
 
     fifo->FreeAddress(buf);
     StopRunning();
+    auto stats = GetStatistics();
+    if (stats.dropped != 0) {
+        LOG(logWARNING) << index << " Streamer: dropped " << stats.dropped
+                        << " images for a slow zmq client";
+    }
     LOG(logDEBUG1) << index << ": Streaming Completed";
 }
 
 /** buf includes only the standard header */
-void DataStreamer::ProcessAnImage(sls_detector_header header, size_t size,
-                                  char *data) {
+void DataStreamer::ProcessAnImage(char *buffer, sls_detector_header header,
+                                  size_t size, char *data,
+                                  Clock::time_point taken) {
 
     uint64_t fnum = header.frameNumber;
     LOG(logDEBUG1) << "DataStreamer " << index << ": fnum:" << fnum;
@@ -167,9 +300,10 @@ void DataStreamer::ProcessAnImage(sls_detector_header header, size_t size,
         // imageSizeComplete instead of size because gui needs
         // imagesizecomplete and listener writes imagesize to size
 
-        if (!SendDataHeader(header, generalData->imageSizeComplete,
-                            generalData->nPixelsXComplete,
-                            generalData->nPixelsYComplete)) {
+        if (!zmqSocket->SendHeader(
+                index, CreateDataHeader(header, generalData->imageSizeComplete,
+                                        generalData->nPixelsXComplete,
+                                        generalData->nPixelsYComplete))) {
             LOG(logERROR) << "Could not send zmq header for fnum " << fnum
                           << " and streamer " << index;
         }
@@ -181,23 +315,96 @@ void DataStreamer::ProcessAnImage(sls_detector_header header, size_t size,
             LOG(logERROR) << "Could not send zmq data for fnum " << fnum
                           << " and streamer " << index;
         }
+        fifo->FreeAddress(buffer);
+        AddToStatistics(taken);
     }
 
     // normal
     else {
 
-        if (!SendDataHeader(header, size, generalData->nPixelsX,
-                            generalData->nPixelsY)) {
+        if (!zmqSocket->SendHeader(
+                index, CreateDataHeader(header, size, generalData->nPixelsX,
+                                        generalData->nPixelsY))) {
             LOG(logERROR) << "Could not send zmq header for fnum " << fnum
                           << " and streamer " << index;
         }
-        if (!zmqSocket->SendData(data, size)) {
+        // without copy, back to the fifo once zmq has sent it
+        if (!SendFifoImage(buffer, data, size, taken)) {
             LOG(logERROR) << "Could not send zmq data for fnum " << fnum
                           << " and streamer " << index;
         }
     }
 }
 
+int DataStreamer::SendFifoImage(char *buffer, char *data, size_t size,
+                                Clock::time_point taken) {
+    auto *image = new ImageInZmq(this, buffer, taken);
+    // a publisher keeps the images of each slow subscriber (up to its hwm),
+    // they must not take the buffers of the listener
+    if (buffersInZmq < maxBuffersInZmq) {
+        ++buffersInZmq;
+    } else {
+        image->copy.assign(data, data + size);
+        image->buffer = nullptr;
+        data = image->copy.data();
+        fifo->FreeAddress(buffer);
+    }
+    ++imagesInZmq;
+    return zmqSocket->SendData(data, size, FreeImageInZmq, image);
+}
+
+void DataStreamer::FreeImageInZmq(void *, void *hint) {
+    auto *image = static_cast<ImageInZmq *>(hint);
+    DataStreamer *streamer = image->streamer;
+    if (image->buffer) {
+        streamer->fifo->FreeAddress(image->buffer);
+        --streamer->buffersInZmq;
+    }
+    streamer->AddToStatistics(image->taken);
+    delete image;
+    {
+        std::lock_guard<std::mutex> lock(streamer->releaseMutex);
+        --streamer->imagesInZmq;
+    }
+    streamer->imageReleased.notify_all();
+    streamer->fifo->NotifyStreamWaiter();
+}
+
+void DataStreamer::AddToStatistics(Clock::time_point taken) {
+    auto latency = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                             taken)
+            .count());
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    ++statistics.streamed;
+    totalLatency_ns += latency;
+    statistics.maxLatency_ns = std::max(statistics.maxLatency_ns, latency);
+}
+
+void DataStreamer::WaitForImagesInZmq() {
+    auto released = [this]() { return imagesInZmq == 0; };
+    {
+        std::unique_lock<std::mutex> lock(releaseMutex);
+        if (imageReleased.wait_for(
+                lock, std::chrono::milliseconds(ZMQ_RELEASE_TIMEOUT_MS),
+                released)) {
+            return;
+        }
+    }
+    // stalled client, closing (no linger) discards the images it holds
+    LOG(logWARNING) << index << " Streamer: dropping " << imagesInZmq
+                    << " images not taken by zmq clients";
+    CloseZmqSocket();
+    CreateZmqSockets(zmqPort, zmqIp, zmqHwm);
+    std::unique_lock<std::mutex> lock(releaseMutex);
+    if (!imageReleased.wait_for(
+            lock, std::chrono::milliseconds(ZMQ_RELEASE_TIMEOUT_MS),
+            released)) {
+        throw RuntimeError("Zmq did not release the images of streamer " +
+                           std::to_string(index));
+    }
+}
+
 int DataStreamer::SendDummyHeader() {
     zmqHeader zHeader;
     zHeader.data = false;
@@ -205,8 +412,9 @@ int DataStreamer::SendDummyHeader() {
     return zmqSocket->SendHeader(index, zHeader);
 }
 
-int DataStreamer::SendDataHeader(sls_detector_header header, uint32_t size,
-                                 uint32_t nx, uint32_t ny) {
+zmqHeader DataStreamer::CreateDataHeader(sls_detector_header header,
+                                         uint32_t size, uint32_t nx,
+                                         uint32_t ny) {
     zmqHeader zHeader;
     zHeader.data = true;
     zHeader.jsonversion = SLS_DETECTOR_JSON_HEADER_VERSION;
@@ -252,8 +460,137 @@ int DataStreamer::SendDataHeader(sls_detector_header header, uint32_t size,
     }
     zHeader.addJsonHeader = localAdditionalJsonHeader;
     zHeader.rx_roi = receiverRoi.getIntArray();
+    return zHeader;
+}
 
-    return zmqSocket->SendHeader(index, zHeader);
+void DataStreamer::StartCompressionThreads() {
+    killCompressionThreads = false;
+    for (int i = 0; i != numCompressionThreads; ++i) {
+        compressionThreads.emplace_back(&DataStreamer::CompressionThread,
+                                        this);
+    }
+}
+
+void DataStreamer::StopCompressionThreads() {
+    {
+        std::lock_guard<std::mutex> lock(compressionMutex);
+        killCompressionThreads = true;
+    }
+    jobQueued.notify_all();
+    for (auto &it : compressionThreads) {
+        it.join();
+    }
+    compressionThreads.clear();
+}
+
+void DataStreamer::QueueForCompression(char *buffer,
+                                       sls_detector_header header, size_t size,
+                                       char *data, Clock::time_point taken) {
+    auto job = make_unique<CompressionJob>();
+    job->buffer = buffer;
+    job->taken = taken;
+    // shortframe gotthard (as ProcessAnImage)
+    if (completeBuffer) {
+        memcpy(completeBuffer + ((generalData->imageSize) * adcConfigured),
+               data, size);
+        job->image.assign(completeBuffer,
+                          completeBuffer + generalData->imageSizeComplete);
+        job->header = CreateDataHeader(header, generalData->imageSizeComplete,
+                                       generalData->nPixelsXComplete,
+                                       generalData->nPixelsYComplete);
+        job->data = job->image.data();
+        job->size = job->image.size();
+    } else {
+        job->header = CreateDataHeader(header, size, generalData->nPixelsX,
+                                       generalData->nPixelsY);
+        job->data = data;
+        job->size = size;
+    }
+
+    std::unique_lock<std::mutex> lock(compressionMutex);
+    jobSent.wait(lock, [this]() {
+        return compressionJobs.size() < 2 * compressionThreads.size();
+    });
+    compressionJobs.push_back(std::move(job));
+    jobQueued.notify_one();
+}
+
+void DataStreamer::CompressionThread() {
+    std::vector<char> shuffled;
+    std::unique_lock<std::mutex> lock(compressionMutex);
+    while (true) {
+        jobQueued.wait(lock, [this]() {
+            return killCompressionThreads || nextJob != compressionJobs.size();
+        });
+        if (killCompressionThreads) {
+            return;
+        }
+        CompressionJob *job = compressionJobs[nextJob++].get();
+        int level = compressionLevel;
+        lock.unlock();
+
+        // sent uncompressed if it does not compress
+        if (shuffleDeflate(job->data, job->size,
+                           bytesPerPixel(job->header.dynamicRange), level,
+                           shuffled, job->compressed)) {
+            job->header.compression = ZMQ_CODEC_SHUFFLE_DEFLATE;
+        }
+
+        lock.lock();
+        job->done = true;
+        // one thread at a time sends to the zmq socket
+        if (sendingJobs) {
+            continue;
+        }
+        sendingJobs = true;
+        while (!compressionJobs.empty() && compressionJobs.front()->done) {
+            auto sent = std::move(compressionJobs.front());
+            compressionJobs.pop_front();
+            --nextJob;
+            jobSent.notify_all();
+            lock.unlock();
+            fifo->NotifyStreamWaiter();
+            SendCompressedImage(*sent);
+            lock.lock();
+        }
+        sendingJobs = false;
+        jobSent.notify_all();
+    }
+}
+
+void DataStreamer::SendCompressedImage(CompressionJob &job) {
+    uint64_t fnum = job.header.frameNumber;
+    if (!zmqSocket->SendHeader(index, job.header)) {
+        LOG(logERROR) << "Could not send zmq header for fnum " << fnum
+                      << " and streamer " << index;
+    }
+    // all without copy, except the complete image of short gotthard
+    int ret = 0;
+    if (!job.header.compression.empty()) {
+        auto *image = new ImageInZmq(this, nullptr, job.taken);
+        image->copy = std::move(job.compressed);
+        ++imagesInZmq;
+        ret = zmqSocket->SendData(image->copy.data(), image->copy.size(),
+                                  FreeImageInZmq, image);
+        fifo->FreeAddress(job.buffer);
+    } else if (job.image.empty()) {
+        ret = SendFifoImage(job.buffer, job.data, job.size, job.taken);
+    } else {
+        ret = zmqSocket->SendData(job.data, job.size);
+        fifo->FreeAddress(job.buffer);
+        AddToStatistics(job.taken);
+    }
+    if (!ret) {
+        LOG(logERROR) << "Could not send zmq data for fnum " << fnum
+                      << " and streamer " << index;
+    }
+}
+
+void DataStreamer::WaitForCompression() {
+    std::unique_lock<std::mutex> lock(compressionMutex);
+    jobSent.wait(lock, [this]() {
+        return compressionJobs.empty() && !sendingJobs;
+    });
 }
 
 void DataStreamer::RestreamStop() {
@@ -10,17 +10,23 @@
  */
 
 #include "ThreadObject.h"
+#include "sls/ZmqSocket.h"
 #include "sls/network_utils.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace sls {
 
 class GeneralData;
 class Fifo;
 class DataStreamer;
-class ZmqSocket;
 
 class DataStreamer : private virtual slsDetectorDefs, public ThreadObject {
 
@@ -39,6 +45,15 @@ class DataStreamer : private virtual slsDetectorDefs, public ThreadObject {
     void
     SetAdditionalJsonHeader(const std::map<std::string, std::string> &json);
     void SetReceiverROI(ROI roi);
+    /** starts or stops the compression threads, only when idle */
+    void SetCompression(fileCompression c);
+    /** images compressed in parallel, only when idle */
+    void SetCompressionThreads(int n);
+    void SetCompressionLevel(int level);
+    void SetHeaderFormat(zmqHeaderFormat f);
+    void SetPolicy(zmqStreamingPolicy p);
+    /** since the start of the acquisition */
+    streamingStatistics GetStatistics() const;
 
     void ResetParametersforNewAcquisition(const std::string &fname);
     /**
@@ -51,8 +66,42 @@ class DataStreamer : private virtual slsDetectorDefs, public ThreadObject {
     void CreateZmqSockets(uint16_t port, const IpAddr ip, int hwm);
     void CloseZmqSocket();
     void RestreamStop();
+    /** waits until zmq has released all images sent without copy, to be
+     * called before the fifo is destroyed. Images still held by zmq after
+     * ZMQ_RELEASE_TIMEOUT_MS (stalled client) are dropped by recreating the
+     * socket */
+    void WaitForImagesInZmq();
 
   private:
+    using Clock = std::chrono::steady_clock;
+
+    /** image handed to zmq without copy, hint of its free function */
+    struct ImageInZmq {
+        ImageInZmq(DataStreamer *streamer, char *buffer,
+                   Clock::time_point taken)
+            : streamer(streamer), buffer(buffer), taken(taken) {}
+        DataStreamer *streamer;
+        /** fifo buffer, nullptr if the data was compressed or copied */
+        char *buffer;
+        std::vector<char> copy;
+        Clock::time_point taken;
+    };
+
+    /** image queued for compression, images are sent in the order of the
+     * fifo */
+    struct CompressionJob {
+        zmqHeader header;
+        /** fifo buffer, freed once sent */
+        char *buffer{nullptr};
+        char *data{nullptr};
+        size_t size{0};
+        /** copy of the complete image (short gotthard) */
+        std::vector<char> image;
+        std::vector<char> compressed;
+        bool done{false};
+        Clock::time_point taken;
+    };
+
     /**
      * Record First Index
      */
@@ -66,24 +115,56 @@ class DataStreamer : private virtual slsDetectorDefs, public ThreadObject {
      */
     void StopProcessing(char *buf);
 
+    /** waits while the send queue is full or drops the image, as the
+     * policy says. Returns false if the image was dropped (and freed) */
+    bool WaitForSendQueue(char *buffer);
+    /** images in zmq or waiting for compression */
+    bool IsSendQueueFull();
+    /** with a full send queue, as the policy says */
+    bool IsImageDropped() const;
+    void DropImage(char *buffer);
+
     /**
      * Process an image popped from fifo,
-     * write to file if fw enabled & update parameters
+     * write to file if fw enabled & update parameters.
+     * The fifo buffer is freed once sent.
      */
-    void ProcessAnImage(sls_detector_header header, size_t size, char *data);
+    void ProcessAnImage(char *buffer, sls_detector_header header, size_t size,
+                        char *data, Clock::time_point taken);
+
+    /** sends the image of a fifo buffer without copy, or a copy of it if
+     * zmq already holds its share of the fifo */
+    int SendFifoImage(char *buffer, char *data, size_t size,
+                      Clock::time_point taken);
+
+    /** zmq free function of images sent without copy (hint: ImageInZmq) */
+    static void FreeImageInZmq(void *data, void *hint);
+    /** image released by zmq, taken out of the fifo at taken */
+    void AddToStatistics(Clock::time_point taken);
 
     int SendDummyHeader();
 
     /**
-     * Create and send Json Header
+     * Create Json Header
      * @param rheader header of image
      * @param size data size (could have been modified in call back)
      * @param nx number of pixels in x dim
      * @param ny number of pixels in y dim
-     * @returns 0 if error, else 1
      */
-    int SendDataHeader(sls_detector_header header, uint32_t size = 0,
-                       uint32_t nx = 0, uint32_t ny = 0);
+    zmqHeader CreateDataHeader(sls_detector_header header, uint32_t size = 0,
+                               uint32_t nx = 0, uint32_t ny = 0);
+
+    void StartCompressionThreads();
+    void StopCompressionThreads();
+    /** waits for a free slot in the compression queue */
+    void QueueForCompression(char *buffer, sls_detector_header header,
+                             size_t size, char *data, Clock::time_point taken);
+    /** compresses images, the thread that completes the first image in the
+     * queue sends all compressed images at its front */
+    void CompressionThread();
+    void SendCompressedImage(CompressionJob &job);
+    /** waits until all queued images are sent */
+    void WaitForCompression();
 
     static const std::string TypeName;
     const GeneralData *generalData{nullptr};
@@ -114,6 +195,39 @@ class DataStreamer : private virtual slsDetectorDefs, public ThreadObject {
     xy numPorts{1, 1};
     bool quadEnable{false};
     uint64_t nTotalFrames{0};
+
+    zmqHeaderFormat headerFormat{JSON_HEADER};
+    fileCompression compressionType{NO_COMPRESSION};
+    int compressionLevel{1};
+    int numCompressionThreads{4};
+    std::vector<std::thread> compressionThreads;
+    std::mutex compressionMutex;
+    std::condition_variable jobQueued;
+    std::condition_variable jobSent;
+    /** images in flight, in order */
+    std::deque<std::unique_ptr<CompressionJob>> compressionJobs;
+    /** index of the first image not yet taken by a compression thread */
+    size_t nextJob{0};
+    bool sendingJobs{false};
+    bool killCompressionThreads{false};
+
+    /** images sent without copy, not yet released by zmq */
+    std::atomic<int> imagesInZmq{0};
+    /** fifo buffers among them */
+    std::atomic<int> buffersInZmq{0};
+    int maxBuffersInZmq{1};
+    std::mutex releaseMutex;
+    std::condition_variable imageReleased;
+    /** to recreate the socket */
+    uint16_t zmqPort{0};
+    IpAddr zmqIp{};
+    int zmqHwm{-1};
+    zmqStreamingPolicy policy{BLOCK_ON_FULL};
+    /** send queue, a part of the fifo */
+    int maxImagesInZmq{1};
+    mutable std::mutex statisticsMutex;
+    streamingStatistics statistics;
+    uint64_t totalLatency_ns{0};
 };
 
 } // namespace sls
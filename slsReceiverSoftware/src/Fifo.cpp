@@ -10,17 +10,30 @@
 #include "Fifo.h"
 #include "sls/sls_detector_exceptions.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <thread>
 #include <unistd.h>
+#include <vector>
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
 
 namespace sls {
 
-Fifo::Fifo(int index, size_t fifoItemSize, uint32_t fifoDepth)
-    : index(index), memory(nullptr), fifoBound(nullptr), fifoFree(nullptr),
-      fifoStream(nullptr), fifoDepth(fifoDepth), status_fifoBound(0),
-      status_fifoFree(fifoDepth) {
+Fifo::Fifo(int index, size_t fifoItemSize, uint32_t fifoDepth,
+           size_t hugePageSize, int numaNode)
+    : index(index), memory(nullptr), hugePageSize(hugePageSize),
+      requestedNumaNode(numaNode), numaNode(numaNode), fifoBound(nullptr),
+      fifoFree(nullptr), fifoStream(nullptr), fifoDepth(fifoDepth),
+      status_fifoBound(0), status_fifoFree(fifoDepth) {
     LOG(logDEBUG3) << __SHORT_AT__ << " called";
     CreateFifos(fifoItemSize);
 }
@@ -37,22 +50,20 @@ void Fifo::CreateFifos(size_t fifoItemSize) {
     DestroyFifos();
 
     // create fifos
-    fifoBound = new CircularFifo<char>(fifoDepth);
-    fifoFree = new CircularFifo<char>(fifoDepth);
-    fifoStream = new CircularFifo<char>(fifoDepth);
+    fifoBound = new SpscRing<char>(fifoDepth);
+    fifoFree = new SpscRing<char>(fifoDepth);
+    fifoStream = new SpscRing<char>(fifoDepth);
     // allocate memory
     size_t mem_len = fifoItemSize * (size_t)fifoDepth * sizeof(char);
-    memory = (char *)malloc(mem_len);
-    if (memory == nullptr) {
-        throw RuntimeError("Could not allocate memory for fifos");
-    }
-    memset(memory, 0, mem_len);
-    int pagesize = getpagesize();
-    for (size_t i = 0; i < mem_len; i += pagesize) {
-        strcpy(memory + i, "memory");
-    }
+    AllocateMemory(mem_len);
+    BindMemoryToNumaNode();
+    PrefaultMemory();
     LOG(logDEBUG) << "Memory Allocated " << index << ": "
                   << (double)mem_len / (double)(1024 * 1024) << " MB";
+    LOG(logINFO) << "Fifo " << index << " memory: page size "
+                 << pageSize / 1024 << " kB, numa node "
+                 << (numaNode == -1 ? std::string("not bound")
+                                    : std::to_string(numaNode));
 
     { // push free addresses into fifoFree fifo
         char *buffer = memory;
@@ -70,8 +81,9 @@ void Fifo::DestroyFifos() {
     LOG(logDEBUG3) << __SHORT_AT__ << " called";
 
     if (memory) {
-        free(memory);
+        munmap(memory, memoryLength);
         memory = nullptr;
+        memoryLength = 0;
     }
     delete fifoBound;
     fifoBound = nullptr;
@@ -81,7 +93,98 @@ void Fifo::DestroyFifos() {
     fifoStream = nullptr;
 }
 
-void Fifo::FreeAddress(char *&address) { fifoFree->push(address); }
+void Fifo::AllocateMemory(size_t length) {
+    pageSize = getpagesize();
+    if (length == 0) {
+        return;
+    }
+    if (hugePageSize != 0) {
+        // log2 of page size in the mmap flags
+        int shift = 0;
+        while ((size_t(1) << shift) < hugePageSize)
+            ++shift;
+        size_t hugeLength =
+            (length + hugePageSize - 1) / hugePageSize * hugePageSize;
+        void *mem = mmap(nullptr, hugeLength, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                             (shift << MAP_HUGE_SHIFT),
+                         -1, 0);
+        if (mem != MAP_FAILED) {
+            memory = static_cast<char *>(mem);
+            memoryLength = hugeLength;
+            pageSize = hugePageSize;
+            return;
+        }
+        LOG(logWARNING) << "Could not allocate fifo " << index << " from "
+                        << hugePageSize / (1024 * 1024)
+                        << " MB huge pages (see /proc/sys/vm/nr_hugepages) ["
+                        << strerror(errno) << "]. Using normal pages.";
+    }
+    void *mem = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        throw RuntimeError("Could not allocate memory for fifos");
+    }
+    memory = static_cast<char *>(mem);
+    memoryLength = length;
+    // transparent huge pages where the kernel allows
+    madvise(memory, memoryLength, MADV_HUGEPAGE);
+}
+
+void Fifo::BindMemoryToNumaNode() {
+    if (numaNode < 0 || memory == nullptr) {
+        return;
+    }
+    // preferred, so that a full node does not fail the allocation
+    unsigned long nodeMask = 1UL << numaNode;
+    const unsigned long maxNode = sizeof(nodeMask) * 8 + 1;
+    if (numaNode >= static_cast<int>(sizeof(nodeMask) * 8) ||
+        syscall(SYS_mbind, memory, memoryLength, MPOL_PREFERRED, &nodeMask,
+                maxNode, 0) != 0) {
+        LOG(logWARNING) << "Could not bind fifo " << index
+                        << " memory to numa node " << numaNode << " ["
+                        << strerror(errno) << "]";
+        numaNode = -1;
+    }
+}
+
+void Fifo::PrefaultMemory() {
+    const size_t numPages = memoryLength / pageSize;
+    if (numPages == 0) {
+        return;
+    }
+    const size_t numThreads = std::max<size_t>(
+        1, std::min<size_t>({numPages, std::thread::hardware_concurrency(),
+                             8}));
+    const size_t pagesPerThread = (numPages + numThreads - 1) / numThreads;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i != numThreads; ++i) {
+        size_t start = std::min(i * pagesPerThread * pageSize, memoryLength);
+        size_t end =
+            std::min((i + 1) * pagesPerThread * pageSize, memoryLength);
+        threads.emplace_back([this, start, end]() {
+            memset(memory + start, 0, end - start);
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
+size_t Fifo::GetPageSize() const { return pageSize; }
+
+int Fifo::GetNumaNode() const { return numaNode; }
+
+int Fifo::GetRequestedNumaNode() const { return requestedNumaNode; }
+
+char *Fifo::GetMemory() const { return memory; }
+
+size_t Fifo::GetMemoryLength() const { return memoryLength; }
+
+void Fifo::FreeAddress(char *&address) {
+    std::lock_guard<std::mutex> lock(freeMutex);
+    fifoFree->push(address);
+}
 
 void Fifo::GetNewAddress(char *&address) {
     int temp = fifoFree->getDataValue();
@@ -94,19 +197,42 @@ void Fifo::PushAddress(char *&address) {
     int temp = fifoBound->getDataValue();
     if (temp > status_fifoBound)
         status_fifoBound = temp;
-    while (!fifoBound->push(address))
-        ;
-    /*temp = fifoBound->getDataValue();
-    if (temp > status_fifoBound)
-            status_fifoBound = temp;*/
+    fifoBound->push(address);
 }
 
 void Fifo::PopAddress(char *&address) { fifoBound->pop(address); }
 
-void Fifo::PushAddressToStream(char *&address) { fifoStream->push(address); }
+size_t Fifo::PopAddresses(char **addresses, size_t maxAddresses) {
+    return fifoBound->pop(addresses, maxAddresses);
+}
+
+void Fifo::PushAddressToStream(char *&address) {
+    fifoStream->push(address);
+    NotifyStreamWaiter();
+}
 
 void Fifo::PopAddressToStream(char *&address) { fifoStream->pop(address); }
 
+int Fifo::GetStreamLevel() const { return fifoStream->getDataValue(); }
+
+void Fifo::WaitForStream(const std::function<bool()> &ready) {
+    std::unique_lock<std::mutex> lock(streamWaitMutex);
+    // seq_cst with the change and check in NotifyStreamWaiter, so that either
+    // ready() sees the change or the notifier sees the flag
+    streamWaiting.store(true);
+    streamChanged.wait(lock, ready);
+    streamWaiting.store(false);
+}
+
+void Fifo::NotifyStreamWaiter() {
+    if (streamWaiting.load()) {
+        std::lock_guard<std::mutex> lock(streamWaitMutex);
+        streamChanged.notify_one();
+    }
+}
+
+int Fifo::GetDepth() const { return fifoDepth; }
+
 int Fifo::GetMaxLevelForFifoBound() {
     int temp = status_fifoBound;
     status_fifoBound = 0;
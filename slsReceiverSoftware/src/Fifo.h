@@ -14,14 +14,22 @@
 #include "sls/logger.h"
 #include "sls/sls_detector_defs.h"
 
-#include "sls/CircularFifo.h"
+#include "sls/SpscRing.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
 
 namespace sls {
 
 class Fifo : private virtual slsDetectorDefs {
 
   public:
-    Fifo(int index, size_t fifoItemSize, uint32_t fifoDepth);
+    /** hugePageSize 0 for normal (transparent huge) pages, numaNode -1 for
+     * no binding */
+    Fifo(int index, size_t fifoItemSize, uint32_t fifoDepth,
+         size_t hugePageSize = 0, int numaNode = -1);
     ~Fifo();
 
     void FreeAddress(char *&address);
@@ -30,24 +38,59 @@ class Fifo : private virtual slsDetectorDefs {
     /** to process data */
     void PushAddress(char *&address);
     void PopAddress(char *&address);
+    /** waits only for the first, returns number of addresses popped */
+    size_t PopAddresses(char **addresses, size_t maxAddresses);
 
     void PushAddressToStream(char *&address);
     void PopAddressToStream(char *&address);
+    /** addresses waiting to be streamed */
+    int GetStreamLevel() const;
+    /** streamer only: waits until ready(), checked again on every push to
+     * stream and NotifyStreamWaiter */
+    void WaitForStream(const std::function<bool()> &ready);
+    /** wakes WaitForStream after a change to what it waits for */
+    void NotifyStreamWaiter();
+    int GetDepth() const;
 
     int GetMaxLevelForFifoBound();
     int GetMinLevelForFifoFree();
 
+    /** page size the memory was actually allocated with */
+    size_t GetPageSize() const;
+    /** numa node the memory is bound to, -1 if not bound */
+    int GetNumaNode() const;
+    /** numa node asked for at construction, -1 for none */
+    int GetRequestedNumaNode() const;
+    /** all fifo addresses lie within */
+    char *GetMemory() const;
+    size_t GetMemoryLength() const;
+
   private:
     /** also allocate memory & push addresses into free fifo */
     void CreateFifos(size_t fifoItemSize);
     /** also deallocate memory */
     void DestroyFifos();
+    /** huge pages if requested and available, else normal pages */
+    void AllocateMemory(size_t length);
+    void BindMemoryToNumaNode();
+    /** touch all pages in parallel so that acquisition does not fault */
+    void PrefaultMemory();
 
     int index;
     char *memory;
-    CircularFifo<char> *fifoBound;
-    CircularFifo<char> *fifoFree;
-    CircularFifo<char> *fifoStream;
+    size_t memoryLength{0};
+    size_t hugePageSize;
+    size_t pageSize{0};
+    const int requestedNumaNode;
+    int numaNode;
+    SpscRing<char> *fifoBound;
+    SpscRing<char> *fifoFree;
+    SpscRing<char> *fifoStream;
+    /** listener (discarding), processor and streamer all free addresses */
+    std::mutex freeMutex;
+    std::atomic<bool> streamWaiting{false};
+    std::mutex streamWaitMutex;
+    std::condition_variable streamChanged;
     int fifoDepth;
     volatile int status_fifoBound;
     volatile int status_fifoFree;
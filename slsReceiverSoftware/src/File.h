@@ -6,6 +6,7 @@
 #include "sls/sls_detector_defs.h"
 
 #include <array>
+#include <functional>
 
 #ifdef HDF5C
 #include "H5Cpp.h"
@@ -60,7 +61,8 @@ class File : private virtual slsDetectorDefs {
         const bool overWriteEnable, const bool silentMode,
         const uint16_t udpPortNumber, const uint32_t maxFramesPerFile,
         const uint64_t numImages, const uint32_t nPixelsX,
-        const uint32_t nPixelsY, const uint32_t dynamicRange) {
+        const uint32_t nPixelsY, const uint32_t dynamicRange,
+        const fileCompression compression, const int compressionThreads) {
         LOG(logERROR)
             << "This is a generic function CreateFirstHDF5DataFile that "
                "should be overloaded by a derived class";
@@ -81,6 +83,29 @@ class File : private virtual slsDetectorDefs {
                              const int imageSize,
                              const uint64_t currentFrameNumber,
                              const uint32_t numPacketsCaught) = 0;
+
+    /** memory and depth of the fifo and how to free its addresses once
+     * written. Returns false if the engine is not supported (synchronous
+     * writes) */
+    virtual bool SetupWriteEngine(const writeEngine engine, char *memory,
+                                  const size_t length, const int fifoDepth,
+                                  std::function<void(char *)> release) {
+        return false;
+    };
+
+    /** if true, WriteToFileAsync can be used for frames that are not
+     * streamed */
+    virtual bool IsWritingAsynchronously() const { return false; };
+
+    /** buffer (fifo address) is freed by the release call back of
+     * SetupWriteEngine once written */
+    virtual void WriteToFileAsync(char *buffer, sls_receiver_header &header,
+                                  const int imageSize,
+                                  const uint64_t currentFrameNumber,
+                                  const uint32_t numPacketsCaught) {
+        LOG(logERROR) << "This is a generic function WriteToFileAsync that "
+                         "should be overloaded by a derived class";
+    };
 };
 
 } // namespace sls
@@ -0,0 +1,585 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "FileWriter.h"
+#include "IoUring.h"
+#include "receiver_defs.h"
+#include "sls/container_utils.h"
+#include "sls/sls_detector_exceptions.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace sls {
+
+/** kernel limit for a registered io_uring buffer */
+static constexpr size_t MAX_REGISTERED_BUFFER_SIZE = 1UL << 30;
+
+FileWriter::FileWriter(int index)
+    : index(index), maxInFlight(FILE_URING_QUEUE_DEPTH) {
+    buffers.resize(FILE_NUM_BUFFERS);
+    for (size_t i = 0; i != buffers.size(); ++i) {
+        void *p = nullptr;
+        if (posix_memalign(&p, FILE_BUFFER_ALIGNMENT, FILE_BUFFER_SIZE) != 0) {
+            for (auto &it : buffers)
+                free(it.data);
+            throw RuntimeError("Could not allocate file write buffers");
+        }
+        buffers[i].data = static_cast<char *>(p);
+        freeBuffers.push_back(i);
+    }
+    ioThread = std::thread(&FileWriter::IoThread, this);
+}
+
+FileWriter::~FileWriter() {
+    try {
+        Close();
+    } catch (const std::exception &e) {
+        LOG(logERROR) << e.what();
+    }
+    DiscardPrepared();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        killThread = true;
+    }
+    submitted.notify_one();
+    ioThread.join();
+    StopReapThread();
+    for (auto &it : buffers)
+        free(it.data);
+}
+
+FileWriter::FileDescriptor FileWriter::CreateFile(const std::string &fname,
+                                                  bool overWriteEnable,
+                                                  bool direct, uint64_t size) {
+    FileDescriptor file;
+    int flags = O_WRONLY | O_CREAT | (overWriteEnable ? O_TRUNC : O_EXCL);
+    file.direct = direct;
+    file.fd = open(fname.c_str(), flags | (direct ? O_DIRECT : 0), 0644);
+    // eg. tmpfs does not support O_DIRECT
+    if (file.fd < 0 && errno == EINVAL) {
+        file.direct = false;
+        file.fd = open(fname.c_str(), flags, 0644);
+    }
+    if (file.fd < 0) {
+        file.error = "Could not create" +
+                     std::string(overWriteEnable ? "" : "/overwrite") +
+                     " file " + fname + " [" + strerror(errno) + "]";
+        return file;
+    }
+    // not supported by all file systems, then just not preallocated
+    if (size != 0 && fallocate(file.fd, 0, 0, size) == 0) {
+        file.preallocated = true;
+    }
+    return file;
+}
+
+std::string FileWriter::GetPreparedFileName(const std::string &fname) {
+    return fname + ".prepared";
+}
+
+FileWriter::FileDescriptor FileWriter::TakePrepared(bool overWriteEnable) {
+    FileDescriptor file = preparedFile.get();
+    if (file.fd < 0) {
+        return FileDescriptor{};
+    }
+    std::string tmpName = GetPreparedFileName(preparedFileName);
+    // without overwrite, link fails if the file exists
+    int ret = overWriteEnable
+                  ? rename(tmpName.c_str(), preparedFileName.c_str())
+                  : link(tmpName.c_str(), preparedFileName.c_str());
+    if (ret != 0 || !overWriteEnable) {
+        unlink(tmpName.c_str());
+    }
+    if (ret != 0) {
+        close(file.fd);
+        return FileDescriptor{};
+    }
+    return file;
+}
+
+void FileWriter::Open(const std::string &fname, bool overWriteEnable) {
+    Close();
+    FileDescriptor file;
+    if (preparedFile.valid() && preparedFileName == fname) {
+        file = TakePrepared(overWriteEnable);
+    } else {
+        DiscardPrepared();
+    }
+    // not prepared or it could not be used, created here for the error
+    if (file.fd < 0) {
+        // frames in the fifo are not aligned for O_DIRECT
+        file = CreateFile(fname, overWriteEnable, !useRing, 0);
+    }
+    if (file.fd < 0) {
+        throw RuntimeError(file.error);
+    }
+    fd = file.fd;
+    direct = file.direct;
+    preallocated = file.preallocated;
+    fileName = fname;
+    std::lock_guard<std::mutex> lock(mutex);
+    offset = 0;
+    error.clear();
+    stats = Statistics{};
+    stats.direct = direct;
+    stats.preallocated = preallocated;
+    totalLatencyMs = 0;
+}
+
+void FileWriter::Prepare(const std::string &fname, uint64_t size) {
+    DiscardPrepared();
+    preparedFileName = fname;
+    // a file of that name is only replaced when opened
+    preparedFile =
+        std::async(std::launch::async, &FileWriter::CreateFile,
+                   GetPreparedFileName(fname), true, !useRing, size);
+}
+
+void FileWriter::DiscardPrepared() {
+    if (!preparedFile.valid()) {
+        return;
+    }
+    FileDescriptor file = preparedFile.get();
+    if (file.fd >= 0) {
+        close(file.fd);
+        unlink(GetPreparedFileName(preparedFileName).c_str());
+    }
+}
+
+bool FileWriter::IsOpen() const { return fd >= 0; }
+
+void FileWriter::Write(const void *data, size_t size) {
+    if (useRing) {
+        // data does not outlive this call
+        WriteFrom(data, size, nullptr);
+        std::unique_lock<std::mutex> lock(mutex);
+        writesCompleted.wait(lock, [this]() { return inFlight == 0; });
+        return;
+    }
+    auto src = static_cast<const char *>(data);
+    while (size != 0) {
+        if (current == -1) {
+            std::unique_lock<std::mutex> lock(mutex);
+            written.wait(lock, [this]() { return !freeBuffers.empty(); });
+            if (!error.empty()) {
+                throw RuntimeError(error);
+            }
+            current = freeBuffers.front();
+            freeBuffers.pop_front();
+            buffers[current].size = 0;
+        }
+        auto &buffer = buffers[current];
+        size_t n = std::min(size, (size_t)FILE_BUFFER_SIZE - buffer.size);
+        memcpy(buffer.data + buffer.size, src, n);
+        buffer.size += n;
+        src += n;
+        size -= n;
+        if (buffer.size == FILE_BUFFER_SIZE) {
+            SubmitCurrentBuffer();
+        }
+    }
+}
+
+void FileWriter::SubmitCurrentBuffer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(current);
+        int depth = pending.size() + (writing ? 1 : 0);
+        if (depth > stats.maxQueueDepth)
+            stats.maxQueueDepth = depth;
+    }
+    current = -1;
+    submitted.notify_one();
+}
+
+void FileWriter::Close() {
+    if (fd < 0) {
+        return;
+    }
+    {
+        // the reap thread completes or drops every request in flight
+        std::unique_lock<std::mutex> lock(mutex);
+        writesCompleted.wait(lock, [this]() { return inFlight == 0; });
+    }
+    if (current != -1) {
+        if (buffers[current].size != 0) {
+            SubmitCurrentBuffer();
+        } else {
+            std::lock_guard<std::mutex> lock(mutex);
+            freeBuffers.push_back(current);
+            current = -1;
+        }
+    }
+    std::string err;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        written.wait(lock, [this]() { return pending.empty() && !writing; });
+        err = error;
+        if (stats.writes != 0) {
+            stats.meanLatencyMs = totalLatencyMs / stats.writes;
+        }
+    }
+    if (preallocated && ftruncate(fd, offset) == -1 && err.empty()) {
+        err = std::to_string(index) + " : Could not truncate file " +
+              fileName + " [" + strerror(errno) + "]";
+    }
+    close(fd);
+    fd = -1;
+    if (!err.empty()) {
+        throw RuntimeError(err);
+    }
+}
+
+FileWriter::Statistics FileWriter::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+bool FileWriter::UseIoUring(bool enable) {
+    // a failed ring is set up again
+    if (enable && ring != nullptr && ringFailed) {
+        StopReapThread();
+        ring.reset();
+        registeredMemory = nullptr;
+        registeredLength = 0;
+    }
+    if (enable && ring == nullptr) {
+        try {
+            ring = make_unique<IoUring>(FILE_URING_QUEUE_DEPTH);
+        } catch (const RuntimeError &e) {
+            useRing = false;
+            return false;
+        }
+        wakeFd = eventfd(0, EFD_CLOEXEC);
+        if (wakeFd < 0) {
+            ring.reset();
+            useRing = false;
+            return false;
+        }
+        requests.assign(FILE_URING_QUEUE_DEPTH, Request{});
+        freeRequests.clear();
+        for (int i = 0; i != FILE_URING_QUEUE_DEPTH; ++i) {
+            freeRequests.push_back(i);
+        }
+        inFlight = 0;
+        ringFailed = false;
+        killReapThread = false;
+        reapThread = std::thread(&FileWriter::ReapThread, this);
+    }
+    useRing = enable;
+    return true;
+}
+
+void FileWriter::StopReapThread() {
+    if (!reapThread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        killReapThread = true;
+    }
+    uint64_t value = 1;
+    if (write(wakeFd, &value, sizeof(value)) != sizeof(value)) {
+        LOG(logERROR) << index << ": Could not wake io_uring reap thread";
+    }
+    reapThread.join();
+    close(wakeFd);
+    wakeFd = -1;
+}
+
+void FileWriter::SetMaxWritesInFlight(int n) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maxInFlight = std::max(1, std::min(n, FILE_URING_QUEUE_DEPTH));
+}
+
+bool FileWriter::IsIoUring() const { return useRing; }
+
+void FileWriter::RegisterMemory(char *memory, size_t length) {
+    if (ring == nullptr) {
+        return;
+    }
+    // always again, a new fifo could be mapped at the same address
+    if (registeredMemory != nullptr) {
+        ring->UnregisterBuffers();
+        registeredMemory = nullptr;
+        registeredLength = 0;
+    }
+    std::vector<iovec> iovecs;
+    for (size_t i = 0; i < length; i += MAX_REGISTERED_BUFFER_SIZE) {
+        iovecs.push_back(
+            {memory + i, std::min(MAX_REGISTERED_BUFFER_SIZE, length - i)});
+    }
+    try {
+        ring->RegisterBuffers(iovecs);
+        registeredMemory = memory;
+        registeredLength = length;
+    } catch (const RuntimeError &e) {
+        LOG(logWARNING) << index
+                        << ": Writing files without registered buffers";
+    }
+}
+
+void FileWriter::SetReleaseCallBack(std::function<void(char *)> func) {
+    release = func;
+}
+
+void FileWriter::WriteFrom(const void *data, size_t size, char *tag) {
+    if (!useRing || fd < 0) {
+        throw RuntimeError(std::to_string(index) +
+                           " : No file open for io_uring writes");
+    }
+    int i = 0;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        writesCompleted.wait(lock, [this]() {
+            return inFlight < maxInFlight || !error.empty() || ringFailed;
+        });
+        if (!error.empty()) {
+            throw RuntimeError(error);
+        }
+        if (ringFailed) {
+            throw RuntimeError(std::to_string(index) +
+                               " : io_uring failed in a previous file");
+        }
+        i = freeRequests.back();
+        freeRequests.pop_back();
+    }
+    auto &r = requests[i];
+    r.data = static_cast<const char *>(data);
+    r.size = size;
+    r.offset = offset;
+    r.tag = tag;
+    r.start = std::chrono::steady_clock::now();
+
+    // registered buffer only if it does not cross into the next one
+    int bufIndex = -1;
+    if (registeredMemory != nullptr && r.data >= registeredMemory &&
+        r.data + size <= registeredMemory + registeredLength) {
+        size_t first = (r.data - registeredMemory) / MAX_REGISTERED_BUFFER_SIZE;
+        size_t last =
+            (r.data + size - 1 - registeredMemory) / MAX_REGISTERED_BUFFER_SIZE;
+        if (first == last) {
+            bufIndex = first;
+        }
+    }
+    // never full, as there are not more requests than entries
+    ring->PrepareWrite(fd, r.data, size, offset, bufIndex, i);
+    // counted before submitting, as it can complete before Submit returns
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        r.submitted = true;
+        ++inFlight;
+        if (inFlight > stats.maxQueueDepth)
+            stats.maxQueueDepth = inFlight;
+    }
+    try {
+        ring->Submit();
+    } catch (const RuntimeError &e) {
+        // not picked up by the kernel and never submitted again, the caller
+        // releases the buffer
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            r.submitted = false;
+            --inFlight;
+            freeRequests.push_back(i);
+            ringFailed = true;
+            if (error.empty()) {
+                error = std::to_string(index) + " : " + e.what();
+            }
+        }
+        writesCompleted.notify_all();
+        throw;
+    }
+    offset += size;
+}
+
+void FileWriter::ReapThread() {
+    pollfd fds[2]{{ring->GetCompletionFd(), POLLIN, 0}, {wakeFd, POLLIN, 0}};
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (killReapThread) {
+                return;
+            }
+        }
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::string err = std::to_string(index) +
+                              " : Could not wait for io_uring completions [" +
+                              strerror(errno) + "]";
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ringFailed = true;
+                if (error.empty()) {
+                    error = err;
+                }
+                DropRequests();
+            }
+            writesCompleted.notify_all();
+            LOG(logERROR) << err;
+            return;
+        }
+        // reset before reaping, so that later completions wake it again
+        uint64_t value = 0;
+        for (auto &it : fds) {
+            if ((it.revents & POLLIN) != 0 &&
+                read(it.fd, &value, sizeof(value)) < 0) {
+                LOG(logDEBUG1) << index << ": Could not read eventfd";
+            }
+        }
+        uint64_t userData = 0;
+        int result = 0;
+        while (ring->PeekCompletion(userData, result)) {
+            CompleteRequest(userData, result);
+        }
+    }
+}
+
+void FileWriter::DropRequests() {
+    // the kernel might still write them, but nothing reaps them anymore
+    for (size_t i = 0; i != requests.size(); ++i) {
+        auto &r = requests[i];
+        if (!r.submitted) {
+            continue;
+        }
+        if (r.tag != nullptr && release) {
+            release(r.tag);
+        }
+        r.submitted = false;
+        freeRequests.push_back(i);
+    }
+    inFlight = 0;
+}
+
+void FileWriter::CompleteRequest(int i, int result) {
+    auto &r = requests[i];
+    // short write (eg. disk full), the rest synchronously for the error
+    if (result >= 0 && (size_t)result != r.size) {
+        size_t done = result;
+        while (done != r.size) {
+            ssize_t ret =
+                pwrite(fd, r.data + done, r.size - done, r.offset + done);
+            if (ret < 0 && errno == EINTR) {
+                continue;
+            }
+            if (ret <= 0) {
+                result = (ret == 0) ? -ENOSPC : -errno;
+                break;
+            }
+            done += ret;
+        }
+    }
+    std::chrono::duration<double, std::milli> latency =
+        std::chrono::steady_clock::now() - r.start;
+    // before it counts as completed, so that it is released once Close returns
+    if (r.tag != nullptr && release) {
+        release(r.tag);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (result < 0) {
+            if (error.empty()) {
+                error = std::to_string(index) + " : Write to file " +
+                        fileName + " failed [" + strerror(-result) + "]";
+            }
+        } else {
+            ++stats.writes;
+            stats.bytes += r.size;
+            totalLatencyMs += latency.count();
+            if (latency.count() > stats.maxLatencyMs)
+                stats.maxLatencyMs = latency.count();
+        }
+        r.submitted = false;
+        --inFlight;
+        freeRequests.push_back(i);
+    }
+    writesCompleted.notify_all();
+}
+
+void FileWriter::IoThread() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        submitted.wait(lock,
+                       [this]() { return killThread || !pending.empty(); });
+        if (pending.empty()) {
+            return;
+        }
+        int i = pending.front();
+        pending.pop_front();
+        writing = true;
+        bool failed = !error.empty();
+        lock.unlock();
+
+        auto start = std::chrono::steady_clock::now();
+        std::string err;
+        if (!failed) {
+            try {
+                WriteBuffer(buffers[i]);
+            } catch (const std::exception &e) {
+                err = e.what();
+            }
+        }
+        std::chrono::duration<double, std::milli> latency =
+            std::chrono::steady_clock::now() - start;
+
+        lock.lock();
+        if (!failed) {
+            ++stats.writes;
+            stats.bytes += buffers[i].size;
+            totalLatencyMs += latency.count();
+            if (latency.count() > stats.maxLatencyMs)
+                stats.maxLatencyMs = latency.count();
+        }
+        if (!err.empty() && error.empty()) {
+            error = err;
+        }
+        writing = false;
+        freeBuffers.push_back(i);
+        written.notify_all();
+    }
+}
+
+void FileWriter::WriteBuffer(Buffer &buffer) {
+    size_t done = 0;
+    while (done != buffer.size) {
+        size_t n = buffer.size - done;
+        // O_DIRECT needs aligned sizes, only the last buffer of a file has
+        // an unaligned tail, which is written through the page cache
+        if (direct && n % FILE_BUFFER_ALIGNMENT != 0) {
+            if (n >= FILE_BUFFER_ALIGNMENT) {
+                n -= n % FILE_BUFFER_ALIGNMENT;
+            } else {
+                int flags = fcntl(fd, F_GETFL);
+                if (flags == -1 ||
+                    fcntl(fd, F_SETFL, flags & ~O_DIRECT) == -1) {
+                    throw RuntimeError(std::to_string(index) +
+                                       " : Could not switch off O_DIRECT for " +
+                                       fileName);
+                }
+                direct = false;
+            }
+        }
+        ssize_t ret = pwrite(fd, buffer.data + done, n, offset);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            throw RuntimeError(std::to_string(index) + " : Write to file " +
+                               fileName + " failed [" + strerror(errno) + "]");
+        }
+        done += ret;
+        offset += ret;
+    }
+}
+
+} // namespace sls
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#pragma once
+/************************************************
+ * @file FileWriter.h
+ * @short writes a file asynchronously, from large
+ * aligned buffers with O_DIRECT in its own thread
+ * or directly from the fifo with io_uring (its
+ * completions reaped in their own thread)
+ ***********************************************/
+
+#include "sls/logger.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sls {
+
+class IoUring;
+
+class FileWriter {
+  public:
+    /** of the file closed last */
+    struct Statistics {
+        uint64_t bytes{0};
+        uint64_t writes{0};
+        /** buffers waiting for the io thread, including the one written, or
+         * io_uring writes in flight */
+        int maxQueueDepth{0};
+        double meanLatencyMs{0};
+        double maxLatencyMs{0};
+        bool direct{false};
+        /** created in the background and preallocated */
+        bool preallocated{false};
+    };
+
+    explicit FileWriter(int index);
+    ~FileWriter();
+    FileWriter(const FileWriter &) = delete;
+    FileWriter &operator=(const FileWriter &) = delete;
+
+    /** O_DIRECT if the file system supports it, throws if file cannot be
+     * created. Takes over the file if it was prepared */
+    void Open(const std::string &fileName, bool overWriteEnable);
+    bool IsOpen() const;
+    /** creates the next file in the background under a temporary name and
+     * preallocates size bytes (fallocate), so that opening it is only a
+     * rename. It is truncated to what was written on close */
+    void Prepare(const std::string &fileName, uint64_t size);
+    /** removes the prepared temporary file if it was not opened */
+    void DiscardPrepared();
+    /** copies into the current buffer, waits only if all buffers are being
+     * written. Throws if a previous write failed */
+    void Write(const void *data, size_t size);
+    /** writes what is left, waits for all writes and closes the file. Throws
+     * if a write failed */
+    void Close();
+    Statistics GetStatistics() const;
+
+    /** io_uring instead of the io thread from the next Open. Returns false
+     * if io_uring is not available */
+    bool UseIoUring(bool enable);
+    bool IsIoUring() const;
+    /** registers (pins) memory that WriteFrom will be called with (fifo).
+     * Call again when the memory is reallocated */
+    void RegisterMemory(char *memory, size_t length);
+    /** params: tag of WriteFrom. Called from the thread reaping the
+     * completions */
+    void SetReleaseCallBack(std::function<void(char *)> func);
+    /** io_uring writes in flight at most (at most FILE_URING_QUEUE_DEPTH),
+     * eg. less than the fifo depth so that the fifo is not held by writes */
+    void SetMaxWritesInFlight(int n);
+    /** io_uring only: writes directly from data without copying, waits if
+     * the maximum number of writes are in flight. Once written, tag is handed
+     * to the release call back. Throws if it could not be submitted (then tag
+     * is not released) */
+    void WriteFrom(const void *data, size_t size, char *tag);
+
+  private:
+    struct Buffer {
+        char *data{nullptr};
+        size_t size{0};
+    };
+    struct FileDescriptor {
+        int fd{-1};
+        bool direct{false};
+        bool preallocated{false};
+        /** if fd < 0 */
+        std::string error;
+    };
+    /** io_uring write in flight */
+    struct Request {
+        const char *data{nullptr};
+        size_t size{0};
+        uint64_t offset{0};
+        char *tag{nullptr};
+        /** counted in inFlight */
+        bool submitted{false};
+        std::chrono::steady_clock::time_point start;
+    };
+
+    static FileDescriptor CreateFile(const std::string &fileName,
+                                     bool overWriteEnable, bool direct,
+                                     uint64_t size);
+    /** temporary name of the prepared file */
+    static std::string GetPreparedFileName(const std::string &fileName);
+    /** moves the prepared file to its name, fd -1 if it cannot be used */
+    FileDescriptor TakePrepared(bool overWriteEnable);
+    void SubmitCurrentBuffer();
+    void IoThread();
+    void WriteBuffer(Buffer &buffer);
+    /** io_uring: reaps completions as the ring signals them */
+    void ReapThread();
+    void StopReapThread();
+    void CompleteRequest(int i, int result);
+    /** reaping failed, the requests in flight are given up and their tags
+     * released (locked) */
+    void DropRequests();
+
+    const int index;
+    int fd{-1};
+    std::string fileName;
+    bool direct{false};
+    bool preallocated{false};
+    std::string preparedFileName;
+    std::future<FileDescriptor> preparedFile;
+    std::vector<Buffer> buffers;
+    /** being filled by the caller, -1 if none */
+    int current{-1};
+    /** only the io thread changes the offset once open */
+    uint64_t offset{0};
+
+    mutable std::mutex mutex;
+    std::condition_variable submitted;
+    std::condition_variable written;
+    std::deque<int> pending;
+    std::deque<int> freeBuffers;
+    bool writing{false};
+    bool killThread{false};
+    std::string error;
+    Statistics stats;
+    double totalLatencyMs{0};
+    std::thread ioThread;
+
+    std::unique_ptr<IoUring> ring;
+    bool useRing{false};
+    std::vector<Request> requests;
+    /** guarded by mutex, like inFlight and ringFailed */
+    std::vector<int> freeRequests;
+    int inFlight{0};
+    int maxInFlight{0};
+    /** no more writes are submitted */
+    bool ringFailed{false};
+    bool killReapThread{false};
+    /** eventfd to wake the reap thread */
+    int wakeFd{-1};
+    std::condition_variable writesCompleted;
+    std::thread reapThread;
+    char *registeredMemory{nullptr};
+    size_t registeredLength{0};
+    std::function<void(char *)> release;
+};
+
+} // namespace sls
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+/************************************************
+ * @file FrameSynchronizer.cpp
+ * @short subscribes to the zmq streams of all ports,
+ * matches their images by frame number (and sub
+ * frame index for eiger 32 bit) and publishes
+ * the complete detector image of each frame
+ ***********************************************/
+
+#include "FrameSynchronizer.h"
+#include "receiver_defs.h"
+#include "sls/ToString.h"
+#include "sls/container_utils.h"
+#include "sls/logger.h"
+#include "sls/sls_detector_exceptions.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace sls {
+
+FrameSynchronizer::FrameSynchronizer(const std::vector<std::string> &sources,
+                                     uint16_t port, size_t window,
+                                     std::chrono::milliseconds timeout)
+    : window(window), timeout(timeout), lastReceived(sources.size()),
+      ended(sources.size(), false) {
+    if (sources.empty()) {
+        throw RuntimeError("Frame synchronizer needs at least one source");
+    }
+    for (const auto &it : sources) {
+        auto pos = it.rfind(':');
+        if (pos == std::string::npos || pos == 0) {
+            throw RuntimeError("Invalid frame synchronizer source " + it +
+                               ". Expected ip:port");
+        }
+        auto hostname = it.substr(0, pos);
+        auto portnum = StringTo<uint16_t>(it.substr(pos + 1));
+        sockets.push_back(make_unique<ZmqSocket>(hostname.c_str(), portnum));
+        if (sockets.back()->Connect() != 0) {
+            throw RuntimeError("Could not connect to " +
+                               sockets.back()->GetZmqServerAddress());
+        }
+    }
+    publisher = make_unique<ZmqSocket>(port, "*");
+    LOG(logINFO) << "Frame synchronizer publishing the images of "
+                 << sockets.size() << " ports at "
+                 << publisher->GetZmqServerAddress() << " [window: " << window
+                 << ", timeout: " << ToString(timeout) << "]";
+
+    threads.emplace_back(&FrameSynchronizer::PublishThread, this);
+    for (size_t i = 0; i != sockets.size(); ++i) {
+        threads.emplace_back(&FrameSynchronizer::ReceiveThread, this, i);
+    }
+}
+
+FrameSynchronizer::~FrameSynchronizer() {
+    killThreads = true;
+    frameChanged.notify_all();
+    for (auto &it : threads) {
+        it.join();
+    }
+}
+
+FrameSynchronizer::Statistics FrameSynchronizer::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return statistics;
+}
+
+FrameSynchronizer::Key FrameSynchronizer::GetKey(const zmqHeader &header) {
+    // expLength is the sub frame index only for eiger 32 bit, else the
+    // (measured) exposure time, which can differ between ports
+    uint32_t subFrame = (header.detType == EIGER && header.dynamicRange == 32)
+                            ? header.expLength
+                            : 0;
+    return Key{header.frameNumber, subFrame};
+}
+
+void FrameSynchronizer::ReceiveThread(size_t index) {
+    ZmqSocket &socket = *sockets[index];
+    while (!killThreads) {
+        if (!socket.WaitForMessage(SYNC_POLL_MS)) {
+            continue;
+        }
+        auto part = make_unique<Part>();
+        if (!socket.ReceiveHeader(index, part->header,
+                                  SLS_DETECTOR_JSON_HEADER_VERSION)) {
+            AddEnd(index);
+            continue;
+        }
+        // decompressed if streamed compressed
+        part->data.resize(part->header.imageSize);
+        socket.ReceiveData(index, part->data.data(), part->data.size());
+        AddPart(index, std::move(part));
+    }
+}
+
+void FrameSynchronizer::AddPart(size_t index, std::unique_ptr<Part> part) {
+    Key key = GetKey(part->header);
+    std::lock_guard<std::mutex> lock(mutex);
+    lastReceived[index] = std::max(lastReceived[index], key);
+    if (published && key <= lastPublished) {
+        ++statistics.late;
+        return;
+    }
+    Frame &frame = frames[key];
+    if (frame.parts.empty()) {
+        frame.parts.resize(sockets.size());
+        frame.firstArrival = Clock::now();
+    }
+    if (!frame.parts[index]) {
+        ++frame.numParts;
+    }
+    frame.parts[index] = std::move(part);
+    frameChanged.notify_one();
+}
+
+void FrameSynchronizer::AddEnd(size_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ended[index] = true;
+    frameChanged.notify_one();
+}
+
+void FrameSynchronizer::PublishThread() {
+    const auto poll = std::min(timeout, std::chrono::milliseconds(SYNC_POLL_MS));
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!killThreads) {
+        // in order of frame number
+        while (!frames.empty() && IsOldestReady(Clock::now())) {
+            auto it = frames.begin();
+            Key key = it->first;
+            Frame frame = std::move(it->second);
+            frames.erase(it);
+            published = true;
+            lastPublished = key;
+            lock.unlock();
+            Publish(key, frame);
+            lock.lock();
+        }
+
+        if (frames.empty() &&
+            std::all_of(ended.begin(), ended.end(), [](bool e) { return e; })) {
+            lock.unlock();
+            PublishEnd();
+            lock.lock();
+            std::fill(ended.begin(), ended.end(), false);
+            std::fill(lastReceived.begin(), lastReceived.end(), Key{0, 0});
+            published = false;
+            lastPublished = Key{0, 0};
+            LOG(logINFO) << "Frame synchronizer: end of acquisition [complete: "
+                         << statistics.complete
+                         << ", incomplete: " << statistics.incomplete
+                         << ", late: " << statistics.late << "]";
+        }
+        frameChanged.wait_for(lock, poll);
+    }
+}
+
+bool FrameSynchronizer::IsOldestReady(Clock::time_point now) const {
+    const auto &oldest = *frames.begin();
+    const Frame &frame = oldest.second;
+    if (frame.numParts == sockets.size() || frames.size() > window ||
+        now - frame.firstArrival >= timeout) {
+        return true;
+    }
+    // ports stream in order, a port past it will not send it any more
+    for (size_t i = 0; i != sockets.size(); ++i) {
+        if (!frame.parts[i] && !ended[i] && lastReceived[i] <= oldest.first) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FrameSynchronizer::Publish(Key key, Frame &frame) {
+    const uint64_t frameNumber = key.first;
+    const Part *first = nullptr;
+    for (const auto &it : frame.parts) {
+        if (it) {
+            first = it.get();
+            break;
+        }
+    }
+    zmqHeader header = first->header;
+    const uint32_t nX = std::max(header.ndetx, 1u);
+    const uint32_t nY = std::max(header.ndety, 1u);
+    const size_t size = header.imageSize;
+    const size_t rowBytes =
+        (size_t)header.npixelsx * header.dynamicRange / 8;
+    // ctb (or other layouts): images of the ports one after the other
+    const bool rows = (header.detType != CHIPTESTBOARD &&
+                       rowBytes * header.npixelsy == size);
+
+    auto *image = new std::vector<char>(size * nX * nY, (char)0xFF);
+    bool complete = (frame.numParts == frame.parts.size());
+    for (const auto &part : frame.parts) {
+        if (!part) {
+            continue;
+        }
+        const zmqHeader &h = part->header;
+        if (h.column >= nX || h.row >= nY || h.imageSize != size) {
+            LOG(logWARNING) << "Frame synchronizer: image of port (row "
+                            << h.row << ", column " << h.column
+                            << ") does not fit frame " << frameNumber;
+            complete = false;
+            continue;
+        }
+        complete &= h.completeImage;
+        if (!rows) {
+            memcpy(image->data() + (h.row * nX + h.column) * size,
+                   part->data.data(), size);
+            continue;
+        }
+        const size_t detRowBytes = rowBytes * nX;
+        char *dst = image->data() + h.row * header.npixelsy * detRowBytes +
+                    h.column * rowBytes;
+        const bool flip = (h.detType == EIGER && h.flipRows != 0);
+        for (uint32_t i = 0; i != header.npixelsy; ++i) {
+            uint32_t row = flip ? header.npixelsy - 1 - i : i;
+            memcpy(dst + row * detRowBytes, part->data.data() + i * rowBytes,
+                   rowBytes);
+        }
+    }
+
+    header.ndetx = 1;
+    header.ndety = 1;
+    header.npixelsx *= nX;
+    header.npixelsy *= nY;
+    header.imageSize = image->size();
+    header.row = 0;
+    header.column = 0;
+    header.flipRows = 0;
+    header.completeImage = complete;
+    header.compression.clear();
+    if (!publisher->SendHeader(0, header)) {
+        LOG(logERROR) << "Could not send zmq header for fnum " << frameNumber
+                      << " of frame synchronizer";
+    }
+    if (!publisher->SendData(image->data(), image->size(), FreeImage,
+                             image)) {
+        LOG(logERROR) << "Could not send zmq data for fnum " << frameNumber
+                      << " of frame synchronizer";
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (complete) {
+        ++statistics.complete;
+    } else {
+        ++statistics.incomplete;
+    }
+}
+
+void FrameSynchronizer::PublishEnd() {
+    zmqHeader header;
+    header.data = false;
+    header.jsonversion = SLS_DETECTOR_JSON_HEADER_VERSION;
+    if (!publisher->SendHeader(0, header)) {
+        LOG(logERROR) << "Could not send zmq dummy header of frame "
+                         "synchronizer";
+    }
+}
+
+void FrameSynchronizer::FreeImage(void *, void *hint) {
+    delete static_cast<std::vector<char> *>(hint);
+}
+
+} // namespace sls
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#pragma once
+/************************************************
+ * @file FrameSynchronizer.h
+ * @short subscribes to the zmq streams of all ports,
+ * matches their images by frame number (and sub
+ * frame index for eiger 32 bit) and publishes
+ * the complete detector image of each frame
+ ***********************************************/
+
+#include "sls/ZmqSocket.h"
+#include "sls/sls_detector_defs.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sls {
+
+class FrameSynchronizer : private virtual slsDetectorDefs {
+  public:
+    /** frames published (since the start) */
+    struct Statistics {
+        uint64_t complete{0};
+        /** missing ports filled with 0xFF */
+        uint64_t incomplete{0};
+        /** images of frames already published, discarded */
+        uint64_t late{0};
+    };
+
+    /**
+     * Connects to all sources and publishes (as the receiver, one header
+     * and one data message per frame, a dummy header at the end of an
+     * acquisition). Throws
+     * @param sources receiver streams (rx_zmqip:rx_zmqport) of all ports
+     * @param port to publish the detector images on
+     * @param window frames waiting for ports at most, the oldest is then
+     * published incomplete
+     * @param timeout a frame waits at most this long for its ports
+     */
+    FrameSynchronizer(const std::vector<std::string> &sources, uint16_t port,
+                      size_t window, std::chrono::milliseconds timeout);
+    ~FrameSynchronizer();
+
+    Statistics GetStatistics() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+    /** frame number and sub frame index (eiger 32 bit, else 0) */
+    using Key = std::pair<uint64_t, uint32_t>;
+
+    /** image of a port */
+    struct Part {
+        zmqHeader header;
+        std::vector<char> data;
+    };
+
+    struct Frame {
+        /** index of the source, nullptr if not yet received */
+        std::vector<std::unique_ptr<Part>> parts;
+        size_t numParts{0};
+        Clock::time_point firstArrival;
+    };
+
+    static Key GetKey(const zmqHeader &header);
+    void ReceiveThread(size_t index);
+    void AddPart(size_t index, std::unique_ptr<Part> part);
+    /** end of acquisition (or error) of a source */
+    void AddEnd(size_t index);
+
+    void PublishThread();
+    /** complete, cannot complete any more, window full or timed out */
+    bool IsOldestReady(Clock::time_point now) const;
+    /** places the ports as the client does, rows of flipped ports
+     * (eiger) in order */
+    void Publish(Key key, Frame &frame);
+    void PublishEnd();
+    /** zmq free function of the detector image (hint: its vector) */
+    static void FreeImage(void *data, void *hint);
+
+    std::vector<std::unique_ptr<ZmqSocket>> sockets;
+    std::unique_ptr<ZmqSocket> publisher;
+    const size_t window;
+    const std::chrono::milliseconds timeout;
+
+    mutable std::mutex mutex;
+    std::condition_variable frameChanged;
+    /** waiting for ports, by frame number and sub frame index */
+    std::map<Key, Frame> frames;
+    /** per source in this acquisition */
+    std::vector<Key> lastReceived;
+    std::vector<bool> ended;
+    bool published{false};
+    Key lastPublished{0, 0};
+    Statistics statistics;
+
+    std::atomic<bool> killThreads{false};
+    std::vector<std::thread> threads;
+};
+
+} // namespace sls
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+/* Subscribes to the zmq streams of the receivers of a detector and publishes
+ * the complete detector image of each frame */
+#include "FrameSynchronizer.h"
+#include "receiver_defs.h"
+#include "sls/ToString.h"
+#include "sls/logger.h"
+#include "sls/network_utils.h"
+#include "sls/sls_detector_defs.h"
+#include "sls/versionAPI.h"
+
+#include <csignal> //SIGINT
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <semaphore.h>
+#include <unistd.h>
+
+// gettid added in glibc 2.30
+#if __GLIBC__ == 2 && __GLIBC_MINOR__ < 30
+#include <sys/syscall.h>
+#define gettid() syscall(SYS_gettid)
+#endif
+
+sem_t semaphore;
+
+void sigInterruptHandler(int p) { sem_post(&semaphore); }
+
+int main(int argc, char *argv[]) {
+
+    std::string help_message =
+        "\nUsage: " + std::string(argv[0]) +
+        " [arguments] <ip:port> [<ip:port> ...]\n" +
+        "Subscribes to the zmq streams (rx_zmqip:rx_zmqport) of all ports "
+        "and publishes the complete image of each frame.\n" +
+        "Possible arguments are:\n" +
+        "\t-p, --port <port>       : Port to publish the images on. "
+        "Non-zero and 16 bit.\n" +
+        "\t-w, --window <frames>   : Frames waiting for ports at most. "
+        "Default: " +
+        std::to_string(SYNC_DEFAULT_WINDOW) + "\n" +
+        "\t-t, --timeout <ms>      : Time a frame waits for its ports at "
+        "most. Default: " +
+        std::to_string(SYNC_DEFAULT_TIMEOUT_MS) + "\n\n";
+
+    static struct option long_options[] = {
+        {"port", required_argument, nullptr, 'p'},
+        {"window", required_argument, nullptr, 'w'},
+        {"timeout", required_argument, nullptr, 't'},
+        {"version", no_argument, nullptr, 'v'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0}};
+
+    uint16_t port = 0;
+    int window = SYNC_DEFAULT_WINDOW;
+    int timeout = SYNC_DEFAULT_TIMEOUT_MS;
+    int option_index = 0;
+    int c = 0;
+    while ((c = getopt_long(argc, argv, "hvp:w:t:", long_options,
+                            &option_index)) != -1) {
+        try {
+            switch (c) {
+            case 'p':
+                port = sls::StringTo<uint16_t>(optarg);
+                sls::validatePortNumber(port);
+                break;
+            case 'w':
+                window = sls::StringTo<int>(optarg);
+                break;
+            case 't':
+                timeout = sls::StringTo<int>(optarg);
+                break;
+            case 'v':
+                std::cout << "SLS Receiver Version: " << APIRECEIVER
+                          << std::endl;
+                return EXIT_SUCCESS;
+            case 'h':
+                std::cout << help_message << std::endl;
+                return EXIT_SUCCESS;
+            default:
+                std::cout << help_message << std::endl;
+                return EXIT_FAILURE;
+            }
+        } catch (const std::exception &e) {
+            LOG(sls::logERROR) << "Invalid argument [" << e.what() << "]";
+            std::cout << help_message << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    if (port == 0 || optind == argc || window <= 0 || timeout <= 0) {
+        std::cout << help_message << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::vector<std::string> sources(argv + optind, argv + argc);
+
+    sem_init(&semaphore, 1, 0);
+
+    LOG(sls::logINFOBLUE) << "Created [ Tid: " << gettid() << " ]";
+
+    // Catch signal SIGINT to close sockets and call destructors properly
+    struct sigaction sa;
+    sa.sa_flags = 0;
+    sa.sa_handler = sigInterruptHandler;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGINT, &sa, nullptr) == -1) {
+        LOG(sls::logERROR) << "Could not set handler function for SIGINT";
+    }
+
+    try {
+        sls::FrameSynchronizer synchronizer(
+            sources, port, static_cast<size_t>(window),
+            std::chrono::milliseconds(timeout));
+        LOG(sls::logINFO) << "[ Press \'Ctrl+c\' to exit ]";
+        sem_wait(&semaphore);
+        sem_destroy(&semaphore);
+    } catch (const std::exception &e) {
+        LOG(sls::logERROR) << e.what();
+        return EXIT_FAILURE;
+    }
+    LOG(sls::logINFOBLUE) << "Exiting [ Tid: " << gettid() << " ]";
+    LOG(sls::logINFO) << "Exiting Frame Synchronizer";
+    return EXIT_SUCCESS;
+}
@@ -2,7 +2,11 @@
 // Copyright (C) 2021 Contributors to the SLS Detector Package
 #include "HDF5DataFile.h"
 #include "receiver_defs.h"
+#include "sls/bit_utils.h"
+#include "sls/compression_utils.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 
 namespace sls {
@@ -35,9 +39,16 @@ HDF5DataFile::HDF5DataFile(int index, std::mutex *hdf5Lib)
         H5::PredType::STD_U16LE, H5::PredType::STD_U32LE,
         H5::PredType::STD_U16LE, H5::PredType::STD_U8LE,
         H5::PredType::STD_U8LE,  strdatatype};
+    for (const auto &it : parameterDataTypes) {
+        paraSizes.push_back(it.getSize());
+    }
+    paraColumns.resize(parameterDataTypes.size());
 }
 
-HDF5DataFile::~HDF5DataFile() { CloseFile(); }
+HDF5DataFile::~HDF5DataFile() {
+    CloseFile();
+    StopCompressionThreads();
+}
 
 std::string HDF5DataFile::GetFileName() const { return fileName; }
 
@@ -57,6 +68,22 @@ std::vector<H5::DataType> HDF5DataFile::GetParameterDataTypes() const {
 slsDetectorDefs::fileFormat HDF5DataFile::GetFileFormat() const { return HDF5; }
 
 void HDF5DataFile::CloseFile() {
+    // images of the last chunk
+    if (chunkIndex != -1) {
+        try {
+            WriteChunk();
+        } catch (const RuntimeError &e) {
+            LOG(logERROR) << "Could not write last chunk of " << fileName;
+        }
+    }
+    if (!compressionThreads.empty()) {
+        try {
+            WaitForCompression();
+        } catch (const RuntimeError &e) {
+            LOG(logERROR) << "Could not write compressed chunks of "
+                          << fileName;
+        }
+    }
     std::lock_guard<std::mutex> lock(*hdf5Lib);
     try {
         H5::Exception::dontPrint(); // to handle errors
@@ -90,7 +117,8 @@ void HDF5DataFile::CreateFirstHDF5DataFile(
     const std::string &fNamePrefix, const uint64_t fIndex, const bool owEnable,
     const bool sMode, const uint16_t uPortNumber, const uint32_t mFramesPerFile,
     const uint64_t nImages, const uint32_t nX, const uint32_t nY,
-    const uint32_t dr) {
+    const uint32_t dr, const fileCompression c,
+    const int nCompressionThreads) {
 
     subFileIndex = 0;
     numFramesInFile = 0;
@@ -108,6 +136,7 @@ void HDF5DataFile::CreateFirstHDF5DataFile(
     overWriteEnable = owEnable;
     silentMode = sMode;
     udpPortNumber = uPortNumber;
+    compression = c;
 
     switch (dynamicRange) {
     case 12:
@@ -122,6 +151,31 @@ void HDF5DataFile::CreateFirstHDF5DataFile(
         break;
     }
 
+    uint32_t nDimz = ((dynamicRange == 4) ? (nPixelsX / 2) : nPixelsX);
+    pixelBytes = dataType.getSize();
+    imageBytes = (size_t)nPixelsY * nDimz * pixelBytes;
+    chunkImages = 1;
+    if (imageBytes != 0 && imageBytes < HDF5_IMAGE_CHUNK_SIZE) {
+        chunkImages = HDF5_IMAGE_CHUNK_SIZE / imageBytes;
+    }
+    // not larger than a file
+    uint64_t maxImages = (maxFramesPerFile == 0) ? numImages : maxFramesPerFile;
+    if (maxImages != 0 && maxImages < chunkImages) {
+        chunkImages = maxImages;
+    }
+    chunk.resize(chunkImages * imageBytes);
+    chunkFilled.resize(chunkImages);
+    freeChunks.clear();
+    if (compression != NO_COMPRESSION &&
+        compressionThreads.size() != (size_t)nCompressionThreads) {
+        StopCompressionThreads();
+        StartCompressionThreads(nCompressionThreads);
+    }
+    for (size_t j = 0; j != paraColumns.size(); ++j) {
+        paraColumns[j].resize(chunkImages * paraSizes[j]);
+    }
+    chunkIndex = -1;
+
     CreateFile();
 }
 
@@ -152,6 +206,8 @@ void HDF5DataFile::CreateFile() {
         // file
         H5::FileAccPropList fapl;
         fapl.setFcloseDegree(H5F_CLOSE_STRONG);
+        // image chunks are then written outside of the hdf5 lib mutex
+        HDF5RawDriver::SetFileAccess(fapl);
         fd = nullptr;
         if (!overWriteEnable)
             fd = new H5::H5File(fileName.c_str(), H5F_ACC_EXCL,
@@ -174,8 +230,8 @@ void HDF5DataFile::CreateFile() {
         hsize_t dimsMaxPara[PARA_RANK] = {H5S_UNLIMITED};
         // always create chunked dataset as unlimited is only
         // supported with chunked layout
-        hsize_t dimsChunk[DATA_RANK] = {MAX_CHUNKED_IMAGES, nDimy, nDimz};
-        hsize_t dimsChunkPara[PARA_RANK] = {MAX_CHUNKED_IMAGES};
+        hsize_t dimsChunk[DATA_RANK] = {chunkImages, nDimy, nDimz};
+        hsize_t dimsChunkPara[PARA_RANK] = {chunkImages};
 
         // dataspace
         dataSpace = nullptr;
@@ -190,6 +246,11 @@ void HDF5DataFile::CreateFile() {
         plist.setFillValue(dataType, &fill_value);
         // plistPara.setFillValue(dataType, &fill_value);
         plist.setChunk(DATA_RANK, dimsChunk);
+        // applied by the compression threads, readers only need hdf5
+        if (compression == SHUFFLE_DEFLATE) {
+            plist.setShuffle();
+            plist.setDeflate(HDF5_DEFLATE_LEVEL);
+        }
         plistPara.setChunk(PARA_RANK, dimsChunkPara);
 
         // dataset
@@ -232,147 +293,204 @@ void HDF5DataFile::WriteToFile(char *imageData, sls_receiver_header &header,
         ExtendDataset();
     }
 
-    WriteImageDatasets(currentFrameNumber, imageData);
-    WriteParameterDatasets(currentFrameNumber, header);
-}
-
-void HDF5DataFile::Convert12to16Bit(uint16_t *dst, uint8_t *src) {
-    for (int i = 0; i < EIGER_NUM_PIXELS; ++i) {
-        *dst = (uint16_t)(*src++ & 0xFF);
-        *dst++ |= (uint16_t)((*src & 0xF) << 8u);
-        ++i;
-        *dst = (uint16_t)((*src++ & 0xF0) >> 4u);
-        *dst++ |= (uint16_t)((*src++ & 0xFF) << 4u);
+    uint64_t nDimx =
+        ((maxFramesPerFile == 0) ? currentFrameNumber
+                                 : currentFrameNumber % maxFramesPerFile);
+    int64_t iChunk = nDimx / chunkImages;
+    if (chunkIndex != -1 && iChunk < chunkIndex) {
+        WriteLateImage(nDimx, imageData, header);
+        return;
+    }
+    if (iChunk != chunkIndex) {
+        if (chunkIndex != -1) {
+            WriteChunk();
+        }
+        chunkIndex = iChunk;
+        std::fill(chunkFilled.begin(), chunkFilled.end(), false);
     }
+    uint32_t i = nDimx % chunkImages;
+    CopyImage(&chunk[i * imageBytes], imageData);
+    CopyParameters(paraColumns, i, header);
+    chunkFilled[i] = true;
 }
 
-void HDF5DataFile::WriteImageDatasets(const uint64_t currentFrameNumber,
-                                      char *buffer) {
+void HDF5DataFile::CopyImage(char *dst, char *buffer) {
     // expand 12 bit to 16 bits
-    char *revBuffer = buffer;
     if (dynamicRange == 12) {
-        revBuffer = (char *)malloc(EIGER_16_BIT_IMAGE_SIZE);
-        if (revBuffer == nullptr) {
-            throw RuntimeError("Could not allocate memory for 12 bit to "
-                               "16 bit conversion in object " +
-                               std::to_string(index));
+        unpack12To16Bit((uint16_t *)dst, (uint8_t *)buffer,
+                        imageBytes / sizeof(uint16_t));
+    } else {
+        memcpy(dst, buffer, imageBytes);
+    }
+}
+
+void HDF5DataFile::CopyParameters(std::vector<std::vector<char>> &columns,
+                                  const uint32_t i,
+                                  sls_receiver_header &rheader) {
+    sls_detector_header &header = rheader.detHeader;
+    // in the order of parameterNames
+    const void *fields[] = {
+        &header.frameNumber, &header.expLength, &header.packetNumber,
+        &header.detSpec1,    &header.timestamp, &header.modId,
+        &header.row,         &header.column,    &header.detSpec2,
+        &header.detSpec3,    &header.detSpec4,  &header.detType,
+        &header.version};
+    size_t numFields = sizeof(fields) / sizeof(fields[0]);
+    for (size_t j = 0; j != numFields; ++j) {
+        memcpy(&columns[j][i * paraSizes[j]], fields[j], paraSizes[j]);
+    }
+
+    char *mask = &columns[numFields][i * paraSizes[numFields]];
+    // contiguous bitset
+    if (sizeof(sls_bitset) == sizeof(bitset_storage)) {
+        memcpy(mask, (char *)&(rheader.packetsMask), sizeof(bitset_storage));
+    }
+
+    // not contiguous bitset
+    else {
+        // get contiguous representation of bit mask
+        memset(mask, 0, sizeof(bitset_storage));
+        sls_bitset bits = rheader.packetsMask;
+        for (int k = 0; k < MAX_NUM_PACKETS; ++k)
+            mask[k >> 3] |= (bits[k] << (k & 7));
+    }
+}
+
+void HDF5DataFile::WriteChunk() {
+    // missing images get the fill value (-1), their parameters 0
+    for (uint32_t i = 0; i != chunkImages; ++i) {
+        if (!chunkFilled[i]) {
+            memset(&chunk[i * imageBytes], 0xFF, imageBytes);
+            for (size_t j = 0; j != paraColumns.size(); ++j) {
+                memset(&paraColumns[j][i * paraSizes[j]], 0, paraSizes[j]);
+            }
         }
-        Convert12to16Bit((uint16_t *)revBuffer, (uint8_t *)buffer);
     }
+    hsize_t start[DATA_RANK] = {(hsize_t)chunkIndex * chunkImages, 0, 0};
+    chunkIndex = -1;
 
-    std::lock_guard<std::mutex> lock(*hdf5Lib);
+    if (compression != NO_COMPRESSION) {
+        QueueChunkForCompression(start);
+    }
 
-    uint64_t nDimx =
-        ((maxFramesPerFile == 0) ? currentFrameNumber
-                                 : currentFrameNumber % maxFramesPerFile);
-    uint32_t nDimy = nPixelsY;
-    uint32_t nDimz = ((dynamicRange == 4) ? (nPixelsX / 2) : nPixelsX);
+    HDF5RawDriver::Write raw;
+    {
+        std::lock_guard<std::mutex> lock(*hdf5Lib);
+        if (compression == NO_COMPRESSION) {
+            raw = WriteRawChunk(chunk.data(), chunk.size(), 0, start);
+        }
+
+        // edge chunk only up to the extent of the dataset
+        hsize_t dims[DATA_RANK];
+        dataSpace->getSimpleExtentDims(dims);
+        hsize_t count = std::min((hsize_t)chunkImages, dims[0] - start[0]);
+
+        // parameters as one block per dataset
+        hsize_t countPara[PARA_RANK] = {count};
+        hsize_t startPara[PARA_RANK] = {start[0]};
+        size_t j = 0;
+        try {
+            H5::Exception::dontPrint(); // to handle errors
+            dataSpacePara->selectHyperslab(H5S_SELECT_SET, countPara,
+                                           startPara);
+            H5::DataSpace memspace(PARA_RANK, countPara);
+            for (; j != dataSetPara.size(); ++j) {
+                dataSetPara[j]->write(paraColumns[j].data(),
+                                      parameterDataTypes[j], memspace,
+                                      *dataSpacePara);
+            }
+        } catch (const H5::Exception &error) {
+            error.printErrorStack();
+            HDF5RawDriver::Complete(raw);
+            throw RuntimeError(
+                "Could not write parameters (index:" + std::to_string(j) +
+                ") to file in object " + std::to_string(index));
+        }
+    }
+    // image data outside of the hdf5 lib mutex
+    HDF5RawDriver::Complete(raw);
+}
+
+void HDF5DataFile::WriteLateImage(const uint64_t nDimx, char *buffer,
+                                  sls_receiver_header &rheader) {
+    // its chunk could still be in the compression queue
+    if (!compressionThreads.empty()) {
+        WaitForCompression();
+    }
+    lateImage.resize(imageBytes);
+    CopyImage(lateImage.data(), buffer);
+    lateParaColumns.resize(paraColumns.size());
+    for (size_t j = 0; j != lateParaColumns.size(); ++j) {
+        lateParaColumns[j].resize(paraSizes[j]);
+    }
+    CopyParameters(lateParaColumns, 0, rheader);
 
-    hsize_t count[3] = {1, nDimy, nDimz};
-    hsize_t start[3] = {nDimx, 0, 0};
-    hsize_t dims2[2] = {nDimy, nDimz};
+    std::lock_guard<std::mutex> lock(*hdf5Lib);
+    size_t j = 0;
     try {
         H5::Exception::dontPrint(); // to handle errors
-
+        hsize_t dims[DATA_RANK];
+        dataSpace->getSimpleExtentDims(dims);
+        hsize_t count[DATA_RANK] = {1, dims[1], dims[2]};
+        hsize_t start[DATA_RANK] = {nDimx, 0, 0};
         dataSpace->selectHyperslab(H5S_SELECT_SET, count, start);
-        H5::DataSpace memspace(2, dims2);
-        dataSet->write(revBuffer, dataType, memspace, *dataSpace);
-        memspace.close();
-        if (dynamicRange == 12) {
-            free(revBuffer);
+        H5::DataSpace memspace(DATA_RANK, count);
+        dataSet->write(lateImage.data(), dataType, memspace, *dataSpace);
+
+        hsize_t countPara[PARA_RANK] = {1};
+        hsize_t startPara[PARA_RANK] = {nDimx};
+        dataSpacePara->selectHyperslab(H5S_SELECT_SET, countPara, startPara);
+        H5::DataSpace memspacePara(PARA_RANK, countPara);
+        for (; j != dataSetPara.size(); ++j) {
+            dataSetPara[j]->write(lateParaColumns[j].data(),
+                                  parameterDataTypes[j], memspacePara,
+                                  *dataSpacePara);
         }
     } catch (const H5::Exception &error) {
-        if (dynamicRange == 12) {
-            free(revBuffer);
-        }
-        LOG(logERROR) << "Could not write to file in object " << index;
+        LOG(logERROR) << "Could not write late image to file in object "
+                      << index;
         error.printErrorStack();
-        throw RuntimeError("Could not write to file in object " +
+        throw RuntimeError("Could not write late image (parameter index:" +
+                           std::to_string(j) + ") to file in object " +
                            std::to_string(index));
     }
 }
 
-void HDF5DataFile::WriteParameterDatasets(const uint64_t currentFrameNumber,
-                                          sls_receiver_header rheader) {
-    std::lock_guard<std::mutex> lock(*hdf5Lib);
-
-    uint64_t fnum =
-        ((maxFramesPerFile == 0) ? currentFrameNumber
-                                 : currentFrameNumber % maxFramesPerFile);
-
-    sls_detector_header header = rheader.detHeader;
-    hsize_t count[PARA_RANK] = {1};
-    hsize_t start[PARA_RANK] = {fnum};
-    int i = 0;
+HDF5RawDriver::Write HDF5DataFile::WriteRawChunk(const char *data,
+                                                 size_t size,
+                                                 uint32_t filterMask,
+                                                 const hsize_t *start) {
     try {
         H5::Exception::dontPrint(); // to handle errors
-        dataSpacePara->selectHyperslab(H5S_SELECT_SET, count, start);
-        H5::DataSpace memspace(H5S_SCALAR);
-        dataSetPara[0]->write(&header.frameNumber, parameterDataTypes[0],
-                              memspace, *dataSpacePara);
-        i = 1;
-        dataSetPara[1]->write(&header.expLength, parameterDataTypes[1],
-                              memspace, *dataSpacePara);
-        i = 2;
-        dataSetPara[2]->write(&header.packetNumber, parameterDataTypes[2],
-                              memspace, *dataSpacePara);
-        i = 3;
-        dataSetPara[3]->write(&header.detSpec1, parameterDataTypes[3], memspace,
-                              *dataSpacePara);
-        i = 4;
-        dataSetPara[4]->write(&header.timestamp, parameterDataTypes[4],
-                              memspace, *dataSpacePara);
-        i = 5;
-        dataSetPara[5]->write(&header.modId, parameterDataTypes[5], memspace,
-                              *dataSpacePara);
-        i = 6;
-        dataSetPara[6]->write(&header.row, parameterDataTypes[6], memspace,
-                              *dataSpacePara);
-        i = 7;
-        dataSetPara[7]->write(&header.column, parameterDataTypes[7], memspace,
-                              *dataSpacePara);
-        i = 8;
-        dataSetPara[8]->write(&header.detSpec2, parameterDataTypes[8], memspace,
-                              *dataSpacePara);
-        i = 9;
-        dataSetPara[9]->write(&header.detSpec3, parameterDataTypes[9], memspace,
-                              *dataSpacePara);
-        i = 10;
-        dataSetPara[10]->write(&header.detSpec4, parameterDataTypes[10],
-                               memspace, *dataSpacePara);
-        i = 11;
-        dataSetPara[11]->write(&header.detType, parameterDataTypes[11],
-                               memspace, *dataSpacePara);
-        i = 12;
-        dataSetPara[12]->write(&header.version, parameterDataTypes[12],
-                               memspace, *dataSpacePara);
-        i = 13;
-
-        // contiguous bitset
-        if (sizeof(sls_bitset) == sizeof(bitset_storage)) {
-            dataSetPara[13]->write((char *)&(rheader.packetsMask),
-                                   parameterDataTypes[13], memspace,
-                                   *dataSpacePara);
-        }
-
-        // not contiguous bitset
-        else {
-            // get contiguous representation of bit mask
-            bitset_storage storage;
-            memset(storage, 0, sizeof(bitset_storage));
-            sls_bitset bits = rheader.packetsMask;
-            for (int i = 0; i < MAX_NUM_PACKETS; ++i)
-                storage[i >> 3] |= (bits[i] << (i & 7));
-            // write bitmask
-            dataSetPara[13]->write((char *)storage, parameterDataTypes[13],
-                                   memspace, *dataSpacePara);
+#if H5_VERSION_GE(1, 10, 3)
+        // only file space and chunk index are updated here
+        HDF5RawDriver::Defer(*fd, data, size);
+        herr_t ret = H5Dwrite_chunk(dataSet->getId(), H5P_DEFAULT, filterMask,
+                                    start, size, data);
+        auto raw = HDF5RawDriver::TakeDeferred(*fd);
+        if (ret < 0) {
+            throw H5::DataSetIException("H5Dwrite_chunk",
+                                        "direct chunk write failed");
         }
-        i = 14;
+        return raw;
+#else
+        // filters are applied by hdf5 (in the hdf5 lib mutex)
+        hsize_t dims[DATA_RANK];
+        dataSpace->getSimpleExtentDims(dims);
+        hsize_t count[DATA_RANK] = {
+            std::min((hsize_t)chunkImages, dims[0] - start[0]), dims[1],
+            dims[2]};
+        dataSpace->selectHyperslab(H5S_SELECT_SET, count, start);
+        H5::DataSpace memspace(DATA_RANK, count);
+        dataSet->write(data, dataType, memspace, *dataSpace);
+        memspace.close();
+        return HDF5RawDriver::Write{};
+#endif
     } catch (const H5::Exception &error) {
+        LOG(logERROR) << "Could not write to file in object " << index;
         error.printErrorStack();
-        throw RuntimeError(
-            "Could not write parameters (index:" + std::to_string(i) +
-            ") to file in object " + std::to_string(index));
+        throw RuntimeError("Could not write to file in object " +
+                           std::to_string(index));
     }
 }
 
@@ -409,4 +527,126 @@ void HDF5DataFile::ExtendDataset() {
     extNumImages += numImages;
 }
 
+void HDF5DataFile::StartCompressionThreads(int n) {
+    killCompressionThreads = false;
+    for (int i = 0; i != n; ++i) {
+        compressionThreads.emplace_back(&HDF5DataFile::CompressionThread,
+                                        this);
+    }
+}
+
+void HDF5DataFile::StopCompressionThreads() {
+    {
+        std::lock_guard<std::mutex> lock(compressionMutex);
+        killCompressionThreads = true;
+    }
+    chunkQueued.notify_all();
+    for (auto &it : compressionThreads) {
+        it.join();
+    }
+    compressionThreads.clear();
+}
+
+void HDF5DataFile::QueueChunkForCompression(const hsize_t *start) {
+    std::unique_lock<std::mutex> lock(compressionMutex);
+    if (!compressionError.empty()) {
+        throw RuntimeError(compressionError);
+    }
+    // at most one chunk waiting per thread
+    chunkDone.wait(lock, [this]() {
+        return compressionJobs.size() + busyCompressionThreads <
+               2 * compressionThreads.size();
+    });
+    CompressionJob job;
+    job.data = std::move(chunk);
+    std::copy(start, start + DATA_RANK, job.start);
+    compressionJobs.push_back(std::move(job));
+    if (freeChunks.empty()) {
+        chunk = std::vector<char>(chunkImages * imageBytes);
+    } else {
+        chunk = std::move(freeChunks.back());
+        freeChunks.pop_back();
+    }
+    chunkQueued.notify_one();
+}
+
+void HDF5DataFile::CompressionThread() {
+    std::vector<char> shuffled;
+    std::vector<char> compressed;
+    std::unique_lock<std::mutex> lock(compressionMutex);
+    while (true) {
+        chunkQueued.wait(lock, [this]() {
+            return killCompressionThreads || !compressionJobs.empty();
+        });
+        if (compressionJobs.empty()) {
+            return;
+        }
+        CompressionJob job = std::move(compressionJobs.front());
+        compressionJobs.pop_front();
+        ++busyCompressionThreads;
+        lock.unlock();
+
+        std::string err;
+        try {
+            CompressAndWriteChunk(job, shuffled, compressed);
+        } catch (const std::exception &e) {
+            err = e.what();
+        }
+
+        lock.lock();
+        if (!err.empty() && compressionError.empty()) {
+            compressionError = err;
+        }
+        if (job.data.size() == chunkImages * imageBytes) {
+            freeChunks.push_back(std::move(job.data));
+        }
+        --busyCompressionThreads;
+        chunkDone.notify_all();
+    }
+}
+
+void HDF5DataFile::CompressAndWriteChunk(CompressionJob &job,
+                                         std::vector<char> &shuffled,
+                                         std::vector<char> &compressed) {
+#if H5_VERSION_GE(1, 10, 3)
+    // shuffle and deflate filters, deflate is optional and skipped if it
+    // does not compress
+    const char *src = job.data.data();
+    size_t size = job.data.size();
+    uint32_t filterMask = 0;
+    if (shuffleDeflate(src, size, pixelBytes, HDF5_DEFLATE_LEVEL, shuffled,
+                       compressed)) {
+        src = compressed.data();
+        size = compressed.size();
+    } else {
+        filterMask = 1u << 1;
+        if (pixelBytes > 1) {
+            src = shuffled.data();
+        }
+    }
+
+    HDF5RawDriver::Write raw;
+    {
+        std::lock_guard<std::mutex> lock(*hdf5Lib);
+        raw = WriteRawChunk(src, size, filterMask, job.start);
+    }
+    HDF5RawDriver::Complete(raw);
+#else
+    std::lock_guard<std::mutex> lock(*hdf5Lib);
+    WriteRawChunk(job.data.data(), job.data.size(), 0, job.start);
+#endif
+}
+
+void HDF5DataFile::WaitForCompression() {
+    std::unique_lock<std::mutex> lock(compressionMutex);
+    chunkDone.wait(lock, [this]() {
+        return compressionJobs.empty() && busyCompressionThreads == 0;
+    });
+    std::string err;
+    std::swap(err, compressionError);
+    if (!err.empty()) {
+        throw RuntimeError(err);
+    }
+}
+
 } // namespace sls
@@ -3,8 +3,13 @@
 #pragma once
 
 #include "File.h"
+#include "HDF5RawDriver.h"
+#include "receiver_defs.h"
 
+#include <condition_variable>
+#include <deque>
 #include <mutex>
+#include <thread>
 
 namespace sls {
 
@@ -28,20 +33,55 @@ class HDF5DataFile : private virtual slsDetectorDefs, public File {
                                  const bool sMode, const uint16_t uPortNumber,
                                  const uint32_t mFramesPerFile,
                                  const uint64_t nImages, const uint32_t nX,
-                                 const uint32_t nY, const uint32_t dr) override;
+                                 const uint32_t nY, const uint32_t dr,
+                                 const fileCompression c,
+                                 const int nCompressionThreads) override;
 
     void WriteToFile(char *imageData, sls_receiver_header &header,
                      const int imageSize, const uint64_t currentFrameNumber,
                      const uint32_t numPacketsCaught) override;
 
   private:
+    /** assembled chunk handed to the compression threads */
+    struct CompressionJob {
+        std::vector<char> data;
+        hsize_t start[DATA_RANK];
+    };
+
     void CreateFile();
-    void Convert12to16Bit(uint16_t *dst, uint8_t *src);
-    void WriteImageDatasets(const uint64_t currentFrameNumber, char *buffer);
-    void WriteParameterDatasets(const uint64_t currentFrameNumber,
-                                sls_receiver_header rheader);
+    /** as in the dataset (12 bit expanded to 16 bit) */
+    void CopyImage(char *dst, char *buffer);
+    /** i: image in the columns, a column per parameter dataset */
+    void CopyParameters(std::vector<std::vector<char>> &columns,
+                        const uint32_t i, sls_receiver_header &rheader);
+    /** images with a direct chunk write, bypassing hyperslab selection and
+     * conversion, and parameters as one block per dataset. Written once an
+     * image of the next chunk arrives or the file is closed */
+    void WriteChunk();
+    /** image of a chunk already written (out of order), hdf5 reads, modifies
+     * and writes back its chunk */
+    void WriteLateImage(const uint64_t nDimx, char *buffer,
+                        sls_receiver_header &rheader);
+    /** needs the hdf5 lib mutex. filterMask: filters not applied to data.
+     * Returns the raw data write to complete outside of the mutex */
+    HDF5RawDriver::Write WriteRawChunk(const char *data, size_t size,
+                                       uint32_t filterMask,
+                                       const hsize_t *start);
     void ExtendDataset();
 
+    void StartCompressionThreads(int n);
+    void StopCompressionThreads();
+    /** waits for a free compression thread and swaps in a new chunk */
+    void QueueChunkForCompression(const hsize_t *start);
+    void CompressionThread();
+    /** shuffle and deflate as the hdf5 filters would, outside the hdf5 lib
+     * mutex, then a direct chunk write */
+    void CompressAndWriteChunk(CompressionJob &job,
+                               std::vector<char> &shuffled,
+                               std::vector<char> &compressed);
+    /** throws if a chunk could not be compressed or written */
+    void WaitForCompression();
+
     int index;
     std::mutex *hdf5Lib;
     H5::H5File *fd{nullptr};
@@ -64,15 +104,36 @@ class HDF5DataFile : private virtual slsDetectorDefs, public File {
     uint32_t nPixelsX{0};
     uint32_t nPixelsY{0};
     uint32_t dynamicRange{0};
+    /** size of an image in the dataset */
+    size_t imageBytes{0};
+    uint32_t chunkImages{1};
+    std::vector<char> chunk;
+    std::vector<bool> chunkFilled;
+    size_t pixelBytes{2};
+    std::vector<std::vector<char>> paraColumns;
+    std::vector<size_t> paraSizes;
+    /** in dataset, -1 if no chunk is being assembled */
+    int64_t chunkIndex{-1};
+    /** of late images */
+    std::vector<char> lateImage;
+    std::vector<std::vector<char>> lateParaColumns;
+
+    fileCompression compression{NO_COMPRESSION};
+    std::vector<std::thread> compressionThreads;
+    std::mutex compressionMutex;
+    std::condition_variable chunkQueued;
+    std::condition_variable chunkDone;
+    std::deque<CompressionJob> compressionJobs;
+    std::vector<std::vector<char>> freeChunks;
+    int busyCompressionThreads{0};
+    bool killCompressionThreads{false};
+    std::string compressionError;
 
     std::string fileNamePrefix;
     uint64_t fileIndex{0};
     bool overWriteEnable{false};
     bool silentMode{false};
     uint16_t udpPortNumber{0};
-
-    static const int EIGER_NUM_PIXELS{256 * 2 * 256};
-    static const int EIGER_16_BIT_IMAGE_SIZE{EIGER_NUM_PIXELS * 2};
 };
 
 } // namespace sls
@@ -0,0 +1,335 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "HDF5RawDriver.h"
+#include "sls/logger.h"
+#include "sls/sls_detector_exceptions.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iterator>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// layout of H5FD_class_t changed with 1.12, data files then use sec2 and
+// raw data is written in the hdf5 lib mutex
+#if !H5_VERSION_GE(1, 12, 0)
+#define SLS_HDF5_RAW_DRIVER
+#endif
+
+namespace sls {
+
+#ifdef SLS_HDF5_RAW_DRIVER
+namespace {
+
+/** pub has to be first, the hdf5 lib only knows about it */
+struct RawFile {
+    H5FD_t pub;
+    int fd;
+    haddr_t eoa;
+    haddr_t eof;
+    dev_t device;
+    ino_t inode;
+    bool defer;
+    /** the only write deferred, from the caller's buffer */
+    const void *expectedData;
+    size_t expectedSize;
+    HDF5RawDriver::Write deferred;
+};
+
+constexpr haddr_t MAX_ADDRESS = ((haddr_t)1 << (8 * sizeof(off_t) - 1)) - 1;
+
+hid_t driverId = -1;
+
+bool Overflows(haddr_t address, size_t size) {
+    return address == HADDR_UNDEF || address > MAX_ADDRESS ||
+           size > MAX_ADDRESS - address;
+}
+
+bool WriteFully(int fd, const char *data, size_t size, haddr_t address) {
+    while (size > 0) {
+        ssize_t n = pwrite(fd, data, size, (off_t)address);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += n;
+        size -= n;
+        address += n;
+    }
+    return true;
+}
+
+H5FD_t *Open(const char *name, unsigned flags, hid_t, haddr_t maxaddr) {
+    if (name == nullptr || *name == '\0' || maxaddr == 0 ||
+        maxaddr == HADDR_UNDEF || maxaddr > MAX_ADDRESS) {
+        return nullptr;
+    }
+    int oflags = (flags & H5F_ACC_RDWR) ? O_RDWR : O_RDONLY;
+    if (flags & H5F_ACC_TRUNC)
+        oflags |= O_TRUNC;
+    if (flags & H5F_ACC_CREAT)
+        oflags |= O_CREAT;
+    if (flags & H5F_ACC_EXCL)
+        oflags |= O_EXCL;
+    int fd = open(name, oflags, 0666);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat sb {};
+    if (fstat(fd, &sb) < 0) {
+        close(fd);
+        return nullptr;
+    }
+    auto file = new RawFile();
+    file->fd = fd;
+    file->eof = (haddr_t)sb.st_size;
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+    return &file->pub;
+}
+
+herr_t Close(H5FD_t *f) {
+    auto file = reinterpret_cast<RawFile *>(f);
+    int ret = close(file->fd);
+    delete file;
+    return (ret < 0) ? -1 : 0;
+}
+
+int Compare(const H5FD_t *f1, const H5FD_t *f2) {
+    auto a = reinterpret_cast<const RawFile *>(f1);
+    auto b = reinterpret_cast<const RawFile *>(f2);
+    if (a->device != b->device)
+        return (a->device < b->device) ? -1 : 1;
+    if (a->inode != b->inode)
+        return (a->inode < b->inode) ? -1 : 1;
+    return 0;
+}
+
+herr_t Query(const H5FD_t *, unsigned long *flags) {
+    if (flags) {
+        *flags = H5FD_FEAT_AGGREGATE_METADATA |
+                 H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
+                 H5FD_FEAT_AGGREGATE_SMALLDATA;
+    }
+    return 0;
+}
+
+haddr_t GetEoa(const H5FD_t *f, H5FD_mem_t) {
+    return reinterpret_cast<const RawFile *>(f)->eoa;
+}
+
+herr_t SetEoa(H5FD_t *f, H5FD_mem_t, haddr_t address) {
+    reinterpret_cast<RawFile *>(f)->eoa = address;
+    return 0;
+}
+
+haddr_t GetEof(const H5FD_t *f, H5FD_mem_t) {
+    return reinterpret_cast<const RawFile *>(f)->eof;
+}
+
+herr_t GetHandle(H5FD_t *f, hid_t, void **handle) {
+    *handle = f;
+    return 0;
+}
+
+herr_t Read(H5FD_t *f, H5FD_mem_t, hid_t, haddr_t address, size_t size,
+            void *buffer) {
+    auto file = reinterpret_cast<RawFile *>(f);
+    if (Overflows(address, size)) {
+        return -1;
+    }
+    auto dst = static_cast<char *>(buffer);
+    while (size > 0) {
+        ssize_t n = pread(file->fd, dst, size, (off_t)address);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        // past the end of file
+        if (n == 0) {
+            memset(dst, 0, size);
+            break;
+        }
+        dst += n;
+        size -= n;
+        address += n;
+    }
+    return 0;
+}
+
+herr_t Write(H5FD_t *f, H5FD_mem_t type, hid_t, haddr_t address, size_t size,
+             const void *buffer) {
+    auto file = reinterpret_cast<RawFile *>(f);
+    if (Overflows(address, size)) {
+        return -1;
+    }
+    // anything but the caller's chunk (eg. split or copied by the hdf5 lib)
+    // is written in the hdf5 lib mutex
+    if (type == H5FD_MEM_DRAW && file->defer &&
+        file->deferred.data == nullptr && buffer == file->expectedData &&
+        size == file->expectedSize) {
+        file->deferred.fd = file->fd;
+        file->deferred.address = address;
+        file->deferred.size = size;
+        file->deferred.data = buffer;
+    } else if (!WriteFully(file->fd, static_cast<const char *>(buffer), size,
+                           address)) {
+        return -1;
+    }
+    if (address + size > file->eof) {
+        file->eof = address + size;
+    }
+    return 0;
+}
+
+herr_t Truncate(H5FD_t *f, hid_t, hbool_t) {
+    auto file = reinterpret_cast<RawFile *>(f);
+    if (file->eoa != file->eof) {
+        if (ftruncate(file->fd, (off_t)file->eoa) < 0) {
+            return -1;
+        }
+        file->eof = file->eoa;
+    }
+    return 0;
+}
+
+herr_t Lock(H5FD_t *f, hbool_t rw) {
+    auto file = reinterpret_cast<RawFile *>(f);
+    int op = (rw ? LOCK_EX : LOCK_SH) | LOCK_NB;
+    if (flock(file->fd, op) < 0 && errno != ENOSYS) {
+        return -1;
+    }
+    return 0;
+}
+
+herr_t Unlock(H5FD_t *f) {
+    auto file = reinterpret_cast<RawFile *>(f);
+    if (flock(file->fd, LOCK_UN) < 0 && errno != ENOSYS) {
+        return -1;
+    }
+    return 0;
+}
+
+H5FD_class_t MakeClass() {
+    H5FD_class_t c{};
+    c.name = "sls_raw";
+    c.maxaddr = MAX_ADDRESS;
+    c.fc_degree = H5F_CLOSE_WEAK;
+    c.open = Open;
+    c.close = Close;
+    c.cmp = Compare;
+    c.query = Query;
+    c.get_eoa = GetEoa;
+    c.set_eoa = SetEoa;
+    c.get_eof = GetEof;
+    c.get_handle = GetHandle;
+    c.read = Read;
+    c.write = Write;
+    c.truncate = Truncate;
+    c.lock = Lock;
+    c.unlock = Unlock;
+    H5FD_mem_t map[] = H5FD_FLMAP_DICHOTOMY;
+    std::copy(std::begin(map), std::end(map), std::begin(c.fl_map));
+    return c;
+}
+
+const H5FD_class_t rawClass = MakeClass();
+
+/** nullptr if the file does not use the driver */
+RawFile *GetRawFile(const H5::H5File &fd) {
+    if (driverId < 0) {
+        return nullptr;
+    }
+    hid_t fapl = H5Fget_access_plist(fd.getId());
+    hid_t driver = H5Pget_driver(fapl);
+    H5Pclose(fapl);
+    void *handle = nullptr;
+    if (driver != driverId ||
+        H5Fget_vfd_handle(fd.getId(), H5P_DEFAULT, &handle) < 0) {
+        return nullptr;
+    }
+    return static_cast<RawFile *>(handle);
+}
+
+} // namespace
+#endif
+
+bool HDF5RawDriver::IsAvailable() {
+#ifdef SLS_HDF5_RAW_DRIVER
+    return true;
+#else
+    return false;
+#endif
+}
+
+void HDF5RawDriver::SetFileAccess(H5::FileAccPropList &fapl) {
+#ifndef SLS_HDF5_RAW_DRIVER
+    static bool warned = false;
+    if (!warned) {
+        warned = true;
+        LOG(logWARNING) << "hdf5 raw driver needs hdf5 < 1.12 (have "
+                        << H5_VERSION
+                        << "), raw data is written in the hdf5 lib mutex";
+    }
+#else
+    if (driverId < 0) {
+        driverId = H5FDregister(&rawClass);
+        if (driverId < 0) {
+            LOG(logWARNING) << "Could not register hdf5 raw driver, raw data "
+                               "is written in the hdf5 lib mutex";
+            return;
+        }
+    }
+    if (H5Pset_driver(fapl.getId(), driverId, nullptr) < 0) {
+        throw RuntimeError("Could not set hdf5 raw driver");
+    }
+#endif
+}
+
+void HDF5RawDriver::Defer(const H5::H5File &fd, const void *data,
+                          size_t size) {
+#ifdef SLS_HDF5_RAW_DRIVER
+    RawFile *file = GetRawFile(fd);
+    if (file != nullptr) {
+        file->defer = true;
+        file->expectedData = data;
+        file->expectedSize = size;
+        file->deferred = Write{};
+    }
+#endif
+}
+
+HDF5RawDriver::Write HDF5RawDriver::TakeDeferred(const H5::H5File &fd) {
+    Write write;
+#ifdef SLS_HDF5_RAW_DRIVER
+    RawFile *file = GetRawFile(fd);
+    if (file != nullptr) {
+        std::swap(write, file->deferred);
+        file->defer = false;
+        file->expectedData = nullptr;
+        file->expectedSize = 0;
+    }
+#endif
+    return write;
+}
+
+void HDF5RawDriver::Complete(const Write &write) {
+    if (write.size == 0) {
+        return;
+    }
+#ifdef SLS_HDF5_RAW_DRIVER
+    if (!WriteFully(write.fd, static_cast<const char *>(write.data),
+                    write.size, write.address)) {
+        throw RuntimeError(std::string("Could not write raw data to hdf5 "
+                                       "file [") +
+                           strerror(errno) + "]");
+    }
+#endif
+}
+
+} // namespace sls
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#pragma once
+/************************************************
+ * @file HDF5RawDriver.h
+ * @short posix file driver for hdf5 data files
+ * (as sec2) that can hand a raw data write of the
+ * hdf5 lib back to the caller, so that the data
+ * is written outside of the hdf5 lib mutex
+ ***********************************************/
+
+#include "H5Cpp.h"
+
+#include <cstdint>
+
+namespace sls {
+
+class HDF5RawDriver {
+  public:
+    /** raw data write recorded by the driver, not yet written */
+    struct Write {
+        int fd{-1};
+        uint64_t address{0};
+        size_t size{0};
+        const void *data{nullptr};
+    };
+
+    /** false for hdf5 >= 1.12 (its driver interface changed), SetFileAccess
+     * then keeps the default driver and raw data is written in the hdf5 lib
+     * mutex, shared by all ports */
+    static bool IsAvailable();
+    /** use the driver for files created with fapl. Needs the hdf5 lib
+     * mutex (registers the driver on first use). Warns once if the driver
+     * is not available (hdf5 >= 1.12) */
+    static void SetFileAccess(H5::FileAccPropList &fapl);
+    /** needs the hdf5 lib mutex. The next raw data write of the hdf5 lib to
+     * this file is only recorded, to be taken with TakeDeferred, if it is
+     * exactly size bytes from data. Any other write is done right away. Does
+     * nothing for files of other drivers */
+    static void Defer(const H5::H5File &fd, const void *data, size_t size);
+    /** needs the hdf5 lib mutex. Size 0 if nothing was deferred */
+    static Write TakeDeferred(const H5::H5File &fd);
+    /** without the hdf5 lib mutex, before the file is closed. Throws */
+    static void Complete(const Write &write);
+};
+
+} // namespace sls
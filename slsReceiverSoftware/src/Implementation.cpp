@@ -10,7 +10,9 @@
 #include "sls/ToString.h"
 #include "sls/ZmqSocket.h" //just for the zmq port define
 #include "sls/file_utils.h"
+#include "sls/string_utils.h"
 
+#include <algorithm>
 #include <cerrno> //eperm
 #include <chrono>
 #include <cstdlib> //system
@@ -18,6 +20,9 @@
 #include <cstring> //strcpy
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <sched.h>
+#include <sstream>
 #include <sys/stat.h> // stat
 #include <thread>
 #include <unistd.h>
@@ -26,9 +31,21 @@ namespace sls {
 
 /** cosntructor & destructor */
 
-Implementation::Implementation(const detectorType d) { setDetectorType(d); }
+Implementation::Implementation(const detectorType d) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu != CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set))
+                processCpus.push_back(cpu);
+        }
+    }
+    setDetectorType(d);
+}
 
 Implementation::~Implementation() {
+    // zmq releases fifo buffers of streamers when closing their sockets
+    dataStreamer.clear();
     delete generalData;
     generalData = nullptr;
 }
@@ -64,7 +81,79 @@ void Implementation::SetThreadPriorities() {
         it->SetThreadPriority(LISTENER_PRIORITY);
 }
 
+void Implementation::SetThreadAffinities() {
+    auto sets = GetThreadCpuSets();
+    if (tcpThreadId != 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (auto cpu : sets[0])
+            CPU_SET(cpu, &set);
+        if (sched_setaffinity(tcpThreadId, sizeof(set), &set) != 0) {
+            throw RuntimeError("Could not pin tcp thread to cpus " +
+                               ToCpuList(sets[0]));
+        }
+    }
+    for (size_t i = 0; i != listener.size(); ++i)
+        listener[i]->SetThreadAffinity(sets[1 + 3 * i]);
+    for (size_t i = 0; i != dataProcessor.size(); ++i)
+        dataProcessor[i]->SetThreadAffinity(sets[2 + 3 * i]);
+    for (size_t i = 0; i != dataStreamer.size(); ++i)
+        dataStreamer[i]->SetThreadAffinity(sets[3 + 3 * i]);
+}
+
+std::vector<std::vector<int>> Implementation::GetThreadCpuSets() const {
+    const size_t numSlots = 1 + 3 * MAX_NUMBER_OF_LISTENING_THREADS;
+    std::vector<std::vector<int>> sets(numSlots, processCpus);
+    if (threadCpus != "auto") {
+        auto args = split(threadCpus, ' ');
+        for (size_t i = 0; i != args.size() && i != numSlots; ++i) {
+            if (args[i] != "-")
+                sets[i] = ParseCpuList(args[i]);
+        }
+        return sets;
+    }
+
+    // listeners on cpus close to the network card, but away from its
+    // interrupts, the other threads on the remaining close cpus
+    auto subtract = [](const std::vector<int> &a, const std::vector<int> &b) {
+        std::vector<int> result;
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                            std::back_inserter(result));
+        return result;
+    };
+    std::vector<std::vector<int>> candidates;
+    std::vector<int> listenerCpus;
+    for (int i = 0; i != generalData->numUDPInterfaces; ++i) {
+        std::vector<int> local;
+        auto nicCpus = InterfaceNameToLocalCpus(eth[i]);
+        std::set_intersection(nicCpus.begin(), nicCpus.end(),
+                              processCpus.begin(), processCpus.end(),
+                              std::back_inserter(local));
+        if (local.empty())
+            local = processCpus;
+        auto c = subtract(local, InterfaceNameToIrqCpus(eth[i]));
+        if (c.empty())
+            c = local;
+        if (!c.empty()) {
+            sets[1 + 3 * i] = {c[i % c.size()]};
+            listenerCpus.push_back(c[i % c.size()]);
+        }
+        candidates.push_back(c);
+    }
+    std::sort(listenerCpus.begin(), listenerCpus.end());
+    for (size_t i = 0; i != candidates.size(); ++i) {
+        auto rest = subtract(candidates[i], listenerCpus);
+        if (rest.empty())
+            rest = candidates[i];
+        sets[2 + 3 * i] = rest;
+        sets[3 + 3 * i] = rest;
+    }
+    return sets;
+}
+
 void Implementation::SetupFifoStructure() {
+    for (const auto &it : dataStreamer)
+        it->WaitForImagesInZmq();
     fifo.clear();
     for (int i = 0; i < generalData->numUDPInterfaces; ++i) {
         size_t datasize = generalData->imageSize;
@@ -76,8 +165,9 @@ void Implementation::SetupFifoStructure() {
 
         // create fifo structure
         try {
-            fifo.push_back(
-                sls::make_unique<Fifo>(i, datasize, generalData->fifoDepth));
+            fifo.push_back(sls::make_unique<Fifo>(
+                i, datasize, generalData->fifoDepth,
+                (size_t)fifoHugePageSize * 1024 * 1024, GetFifoNumaNode(i)));
         } catch (const std::exception &e) {
             fifo.clear();
             generalData->fifoDepth = 0;
@@ -102,6 +192,13 @@ void Implementation::SetupFifoStructure() {
                  << " Fifo structure(s) reconstructed";
 }
 
+int Implementation::GetFifoNumaNode(int i) const {
+    if (fifoNumaNode >= 0) {
+        return fifoNumaNode;
+    }
+    return InterfaceNameToNumaNode(eth[i]);
+}
+
 /**************************************************
  *                                                 *
  *   Configuration Parameters                      *
@@ -174,6 +271,7 @@ void Implementation::setDetectorType(const detectorType d) {
     }
 
     SetThreadPriorities();
+    SetThreadAffinities();
 
     LOG(logDEBUG) << " Detector type set to " << ToString(d);
 }
@@ -187,6 +285,8 @@ void Implementation::SetupListener(int i) {
     listener[i]->SetNoRoi(portRois[i].noRoi());
     listener[i]->SetDetectorDatastream(detectorDataStream[i]);
     listener[i]->SetSilentMode(silentMode);
+    listener[i]->SetUdpBatchSize(udpBatchSize);
+    listener[i]->SetSocketBackend(udpSocketBackend);
 }
 
 void Implementation::SetupDataProcessor(int i) {
@@ -201,11 +301,17 @@ void Implementation::SetupDataProcessor(int i) {
     dataProcessor[i]->SetFramePadding(framePadding);
     dataProcessor[i]->SetCtbDbitList(ctbDbitList);
     dataProcessor[i]->SetCtbDbitOffset(ctbDbitOffset);
+    dataProcessor[i]->SetNumberOfThreads(processingThreads);
+    dataProcessor[i]->SetWriteEngine(fileWriteEngine);
+    dataProcessor[i]->SetFileCompression(fileCompressionType);
+    dataProcessor[i]->SetCompressionThreads(compressionThreads);
 }
 
 void Implementation::SetupDataStreamer(int i) {
     dataStreamer[i]->SetFifo(fifo[i].get());
     dataStreamer[i]->SetGeneralData(generalData);
+    dataStreamer[i]->SetHeaderFormat(streamingHeaderFormat);
+    dataStreamer[i]->SetPolicy(streamingPolicy);
     dataStreamer[i]->CreateZmqSockets(streamingPort, streamingSrcIP,
                                       streamingHwm);
     dataStreamer[i]->SetAdditionalJsonHeader(additionalJsonHeader);
@@ -217,6 +323,9 @@ void Implementation::SetupDataStreamer(int i) {
     dataStreamer[i]->SetNumberofTotalFrames(numberOfTotalFrames);
     dataStreamer[i]->SetReceiverROI(
         portRois[i].completeRoi() ? GetMaxROIPerPort() : portRois[i]);
+    dataStreamer[i]->SetCompressionLevel(streamingCompressionLevel);
+    dataStreamer[i]->SetCompressionThreads(compressionThreads);
+    dataStreamer[i]->SetCompression(streamingCompression);
 }
 
 slsDetectorDefs::xy Implementation::getDetectorSize() const {
@@ -324,6 +433,38 @@ void Implementation::setFifoDepth(const uint32_t i) {
     LOG(logINFO) << "Fifo Depth: " << i;
 }
 
+int Implementation::getFifoHugePageSize() const {
+    if (fifo.empty()) {
+        return fifoHugePageSize;
+    }
+    // normal pages (or fallback to them) reported as 0
+    size_t pageSize = fifo[0]->GetPageSize();
+    return pageSize < 1024 * 1024 ? 0 : pageSize / (1024 * 1024);
+}
+
+void Implementation::setFifoHugePageSize(const int i) {
+    if (fifoHugePageSize != i) {
+        fifoHugePageSize = i;
+        SetupFifoStructure();
+    }
+    LOG(logINFO) << "Fifo Huge Page Size: " << i << " MB";
+}
+
+int Implementation::getFifoNumaNode() const {
+    if (fifo.empty()) {
+        return fifoNumaNode;
+    }
+    return fifo[0]->GetNumaNode();
+}
+
+void Implementation::setFifoNumaNode(const int i) {
+    if (fifoNumaNode != i) {
+        fifoNumaNode = i;
+        SetupFifoStructure();
+    }
+    LOG(logINFO) << "Fifo Numa Node: " << i;
+}
+
 slsDetectorDefs::frameDiscardPolicy
 Implementation::getFrameDiscardPolicy() const {
     return generalData->frameDiscardMode;
@@ -344,9 +485,21 @@ void Implementation::setFramePaddingEnable(const bool i) {
     LOG(logINFO) << "Frame Padding: " << framePadding;
 }
 
+int Implementation::getProcessingThreads() const { return processingThreads; }
+
+void Implementation::setProcessingThreads(const int i) {
+    if (processingThreads != i) {
+        processingThreads = i;
+        for (const auto &it : dataProcessor)
+            it->SetNumberOfThreads(processingThreads);
+    }
+    LOG(logINFO) << "Processing Threads: " << processingThreads;
+}
+
 void Implementation::setThreadIds(const pid_t parentTid, const pid_t tcpTid) {
     parentThreadId = parentTid;
     tcpThreadId = tcpTid;
+    SetThreadAffinities();
 }
 
 std::array<pid_t, NUM_RX_THREAD_IDS> Implementation::getThreadIds() const {
@@ -374,6 +527,59 @@ std::array<pid_t, NUM_RX_THREAD_IDS> Implementation::getThreadIds() const {
     return retval;
 }
 
+std::string Implementation::getThreadCpus() {
+    std::vector<std::string> placed(1 + 3 * MAX_NUMBER_OF_LISTENING_THREADS,
+                                    "-");
+    if (tcpThreadId != 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(tcpThreadId, sizeof(set), &set) == 0) {
+            std::vector<int> cpus;
+            for (int cpu = 0; cpu != CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &set))
+                    cpus.push_back(cpu);
+            }
+            placed[0] = ToCpuList(cpus);
+        }
+    }
+    for (size_t i = 0; i != listener.size(); ++i)
+        placed[1 + 3 * i] = ToCpuList(listener[i]->GetThreadAffinity());
+    for (size_t i = 0; i != dataProcessor.size(); ++i)
+        placed[2 + 3 * i] = ToCpuList(dataProcessor[i]->GetThreadAffinity());
+    for (size_t i = 0; i != dataStreamer.size(); ++i)
+        placed[3 + 3 * i] = ToCpuList(dataStreamer[i]->GetThreadAffinity());
+    std::ostringstream oss;
+    for (size_t i = 0; i != placed.size(); ++i) {
+        oss << (i == 0 ? "" : " ") << placed[i];
+    }
+    return oss.str();
+}
+
+void Implementation::setThreadCpus(const std::string &c) {
+    // validate before touching any thread
+    if (c != "auto") {
+        auto args = split(c, ' ');
+        if (args.size() > 1 + 3 * MAX_NUMBER_OF_LISTENING_THREADS) {
+            throw RuntimeError("Too many cpu lists in " + c);
+        }
+        for (const auto &arg : args) {
+            if (arg == "-")
+                continue;
+            auto cpus = ParseCpuList(arg);
+            if (cpus.empty() ||
+                !std::includes(processCpus.begin(), processCpus.end(),
+                               cpus.begin(), cpus.end())) {
+                throw RuntimeError("Cpus " + arg +
+                                   " not available to the receiver (" +
+                                   ToCpuList(processCpus) + ")");
+            }
+        }
+    }
+    threadCpus = c;
+    SetThreadAffinities();
+    LOG(logINFO) << "Thread Cpus: " << getThreadCpus();
+}
+
 bool Implementation::getArping() const { return arping.IsRunning(); }
 
 pid_t Implementation::getArpingProcessId() const {
@@ -521,6 +727,10 @@ void Implementation::setFileFormat(const fileFormat f) {
     }
 
     LOG(logINFO) << "File Format: " << ToString(fileFormatType);
+    if (fileFormatType == HDF5 && fileWriteEngine != IO_THREAD) {
+        LOG(logWARNING) << "File Write Engine " << ToString(fileWriteEngine)
+                        << " only applies to binary files";
+    }
 }
 
 std::string Implementation::getFilePath() const { return filePath; }
@@ -590,6 +800,45 @@ void Implementation::setFramesPerFile(const uint32_t i) {
     LOG(logINFO) << "Frames per file: " << generalData->framesPerFile;
 }
 
+slsDetectorDefs::writeEngine Implementation::getWriteEngine() const {
+    return fileWriteEngine;
+}
+
+void Implementation::setWriteEngine(const writeEngine e) {
+    fileWriteEngine = e;
+    for (const auto &it : dataProcessor)
+        it->SetWriteEngine(fileWriteEngine);
+    LOG(logINFO) << "File Write Engine: " << ToString(fileWriteEngine);
+    if (fileFormatType == HDF5 && fileWriteEngine != IO_THREAD) {
+        LOG(logWARNING) << "File Write Engine " << ToString(fileWriteEngine)
+                        << " only applies to binary files";
+    }
+}
+
+slsDetectorDefs::fileCompression Implementation::getFileCompression() const {
+    return fileCompressionType;
+}
+
+void Implementation::setFileCompression(const fileCompression c) {
+    fileCompressionType = c;
+    for (const auto &it : dataProcessor)
+        it->SetFileCompression(fileCompressionType);
+    LOG(logINFO) << "File Compression: " << ToString(fileCompressionType);
+}
+
+int Implementation::getCompressionThreads() const {
+    return compressionThreads;
+}
+
+void Implementation::setCompressionThreads(const int n) {
+    compressionThreads = n;
+    for (const auto &it : dataProcessor)
+        it->SetCompressionThreads(compressionThreads);
+    for (const auto &it : dataStreamer)
+        it->SetCompressionThreads(compressionThreads);
+    LOG(logINFO) << "Compression Threads: " << compressionThreads;
+}
+
 /**************************************************
  *                                                 *
  *   Acquisition                                   *
@@ -789,6 +1038,10 @@ void Implementation::stopReceiver() {
                    << "\n\tComplete Frames\t\t: " << nf
                    << "\n\tLast Frame Caught\t: "
                    << listener[i]->GetLastFrameIndexCaught();
+                if (dataStreamEnable && i < (int)dataStreamer.size()) {
+                    os << "\n\tStreaming\t\t: "
+                       << ToString(dataStreamer[i]->GetStatistics());
+                }
                 summary = os.str();
             }
 
@@ -1097,6 +1350,7 @@ void Implementation::setNumberofUDPInterfaces(const int n) {
         }
 
         SetThreadPriorities();
+        SetThreadAffinities();
 
         // update (from 1 to 2 interface) & also for printout
         setDetectorSize(numModules);
@@ -1128,6 +1382,14 @@ void Implementation::setEthernetInterface(const std::string &c) {
     eth[0] = c;
     listener[0]->SetEthernetInterface(c);
     LOG(logINFO) << "Ethernet Interface: " << eth[0];
+    // fifo memory follows the network card
+    if (!fifo.empty() &&
+        fifo[0]->GetRequestedNumaNode() != GetFifoNumaNode(0)) {
+        SetupFifoStructure();
+    }
+    if (threadCpus == "auto") {
+        SetThreadAffinities();
+    }
 }
 
 std::string Implementation::getEthernetInterface2() const { return eth[1]; }
@@ -1138,6 +1400,13 @@ void Implementation::setEthernetInterface2(const std::string &c) {
         listener[1]->SetEthernetInterface(c);
     }
     LOG(logINFO) << "Ethernet Interface 2: " << eth[1];
+    if (fifo.size() > 1 &&
+        fifo[1]->GetRequestedNumaNode() != GetFifoNumaNode(1)) {
+        SetupFifoStructure();
+    }
+    if (threadCpus == "auto") {
+        SetThreadAffinities();
+    }
 }
 
 uint16_t Implementation::getUDPPortNumber() const { return udpPortNum[0]; }
@@ -1183,6 +1452,26 @@ int Implementation::getActualUDPSocketBufferSize() const {
     return actualUDPSocketBufferSize;
 }
 
+int Implementation::getUDPBatchSize() const { return udpBatchSize; }
+
+void Implementation::setUDPBatchSize(const int i) {
+    udpBatchSize = i;
+    for (const auto &it : listener)
+        it->SetUdpBatchSize(udpBatchSize);
+    LOG(logINFO) << "UDP Batch Size: " << udpBatchSize;
+}
+
+slsDetectorDefs::socketBackend Implementation::getSocketBackend() const {
+    return udpSocketBackend;
+}
+
+void Implementation::setSocketBackend(const socketBackend b) {
+    udpSocketBackend = b;
+    for (const auto &it : listener)
+        it->SetSocketBackend(udpSocketBackend);
+    LOG(logINFO) << "Socket Backend: " << ToString(udpSocketBackend);
+}
+
 /**************************************************
  *                                                 *
  *   ZMQ Streaming Parameters (ZMQ)                *
@@ -1211,6 +1500,7 @@ void Implementation::setDataStreamEnable(const bool enable) {
                 }
             }
             SetThreadPriorities();
+            SetThreadAffinities();
         }
         for (const auto &it : dataProcessor)
             it->SetDataStreamEnable(dataStreamEnable);
@@ -1273,6 +1563,63 @@ void Implementation::setStreamingHwm(const int i) {
                  << (i == -1 ? "Default (-1)" : std::to_string(streamingHwm));
 }
 
+slsDetectorDefs::fileCompression
+Implementation::getStreamingCompression() const {
+    return streamingCompression;
+}
+
+void Implementation::setStreamingCompression(const fileCompression c) {
+    streamingCompression = c;
+    for (const auto &it : dataStreamer)
+        it->SetCompression(streamingCompression);
+    LOG(logINFO) << "Streaming Compression: " << ToString(streamingCompression);
+}
+
+int Implementation::getStreamingCompressionLevel() const {
+    return streamingCompressionLevel;
+}
+
+void Implementation::setStreamingCompressionLevel(const int level) {
+    streamingCompressionLevel = level;
+    for (const auto &it : dataStreamer)
+        it->SetCompressionLevel(streamingCompressionLevel);
+    LOG(logINFO) << "Streaming Compression Level: "
+                 << streamingCompressionLevel;
+}
+
+slsDetectorDefs::zmqHeaderFormat
+Implementation::getStreamingHeaderFormat() const {
+    return streamingHeaderFormat;
+}
+
+void Implementation::setStreamingHeaderFormat(const zmqHeaderFormat f) {
+    streamingHeaderFormat = f;
+    for (const auto &it : dataStreamer)
+        it->SetHeaderFormat(streamingHeaderFormat);
+    LOG(logINFO) << "Streaming Header Format: "
+                 << ToString(streamingHeaderFormat);
+}
+
+slsDetectorDefs::zmqStreamingPolicy
+Implementation::getStreamingPolicy() const {
+    return streamingPolicy;
+}
+
+void Implementation::setStreamingPolicy(const zmqStreamingPolicy p) {
+    streamingPolicy = p;
+    for (const auto &it : dataStreamer)
+        it->SetPolicy(streamingPolicy);
+    LOG(logINFO) << "Streaming Policy: " << ToString(streamingPolicy);
+}
+
+std::vector<slsDetectorDefs::streamingStatistics>
+Implementation::getStreamingStatistics() const {
+    std::vector<streamingStatistics> retval;
+    for (const auto &it : dataStreamer)
+        retval.push_back(it->GetStatistics());
+    return retval;
+}
+
 std::map<std::string, std::string>
 Implementation::getAdditionalJsonHeader() const {
     return additionalJsonHeader;
@@ -49,12 +49,30 @@ class Implementation : private virtual slsDetectorDefs {
     void setSilentMode(const bool i);
     uint32_t getFifoDepth() const;
     void setFifoDepth(const uint32_t i);
+    /** huge page size in MB the fifo memory actually got, 0 for normal
+     * pages */
+    int getFifoHugePageSize() const;
+    /** in MB, 0 for normal pages */
+    void setFifoHugePageSize(const int i);
+    /** numa node the fifo memory is actually bound to, -1 if not bound */
+    int getFifoNumaNode() const;
+    /** -1 for numa node of udp interface */
+    void setFifoNumaNode(const int i);
     frameDiscardPolicy getFrameDiscardPolicy() const;
     void setFrameDiscardPolicy(const frameDiscardPolicy i);
     bool getFramePaddingEnable() const;
     void setFramePaddingEnable(const bool i);
+    int getProcessingThreads() const;
+    /** per udp interface, images still written and streamed in order */
+    void setProcessingThreads(const int i);
     void setThreadIds(const pid_t parentTid, const pid_t tcpTid);
     std::array<pid_t, NUM_RX_THREAD_IDS> getThreadIds() const;
+    /** cpu lists of tcp, listener 0, processor 0, streamer 0, listener 1,
+     * processor 1 and streamer 1 as placed, '-' for no thread */
+    std::string getThreadCpus();
+    /** space separated cpu lists in the order above, '-' or missing for all
+     * cpus of the process, or "auto" to derive from the udp interfaces */
+    void setThreadCpus(const std::string &c);
     bool getArping() const;
     pid_t getArpingProcessId() const;
     void setArping(const bool i, const std::vector<std::string> ips);
@@ -85,6 +103,15 @@ class Implementation : private virtual slsDetectorDefs {
     uint32_t getFramesPerFile() const;
     /* 0 means infinite */
     void setFramesPerFile(const uint32_t i);
+    writeEngine getWriteEngine() const;
+    /* binary files only */
+    void setWriteEngine(const writeEngine e);
+    fileCompression getFileCompression() const;
+    /* hdf5 files only */
+    void setFileCompression(const fileCompression c);
+    int getCompressionThreads() const;
+    /* per port */
+    void setCompressionThreads(const int n);
 
     /**************************************************
      *                                                 *
@@ -125,6 +152,11 @@ class Implementation : private virtual slsDetectorDefs {
     int getUDPSocketBufferSize() const;
     void setUDPSocketBufferSize(const int s);
     int getActualUDPSocketBufferSize() const;
+    int getUDPBatchSize() const;
+    /* number of packets received per system call */
+    void setUDPBatchSize(const int i);
+    socketBackend getSocketBackend() const;
+    void setSocketBackend(const socketBackend b);
 
     /**************************************************
      *                                                 *
@@ -146,6 +178,17 @@ class Implementation : private virtual slsDetectorDefs {
     void setStreamingSourceIP(const IpAddr ip);
     int getStreamingHwm() const;
     void setStreamingHwm(const int i);
+    fileCompression getStreamingCompression() const;
+    void setStreamingCompression(const fileCompression c);
+    int getStreamingCompressionLevel() const;
+    /* 1-9 */
+    void setStreamingCompressionLevel(const int level);
+    zmqHeaderFormat getStreamingHeaderFormat() const;
+    void setStreamingHeaderFormat(const zmqHeaderFormat f);
+    zmqStreamingPolicy getStreamingPolicy() const;
+    void setStreamingPolicy(const zmqStreamingPolicy p);
+    /** one per streamer, empty if not streaming */
+    std::vector<streamingStatistics> getStreamingStatistics() const;
     std::map<std::string, std::string> getAdditionalJsonHeader() const;
     void setAdditionalJsonHeader(const std::map<std::string, std::string> &c);
     std::string getAdditionalJsonParameter(const std::string &key) const;
@@ -287,7 +330,12 @@ class Implementation : private virtual slsDetectorDefs {
   private:
     void SetLocalNetworkParameters();
     void SetThreadPriorities();
+    void SetThreadAffinities();
+    /** cpu set of every thread slot in the order of getThreadCpus */
+    std::vector<std::vector<int>> GetThreadCpuSets() const;
     void SetupFifoStructure();
+    /** numa node to bind fifo i to, -1 for none */
+    int GetFifoNumaNode(int i) const;
 
     const xy GetPortGeometry() const;
     const ROI GetMaxROIPerPort() const;
@@ -313,8 +361,13 @@ class Implementation : private virtual slsDetectorDefs {
     std::string detHostname;
     bool silentMode{false};
     bool framePadding{true};
-    pid_t parentThreadId;
-    pid_t tcpThreadId;
+    int processingThreads{1};
+    int fifoHugePageSize{0};
+    int fifoNumaNode{-1};
+    pid_t parentThreadId{0};
+    pid_t tcpThreadId{0};
+    std::string threadCpus;
+    std::vector<int> processCpus;
     ROI receiverRoi{};
     std::array<ROI, 2> portRois{};
     // receiver roi for complete detector for metadata
@@ -328,6 +381,9 @@ class Implementation : private virtual slsDetectorDefs {
     bool fileWriteEnable{false};
     bool masterFileWriteEnable{true};
     bool overwriteEnable{true};
+    writeEngine fileWriteEngine{IO_THREAD};
+    fileCompression fileCompressionType{NO_COMPRESSION};
+    int compressionThreads{4};
 
     // acquisition
     std::atomic<runStatus> status{IDLE};
@@ -339,6 +395,8 @@ class Implementation : private virtual slsDetectorDefs {
     std::array<uint16_t, MAX_NUMBER_OF_LISTENING_THREADS> udpPortNum{
         {DEFAULT_UDP_DST_PORTNO, DEFAULT_UDP_DST_PORTNO + 1}};
     int actualUDPSocketBufferSize{0};
+    int udpBatchSize{1};
+    socketBackend udpSocketBackend{UDP_SOCKET};
 
     // zmq parameters
     bool dataStreamEnable{false};
@@ -348,6 +406,10 @@ class Implementation : private virtual slsDetectorDefs {
     uint16_t streamingPort{0};
     IpAddr streamingSrcIP = IpAddr{};
     int streamingHwm{-1};
+    fileCompression streamingCompression{NO_COMPRESSION};
+    int streamingCompressionLevel{1};
+    zmqHeaderFormat streamingHeaderFormat{JSON_HEADER};
+    zmqStreamingPolicy streamingPolicy{BLOCK_ON_FULL};
     std::map<std::string, std::string> additionalJsonHeader;
 
     // detector parameters
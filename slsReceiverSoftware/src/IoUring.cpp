@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "IoUring.h"
+#include "sls/sls_detector_exceptions.h"
+
+#ifdef IO_URINGC
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace sls {
+
+#ifdef IO_URINGC
+
+IoUring::IoUring(unsigned entries) {
+    io_uring_params p{};
+    ringfd = syscall(__NR_io_uring_setup, entries, &p);
+    if (ringfd < 0) {
+        throw RuntimeError(std::string("Could not set up io_uring [") +
+                           strerror(errno) + "]");
+    }
+    numEntries = p.sq_entries;
+    sqRingSize = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    cqRingSize = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+    bool singleMmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMmap) {
+        sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+    }
+    sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, ringfd, IORING_OFF_SQ_RING);
+    if (sqRing == MAP_FAILED) {
+        sqRing = nullptr;
+    } else if (singleMmap) {
+        cqRing = sqRing;
+    } else {
+        cqRing = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ringfd, IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED)
+            cqRing = nullptr;
+    }
+    sqesSize = p.sq_entries * sizeof(io_uring_sqe);
+    void *s = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ringfd, IORING_OFF_SQES);
+    sqes = (s == MAP_FAILED) ? nullptr : static_cast<io_uring_sqe *>(s);
+    if (sqRing == nullptr || cqRing == nullptr || sqes == nullptr) {
+        int err = errno;
+        Release();
+        throw RuntimeError(std::string("Could not map io_uring [") +
+                           strerror(err) + "]");
+    }
+
+    auto sq = static_cast<char *>(sqRing);
+    sqHead = reinterpret_cast<unsigned *>(sq + p.sq_off.head);
+    sqTail = reinterpret_cast<unsigned *>(sq + p.sq_off.tail);
+    sqMask = *reinterpret_cast<unsigned *>(sq + p.sq_off.ring_mask);
+    sqArray = reinterpret_cast<unsigned *>(sq + p.sq_off.array);
+    auto cq = static_cast<char *>(cqRing);
+    cqHead = reinterpret_cast<unsigned *>(cq + p.cq_off.head);
+    cqTail = reinterpret_cast<unsigned *>(cq + p.cq_off.tail);
+    cqMask = *reinterpret_cast<unsigned *>(cq + p.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe *>(cq + p.cq_off.cqes);
+
+    // kernels 5.1 - 5.5 set up rings, but fail IORING_OP_WRITE at completion
+    if (!SupportsWrites()) {
+        Release();
+        throw RuntimeError("io_uring does not support write operations "
+                           "(kernel >= 5.6 needed)");
+    }
+
+    eventfd = ::eventfd(0, EFD_CLOEXEC);
+    if (eventfd < 0 || syscall(__NR_io_uring_register, ringfd,
+                               IORING_REGISTER_EVENTFD, &eventfd, 1) < 0) {
+        int err = errno;
+        Release();
+        throw RuntimeError(std::string("Could not register io_uring eventfd [") +
+                           strerror(err) + "]");
+    }
+}
+
+bool IoUring::SupportsWrites() const {
+    // probe itself only from 5.6
+    constexpr unsigned numOps = 256;
+    std::vector<char> buffer(sizeof(io_uring_probe) +
+                             numOps * sizeof(io_uring_probe_op));
+    auto probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+    if (syscall(__NR_io_uring_register, ringfd, IORING_REGISTER_PROBE, probe,
+                numOps) < 0) {
+        return false;
+    }
+    for (unsigned op : {IORING_OP_WRITE, IORING_OP_WRITE_FIXED}) {
+        if (op > probe->last_op || op >= probe->ops_len ||
+            (probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+IoUring::~IoUring() { Release(); }
+
+void IoUring::Release() {
+    if (sqes != nullptr)
+        munmap(sqes, sqesSize);
+    if (cqRing != nullptr && cqRing != sqRing)
+        munmap(cqRing, cqRingSize);
+    if (sqRing != nullptr)
+        munmap(sqRing, sqRingSize);
+    if (ringfd >= 0)
+        close(ringfd);
+    if (eventfd >= 0)
+        close(eventfd);
+    sqes = nullptr;
+    cqRing = sqRing = nullptr;
+    ringfd = -1;
+    eventfd = -1;
+}
+
+void IoUring::RegisterBuffers(const std::vector<iovec> &iovecs) {
+    if (syscall(__NR_io_uring_register, ringfd, IORING_REGISTER_BUFFERS,
+                iovecs.data(), iovecs.size()) < 0) {
+        throw RuntimeError(std::string("Could not register io_uring "
+                                       "buffers [") +
+                           strerror(errno) + "]");
+    }
+}
+
+void IoUring::UnregisterBuffers() {
+    syscall(__NR_io_uring_register, ringfd, IORING_UNREGISTER_BUFFERS,
+            nullptr, 0);
+}
+
+bool IoUring::PrepareWrite(int fd, const void *buf, unsigned len,
+                           uint64_t offset, int bufIndex, uint64_t userData) {
+    unsigned tail = *sqTail;
+    if (tail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) == numEntries) {
+        return false;
+    }
+    unsigned index = tail & sqMask;
+    io_uring_sqe *sqe = &sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = (bufIndex < 0) ? IORING_OP_WRITE : IORING_OP_WRITE_FIXED;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(buf);
+    sqe->len = len;
+    sqe->off = offset;
+    sqe->buf_index = (bufIndex < 0) ? 0 : bufIndex;
+    sqe->user_data = userData;
+    sqArray[index] = index;
+    __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+    ++toSubmit;
+    return true;
+}
+
+void IoUring::Submit() {
+    while (toSubmit != 0) {
+        int ret =
+            syscall(__NR_io_uring_enter, ringfd, toSubmit, 0, 0, nullptr, 0);
+        if (ret >= 0) {
+            toSubmit -= ret;
+        } else if (errno != EINTR) {
+            throw RuntimeError(std::string("Could not submit to io_uring [") +
+                               strerror(errno) + "]");
+        }
+    }
+}
+
+int IoUring::GetCompletionFd() const { return eventfd; }
+
+bool IoUring::PeekCompletion(uint64_t &userData, int &result) {
+    unsigned head = *cqHead;
+    if (head == __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    const io_uring_cqe &cqe = cqes[head & cqMask];
+    userData = cqe.user_data;
+    result = cqe.res;
+    __atomic_store_n(cqHead, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+#else
+// built without the io_uring kernel headers, never set up
+
+IoUring::IoUring(unsigned) {
+    throw RuntimeError("io_uring not available (built without the kernel "
+                       "headers of >= 5.6)");
+}
+
+IoUring::~IoUring() {}
+
+void IoUring::RegisterBuffers(const std::vector<iovec> &) {
+    throw RuntimeError("io_uring not available");
+}
+
+void IoUring::UnregisterBuffers() {}
+
+bool IoUring::PrepareWrite(int, const void *, unsigned, uint64_t, int,
+                           uint64_t) {
+    return false;
+}
+
+void IoUring::Submit() {}
+
+int IoUring::GetCompletionFd() const { return -1; }
+
+bool IoUring::PeekCompletion(uint64_t &, int &) { return false; }
+
+#endif
+
+} // namespace sls
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#pragma once
+/************************************************
+ * @file IoUring.h
+ * @short minimal io_uring (kernel >= 5.6) for
+ * file writes, without liburing
+ ***********************************************/
+
+#include <cstdint>
+#include <sys/uio.h> //iovec
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace sls {
+
+class IoUring {
+  public:
+    /** throws if io_uring or its write operations are not available */
+    explicit IoUring(unsigned entries);
+    ~IoUring();
+    IoUring(const IoUring &) = delete;
+    IoUring &operator=(const IoUring &) = delete;
+
+    /** pins memory for IORING_OP_WRITE_FIXED, throws if not possible (eg.
+     * RLIMIT_MEMLOCK) */
+    void RegisterBuffers(const std::vector<iovec> &iovecs);
+    void UnregisterBuffers();
+
+    /** queues a write, bufIndex of registered buffer or -1. Returns false if
+     * the submission queue is full */
+    bool PrepareWrite(int fd, const void *buf, unsigned len, uint64_t offset,
+                      int bufIndex, uint64_t userData);
+    /** submits queued writes */
+    void Submit();
+    /** returns false if there is no completion. Only one thread may reap */
+    bool PeekCompletion(uint64_t &userData, int &result);
+    /** eventfd readable once there are completions (read it to reset before
+     * peeking), to wait for them together with other fds */
+    int GetCompletionFd() const;
+
+  private:
+    void Release();
+    /** IORING_OP_WRITE and IORING_OP_WRITE_FIXED supported by the kernel */
+    bool SupportsWrites() const;
+
+    int ringfd{-1};
+    int eventfd{-1};
+    unsigned numEntries{0};
+    void *sqRing{nullptr};
+    size_t sqRingSize{0};
+    void *cqRing{nullptr};
+    size_t cqRingSize{0};
+    io_uring_sqe *sqes{nullptr};
+    size_t sqesSize{0};
+
+    unsigned *sqHead{nullptr};
+    unsigned *sqTail{nullptr};
+    unsigned sqMask{0};
+    unsigned *sqArray{nullptr};
+    unsigned *cqHead{nullptr};
+    unsigned *cqTail{nullptr};
+    unsigned cqMask{0};
+    io_uring_cqe *cqes{nullptr};
+    /** prepared, but not yet submitted */
+    unsigned toSubmit{0};
+};
+
+} // namespace sls
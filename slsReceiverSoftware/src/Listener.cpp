@@ -15,6 +15,7 @@
 #include "sls/network_utils.h"
 #include "sls/sls_detector_exceptions.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <iostream>
@@ -104,6 +105,12 @@ void Listener::SetNoRoi(bool enable) {
 
 void Listener::SetSilentMode(bool enable) { silentMode = enable; }
 
+void Listener::SetUdpBatchSize(const int n) { udpBatchSize = n; }
+
+void Listener::SetSocketBackend(const socketBackend b) {
+    udpSocketBackend = b;
+}
+
 void Listener::ResetParametersforNewAcquisition() {
     StopRunning();
     startedFlag = false;
@@ -114,13 +121,25 @@ void Listener::ResetParametersforNewAcquisition() {
     lastCaughtFrameIndex = 0;
     carryOverFlag = false;
     uint32_t packetSize = generalData->packetSize;
+    packetHeaderSize = generalData->headerSizeinPacket;
+    packetDataSize = generalData->dataSize;
+    imageDataSize = generalData->imageSize;
     if (generalData->detType == GOTTHARD2 && index != 0) {
         packetSize = generalData->vetoPacketSize;
+        packetHeaderSize = generalData->vetoHsize;
+        packetDataSize = generalData->vetoDataSize;
+        imageDataSize = generalData->vetoImageSize;
     }
-    carryOverPacket = make_unique<char[]>(packetSize);
-    memset(carryOverPacket.get(), 0, packetSize);
-    listeningPacket = make_unique<char[]>(packetSize);
-    memset(carryOverPacket.get(), 0, packetSize);
+    scatterPackets = (generalData->detType != GOTTHARD &&
+                      packetSize == packetHeaderSize + packetDataSize);
+    size_t listeningSize = (scatterPackets ? packetHeaderSize : packetSize);
+    listeningPacket = make_unique<char[]>(listeningSize * udpBatchSize);
+    memset(listeningPacket.get(), 0, listeningSize * udpBatchSize);
+    parkedPayload = make_unique<char[]>((size_t)packetDataSize * udpBatchSize);
+    memset(parkedPayload.get(), 0, (size_t)packetDataSize * udpBatchSize);
+    batchPayload.assign(udpBatchSize, nullptr);
+    numPacketsInBatch = 0;
+    batchIndex = 0;
 
     numPacketsStatistic = 0;
     numFramesStatistic = 0;
@@ -158,7 +177,20 @@ void Listener::CreateUDPSocket(int &actualSize) {
             udpPortNumber, packetSize,
             (eth.length() ? InterfaceNameToIp(eth).str().c_str() : nullptr),
             generalData->udpSocketBufferSize);
+        udpSocket->setBatchSize(udpBatchSize);
         LOG(logINFO) << index << ": UDP port opened at port " << udpPortNumber;
+        if (udpSocketBackend == PACKET_MMAP) {
+            try {
+                udpSocket->UsePacketRing(eth,
+                                         generalData->udpSocketBufferSize);
+                LOG(logINFO) << index << ": Packet ring set up for port "
+                             << udpPortNumber;
+            } catch (const RuntimeError &e) {
+                LOG(logWARNING) << index << ": Falling back to udp socket "
+                                << "for port " << udpPortNumber << " ["
+                                << e.what() << ']';
+            }
+        }
 
         udpSocketAlive = true;
 
@@ -258,8 +290,9 @@ void Listener::ThreadExecution() {
                    << (void *)(buffer) << std::dec << ":" << buffer;
     auto *memImage = reinterpret_cast<image_structure *>(buffer);
 
-    // udpsocket doesnt exist
-    if ((*status == TRANSMITTING || !udpSocketAlive) && !carryOverFlag) {
+    // udpsocket doesnt exist (and nothing left from last batch)
+    if ((*status == TRANSMITTING || !udpSocketAlive) && !carryOverFlag &&
+        batchIndex == numPacketsInBatch) {
         StopListening(buffer, memImage->size);
         return;
     }
@@ -267,6 +300,8 @@ void Listener::ThreadExecution() {
     // reset header and size and get data
     memset(memImage, 0, IMAGE_STRUCTURE_HEADER_SIZE);
     int rc = ListenToAnImage(memImage->header, memImage->data);
+    // image is handed over, keep what is left of the batch (incl carry over)
+    ParkPayloads(carryOverFlag ? batchIndex - 1 : batchIndex);
 
     // end of acquisition or discarding image
     if (rc <= 0) {
@@ -306,28 +341,31 @@ uint32_t Listener::ListenToAnImage(sls_receiver_header &dstHeader,
     uint64_t bnum = 0;
     uint32_t numpackets = 0;
 
-    uint32_t dsize = generalData->dataSize;
-    uint32_t imageSize = generalData->imageSize;
-    uint32_t packetSize = generalData->packetSize;
-    uint32_t hsize = generalData->headerSizeinPacket;
+    uint32_t dsize = packetDataSize;
+    uint32_t imageSize = imageDataSize;
     bool standardHeader = generalData->standardheader;
     if (generalData->detType == GOTTHARD2 && index != 0) {
-        dsize = generalData->vetoDataSize;
-        imageSize = generalData->vetoImageSize;
-        packetSize = generalData->vetoPacketSize;
-        hsize = generalData->vetoHsize;
         standardHeader = false;
     }
     uint32_t pperFrame = generalData->packetsPerFrame;
     bool isHeaderEmpty = true;
     uint32_t corrected_dsize = dsize - ((pperFrame * dsize) - imageSize);
     sls_detector_header *srcDetHeader = nullptr;
+    char *header = nullptr;
+    char *payload = nullptr;
 
     // carry over packet
     if (carryOverFlag) {
         LOG(logDEBUG3) << index << "carry flag";
-        GetPacketIndices(fnum, pnum, bnum, standardHeader,
-                         carryOverPacket.get(), srcDetHeader);
+        // carry over is the last consumed packet of the batch
+        int carryOverIndex = batchIndex - 1;
+        header = scatterPackets
+                     ? &listeningPacket[carryOverIndex * packetHeaderSize]
+                     : &listeningPacket[carryOverIndex *
+                                        udpSocket->getPacketSize()];
+        payload = batchPayload[carryOverIndex];
+        GetPacketIndices(fnum, pnum, bnum, standardHeader, header,
+                         srcDetHeader);
 
         // future packet
         if (fnum != currentFrameIndex) {
@@ -342,17 +380,18 @@ uint32_t Listener::ListenToAnImage(sls_receiver_header &dstHeader,
                                       imageSize, dstHeader);
         }
 
-        CopyPacket(dstData, carryOverPacket.get(), dsize, hsize,
-                   corrected_dsize, numpackets, isHeaderEmpty, standardHeader,
-                   dstHeader, srcDetHeader, pnum, bnum);
+        CopyPacket(dstData, payload, dsize, corrected_dsize, numpackets,
+                   isHeaderEmpty, standardHeader, dstHeader, srcDetHeader,
+                   pnum, bnum);
         carryOverFlag = false;
     }
 
     // until last packet isHeaderEmpty to account for gotthard short frame, else
     // never entering this loop)
     while (numpackets < pperFrame) {
-        // listen to new packet
-        if (!udpSocketAlive || !udpSocket->ReceivePacket(&listeningPacket[0])) {
+        // listen to new packet (expected after the last one)
+        uint32_t nextPnum = (numpackets == 0 ? 0 : pnum + 1);
+        if (!GetNextPacket(dstData, dstHeader, nextPnum, header, payload)) {
             // end of acquisition
             if (numpackets == 0)
                 return 0;
@@ -361,8 +400,8 @@ uint32_t Listener::ListenToAnImage(sls_receiver_header &dstHeader,
         }
         numPacketsCaught++;
         numPacketsStatistic++;
-        GetPacketIndices(fnum, pnum, bnum, standardHeader,
-                         listeningPacket.get(), srcDetHeader);
+        GetPacketIndices(fnum, pnum, bnum, standardHeader, header,
+                         srcDetHeader);
 
         // Eiger Firmware in a weird state
         if (generalData->detType == EIGER && fnum == 0) {
@@ -393,13 +432,17 @@ uint32_t Listener::ListenToAnImage(sls_receiver_header &dstHeader,
         // future packet
         if (fnum != currentFrameIndex) {
             carryOverFlag = true;
-            memcpy(carryOverPacket.get(), &listeningPacket[0], packetSize);
             return HandleFuturePacket(false, numpackets, fnum, isHeaderEmpty,
                                       imageSize, dstHeader);
         }
-        CopyPacket(dstData, listeningPacket.get(), dsize, hsize,
-                   corrected_dsize, numpackets, isHeaderEmpty, standardHeader,
-                   dstHeader, srcDetHeader, pnum, bnum);
+        // not the expected packet, moving it could overwrite the scattered
+        // payloads still to be consumed
+        if (payload != dstData + pnum * dsize) {
+            ParkPayloads(batchIndex);
+        }
+        CopyPacket(dstData, payload, dsize, corrected_dsize, numpackets,
+                   isHeaderEmpty, standardHeader, dstHeader, srcDetHeader,
+                   pnum, bnum);
     }
 
     // complete image
@@ -453,9 +496,9 @@ size_t Listener::HandleFuturePacket(bool EOA, uint32_t numpackets,
 }
 
 void Listener::CopyPacket(char *dst, char *src, uint32_t dataSize,
-                          uint32_t detHeaderSize, uint32_t correctedDataSize,
-                          uint32_t &numpackets, bool &isHeaderEmpty,
-                          bool standardHeader, sls_receiver_header &dstHeader,
+                          uint32_t correctedDataSize, uint32_t &numpackets,
+                          bool &isHeaderEmpty, bool standardHeader,
+                          sls_receiver_header &dstHeader,
                           sls_detector_header *srcDetHeader, uint32_t pnum,
                           uint64_t bnum) {
 
@@ -466,19 +509,22 @@ void Listener::CopyPacket(char *dst, char *src, uint32_t dataSize,
     // 2nd packet: 4 bytes fnum, previous 1*2 bytes data  + 640*2 bytes data
     case GOTTHARD:
         if (!pnum)
-            memcpy(dst, &src[detHeaderSize + 4], dataSize - 2);
+            memcpy(dst, &src[4], dataSize - 2);
         else
-            memcpy(dst + dataSize - 2, &src[detHeaderSize], dataSize + 2);
+            memcpy(dst + dataSize - 2, src, dataSize + 2);
         break;
     case CHIPTESTBOARD:
-        if (pnum == (generalData->packetsPerFrame - 1))
-            memcpy(dst + (pnum * dataSize), &src[detHeaderSize],
-                   correctedDataSize);
-        else
-            memcpy(dst + (pnum * dataSize), &src[detHeaderSize], dataSize);
+        // already in place if scattered to the expected packet number
+        if (dst + (pnum * dataSize) != src) {
+            memcpy(dst + (pnum * dataSize), src,
+                   (pnum == (generalData->packetsPerFrame - 1))
+                       ? correctedDataSize
+                       : dataSize);
+        }
         break;
     default:
-        memcpy(dst + (pnum * dataSize), &src[detHeaderSize], dataSize);
+        if (dst + (pnum * dataSize) != src)
+            memcpy(dst + (pnum * dataSize), src, dataSize);
         break;
     }
 
@@ -506,6 +552,80 @@ void Listener::CopyPacket(char *dst, char *src, uint32_t dataSize,
     }
 }
 
+bool Listener::GetNextPacket(char *dstData,
+                             const sls_receiver_header &dstHeader,
+                             uint32_t pnum, char *&header, char *&payload) {
+    // batch consumed, receive the next one
+    if (batchIndex == numPacketsInBatch) {
+        batchIndex = 0;
+        numPacketsInBatch = 0;
+        if (!udpSocketAlive) {
+            return false;
+        }
+        if (scatterPackets) {
+            // not beyond this image, so that batches follow the frames
+            int n = udpBatchSize;
+            if (pnum < generalData->packetsPerFrame) {
+                n = std::min(n, static_cast<int>(
+                                    generalData->packetsPerFrame - pnum));
+            }
+            for (int i = 0; i != n; ++i) {
+                batchPayload[i] =
+                    GetPayloadDestination(dstData, dstHeader, pnum + i, i);
+            }
+            numPacketsInBatch = udpSocket->ReceivePackets(
+                listeningPacket.get(), packetHeaderSize, batchPayload.data(),
+                n);
+        } else {
+            numPacketsInBatch =
+                udpSocket->ReceivePackets(listeningPacket.get());
+            for (int i = 0; i != numPacketsInBatch; ++i) {
+                batchPayload[i] =
+                    &listeningPacket[i * udpSocket->getPacketSize() +
+                                     packetHeaderSize];
+            }
+        }
+        if (numPacketsInBatch == 0) {
+            return false;
+        }
+    }
+    int i = batchIndex++;
+    if (!udpSocket->IsValidPacket(i)) {
+        return false;
+    }
+    header = scatterPackets
+                 ? &listeningPacket[i * packetHeaderSize]
+                 : &listeningPacket[i * udpSocket->getPacketSize()];
+    payload = batchPayload[i];
+    return true;
+}
+
+char *Listener::GetPayloadDestination(char *dstData,
+                                      const sls_receiver_header &dstHeader,
+                                      uint32_t pnum, int i) {
+    // only into free slots that fit into the image (packet mask is shared
+    // for the last slot)
+    if (pnum < generalData->packetsPerFrame && pnum < MAX_NUM_PACKETS - 1 &&
+        !dstHeader.packetsMask[pnum] &&
+        (pnum + 1) * packetDataSize <= imageDataSize) {
+        return dstData + pnum * packetDataSize;
+    }
+    return &parkedPayload[i * packetDataSize];
+}
+
+void Listener::ParkPayloads(int first) {
+    if (!scatterPackets) {
+        return;
+    }
+    for (int i = first; i < numPacketsInBatch; ++i) {
+        char *parked = &parkedPayload[i * packetDataSize];
+        if (batchPayload[i] != parked) {
+            memcpy(parked, batchPayload[i], packetDataSize);
+            batchPayload[i] = parked;
+        }
+    }
+}
+
 void Listener::GetPacketIndices(uint64_t &fnum, uint32_t &pnum, uint64_t &bnum,
                                 bool standardHeader, char *packet,
                                 sls_detector_header *&header) {
@@ -545,6 +665,18 @@ void Listener::PrintFifoStatistics() {
                << "  Used_Fifo_Max_Level:" << fifo->GetMaxLevelForFifoBound()
                << " \tFree_Slots_Min_Level:" << fifo->GetMinLevelForFifoFree()
                << " \tCurrent_Frame#:" << currentFrameIndex;
+
+    if (udpSocket && udpSocket->IsPacketRing()) {
+        auto ring = udpSocket->getRingStatistics();
+        const auto ringColor = ring.drops ? logINFORED : logINFOGREEN;
+        LOG(ringColor) << "[" << udpPortNumber
+                       << "]:  "
+                          "Ring_Packets:"
+                       << ring.packets << "  Ring_Drops:" << ring.drops
+                       << "  Ring_Rate:"
+                       << (ring.seconds > 0 ? ring.packets / ring.seconds : 0)
+                       << " packets/s";
+    }
 }
 
 } // namespace sls
@@ -15,6 +15,7 @@
 #include "sls/UdpRxSocket.h"
 #include <atomic>
 #include <memory>
+#include <vector>
 
 namespace sls {
 
@@ -45,6 +46,8 @@ class Listener : private virtual slsDetectorDefs, public ThreadObject {
     void SetDetectorDatastream(bool enable);
     void SetNoRoi(bool enable);
     void SetSilentMode(bool enable);
+    void SetUdpBatchSize(const int n);
+    void SetSocketBackend(const socketBackend b);
 
     void ResetParametersforNewAcquisition();
     void CreateUDPSocket(int &actualSize);
@@ -91,13 +94,34 @@ class Listener : private virtual slsDetectorDefs, public ThreadObject {
                               bool isHeaderEmpty, size_t imageSize,
                               sls_receiver_header &rxHeader);
 
+    /** src is the packet payload, nothing to copy if it was already
+     * scattered to its place in dst */
     void CopyPacket(char *dst, char *src, uint32_t dataSize,
-                    uint32_t detHeaderSize, uint32_t correctedDataSize,
-                    uint32_t &numpackets, bool &isHeaderEmpty,
-                    bool standardHeader, sls_receiver_header &rxHeader,
+                    uint32_t correctedDataSize, uint32_t &numpackets,
+                    bool &isHeaderEmpty, bool standardHeader,
+                    sls_receiver_header &rxHeader,
                     sls_detector_header *detHeader, uint32_t pnum,
                     uint64_t bnum);
 
+    /**
+     * Next packet of the current batch, receiving a new batch from the udp
+     * socket once it is consumed. When scattering, payloads are received
+     * directly into dstData, expecting packet numbers from pnum onwards
+     * @returns false at end of acquisition or for an invalid packet
+     */
+    bool GetNextPacket(char *dstData, const sls_receiver_header &dstHeader,
+                       uint32_t pnum, char *&header, char *&payload);
+
+    /** where to scatter the payload of packet pnum, expected as the ith
+     * packet of the batch */
+    char *GetPayloadDestination(char *dstData,
+                                const sls_receiver_header &dstHeader,
+                                uint32_t pnum, int i);
+
+    /** move payloads of the batch from packet first onwards out of the image
+     * they were scattered into */
+    void ParkPayloads(int first);
+
     void GetPacketIndices(uint64_t &fnum, uint32_t &pnum, uint64_t &bnum,
                           bool standardHeader, char *packet,
                           sls_detector_header *&header);
@@ -118,6 +142,8 @@ class Listener : private virtual slsDetectorDefs, public ThreadObject {
     bool detectorDataStream{true};
     bool noRoi{false};
     bool silentMode;
+    int udpBatchSize{1};
+    socketBackend udpSocketBackend{UDP_SOCKET};
     bool disabledPort{false};
 
     /** row hardcoded as 1D or 2d,
@@ -145,12 +171,28 @@ class Listener : private virtual slsDetectorDefs, public ThreadObject {
      * ( always check startedFlag for validity first)
      */
     uint64_t currentFrameIndex{0};
-    /** True if there is a packet carry over from previous Image */
+    /** True if there is a packet carry over from previous Image (last
+     * consumed packet of the batch) */
     bool carryOverFlag{false};
-    std::unique_ptr<char[]> carryOverPacket;
-    /** Listening buffer for one packet - might be removed when we can peek and
-     * eiger fnum is in header */
+    /** Receive packet payloads directly into the fifo image (not for
+     * gotthard, which splits the payload differently) */
+    bool scatterPackets{false};
+    uint32_t packetHeaderSize{0};
+    uint32_t packetDataSize{0};
+    uint32_t imageDataSize{0};
+    /** Listening buffer for one batch of packets (only headers if
+     * scattering) - might be removed when we can peek and eiger fnum is in
+     * header */
     std::unique_ptr<char[]> listeningPacket;
+    /** payload of each packet in the batch */
+    std::vector<char *> batchPayload;
+    /** payloads that could not be scattered into the image or are parked
+     * for the next image */
+    std::unique_ptr<char[]> parkedPayload;
+    /** packets received in listeningPacket by last batch */
+    int numPacketsInBatch{0};
+    /** next packet to consume from listeningPacket */
+    int batchIndex{0};
     std::atomic<bool> udpSocketAlive{false};
 
     // for print progress during acquisition*/
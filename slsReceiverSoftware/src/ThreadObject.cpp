@@ -7,6 +7,8 @@
 
 #include "ThreadObject.h"
 #include "sls/container_utils.h"
+#include "sls/sls_detector_exceptions.h"
+#include "sls/string_utils.h"
 #include <iostream>
 #include <unistd.h>
 
@@ -78,4 +80,37 @@ void ThreadObject::SetThreadPriority(int priority) {
     }
 }
 
+void ThreadObject::SetThreadAffinity(const std::vector<int> &cpus) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    if (pthread_setaffinity_np(threadObject.native_handle(), sizeof(set),
+                               &set) != 0) {
+        throw RuntimeError("Could not pin " + type + " thread " +
+                           std::to_string(index) + " to cpus " +
+                           ToCpuList(cpus));
+    }
+    LOG(logDEBUG) << "Affinity set - " << type << " " << index << ": "
+                  << ToCpuList(cpus);
+}
+
+std::vector<int> ThreadObject::GetThreadAffinity() {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    std::vector<int> cpus;
+    if (pthread_getaffinity_np(threadObject.native_handle(), sizeof(set),
+                               &set) == 0) {
+        for (int cpu = 0; cpu != CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
 } // namespace sls
@@ -16,6 +16,7 @@
 #include <semaphore.h>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace sls {
 
@@ -32,6 +33,9 @@ class ThreadObject : private virtual slsDetectorDefs {
     void StopRunning();
     void Continue();
     void SetThreadPriority(int priority);
+    /** throws if none of the cpus can be used */
+    virtual void SetThreadAffinity(const std::vector<int> &cpus);
+    std::vector<int> GetThreadAffinity();
 
   private:
     virtual void ThreadExecution() = 0;
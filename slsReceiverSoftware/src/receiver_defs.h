@@ -35,6 +35,12 @@ namespace sls {
 
 // binary
 #define FILE_BUFFER_SIZE (16 * 1024 * 1024) // 16mb
+// buffers in flight per file writer (double buffering)
+#define FILE_NUM_BUFFERS (2)
+// O_DIRECT alignment of buffer address, size and file offset
+#define FILE_BUFFER_ALIGNMENT (4096)
+// frames in flight per file writer with io_uring
+#define FILE_URING_QUEUE_DEPTH (128)
 
 // fifo
 struct image_structure {
@@ -48,11 +54,30 @@ struct image_structure {
      sizeof(slsDetectorDefs::sls_receiver_header))
 
 // hdf5
-#define MAX_CHUNKED_IMAGES (1)
+// image datasets are chunked to about this size, written chunk by chunk
+// (also the images per chunk of the parameter datasets)
+#define HDF5_IMAGE_CHUNK_SIZE (4 * 1024 * 1024) // 4mb
+#define HDF5_DEFLATE_LEVEL       (1)
 #define DATA_RANK          (3)
 #define PARA_RANK          (1)
 #define VDS_PARA_RANK      (2)
 
+// zmq
+// images in zmq per port at most (fifo depth / divisor), so that a slow
+// client cannot take all fifo buffers
+#define ZMQ_SEND_QUEUE_FIFO_DIVISOR (4)
+// fifo buffers held by zmq per port at most (fifo depth / divisor), further
+// images are copied, as a publisher keeps them for each slow subscriber
+#define ZMQ_ZERO_COPY_FIFO_DIVISOR (8)
+// time for zmq to release the images before the fifo is rebuilt, then the
+// images still held are dropped
+#define ZMQ_RELEASE_TIMEOUT_MS (1000)
+
+// frame synchronizer: frames waiting for ports, max wait and poll interval
+#define SYNC_DEFAULT_WINDOW     (16)
+#define SYNC_DEFAULT_TIMEOUT_MS (1000)
+#define SYNC_POLL_MS            (100)
+
 // parameters to calculate fifo depth
 #define SAMPLE_TIME_IN_NS (100000000) // 100ms
 
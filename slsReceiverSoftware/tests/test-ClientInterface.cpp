@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "ClientInterface.h"
+#include "catch.hpp"
+#include "sls/ClientSocket.h"
+#include "sls/sls_detector_defs.h"
+#include "sls/sls_detector_funcs.h"
+#include "sls/versionAPI.h"
+
+#include <string>
+#include <vector>
+
+namespace sls {
+
+using defs = slsDetectorDefs;
+
+constexpr uint16_t batchTestPort = 1958;
+
+void addBatchCommand(std::vector<char> &request, int fnum,
+                     const std::vector<char> &args, int retvalSize) {
+    int header[]{fnum, static_cast<int>(args.size()), retvalSize};
+    auto begin = reinterpret_cast<const char *>(header);
+    request.insert(request.end(), begin, begin + sizeof(header));
+    request.insert(request.end(), args.begin(), args.end());
+}
+
+template <typename T> std::vector<char> batchArgs(T value) {
+    auto begin = reinterpret_cast<const char *>(&value);
+    return std::vector<char>(begin, begin + sizeof(value));
+}
+
+TEST_CASE("Receiver executes a command batch up to the first failure") {
+    ClientInterface receiver(batchTestPort);
+    auto client = ReceiverSocket("localhost", batchTestPort);
+
+    int ncommands = 4;
+    std::vector<char> request(sizeof(ncommands));
+    memcpy(request.data(), &ncommands, sizeof(ncommands));
+    addBatchCommand(request, F_LOCK_RECEIVER, batchArgs<int>(0), sizeof(int));
+    addBatchCommand(request, F_GET_RECEIVER_VERSION, {}, MAX_STR_LENGTH);
+    // fails, receiver not set up yet
+    addBatchCommand(request, F_RECEIVER_SET_NUM_FRAMES,
+                    batchArgs<int64_t>(5), 0);
+    addBatchCommand(request, F_LOCK_RECEIVER, batchArgs<int>(1), sizeof(int));
+
+    client.Send(F_RECEIVER_EXEC_COMMAND_BATCH);
+    client.Send(request);
+    REQUIRE(client.Receive<int>() == defs::OK);
+    REQUIRE(client.Receive<int>() == defs::OK);
+    CHECK(client.Receive<int>() == 0);
+    REQUIRE(client.Receive<int>() == defs::OK);
+    CHECK(client.Receive(MAX_STR_LENGTH) == APIRECEIVER);
+    REQUIRE(client.Receive<int>() == defs::FAIL);
+    CHECK(client.readErrorMessage().find("not set up") != std::string::npos);
+
+    // last command not executed and the connection still in sync
+    client.Send(F_LOCK_RECEIVER);
+    client.Send(-1);
+    REQUIRE(client.Receive<int>() == defs::OK);
+    CHECK(client.Receive<int>() == 0);
+}
+
+TEST_CASE("Receiver rejects invalid command batches") {
+    ClientInterface receiver(batchTestPort);
+    {
+        auto client = ReceiverSocket("localhost", batchTestPort);
+        client.Send(F_RECEIVER_EXEC_COMMAND_BATCH);
+        client.Send(MAX_BATCH_COMMANDS + 1);
+        REQUIRE(client.Receive<int>() == defs::FAIL);
+        CHECK(client.readErrorMessage().find("Invalid number of commands") !=
+              std::string::npos);
+    }
+    {
+        // batch within a batch
+        auto client = ReceiverSocket("localhost", batchTestPort);
+        int ncommands = 1;
+        std::vector<char> request(sizeof(ncommands));
+        memcpy(request.data(), &ncommands, sizeof(ncommands));
+        addBatchCommand(request, F_RECEIVER_EXEC_COMMAND_BATCH,
+                        batchArgs<int>(1), 0);
+        client.Send(F_RECEIVER_EXEC_COMMAND_BATCH);
+        client.Send(request);
+        REQUIRE(client.Receive<int>() == defs::OK);
+        REQUIRE(client.Receive<int>() == defs::FAIL);
+        CHECK(client.readErrorMessage().find("within a batch") !=
+              std::string::npos);
+    }
+}
+
+} // namespace sls
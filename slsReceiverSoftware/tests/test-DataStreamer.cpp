@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "DataStreamer.h"
+#include "Fifo.h"
+#include "GeneralData.h"
+#include "catch.hpp"
+#include "receiver_defs.h"
+#include "sls/ZmqSocket.h"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace sls {
+
+using defs = slsDetectorDefs;
+
+void pushImages(Fifo &fifo, const GeneralData &generalData, uint64_t nImages) {
+    for (uint64_t i = 0; i != nImages; ++i) {
+        char *buffer = nullptr;
+        fifo.GetNewAddress(buffer);
+        auto *memImage = reinterpret_cast<image_structure *>(buffer);
+        memImage->size = generalData.imageSize;
+        memImage->firstIndex = 1;
+        memImage->header = defs::sls_receiver_header{};
+        memImage->header.detHeader.frameNumber = i + 1;
+        auto pixels = reinterpret_cast<uint16_t *>(memImage->data);
+        for (size_t j = 0; j != generalData.imageSize / 2; ++j) {
+            pixels[j] = static_cast<uint16_t>((i + j) % 200);
+        }
+        fifo.PushAddressToStream(buffer);
+    }
+    char *buffer = nullptr;
+    fifo.GetNewAddress(buffer);
+    reinterpret_cast<image_structure *>(buffer)->size = DUMMY_PACKET_VALUE;
+    fifo.PushAddressToStream(buffer);
+}
+
+void streamImages(defs::fileCompression compression,
+                  defs::zmqHeaderFormat headerFormat) {
+    constexpr uint16_t port = 50101;
+    constexpr uint64_t nImages = 50;
+    JungfrauData generalData;
+    Fifo fifo(0, generalData.imageSize + IMAGE_STRUCTURE_HEADER_SIZE, 20);
+    DataStreamer streamer(0);
+    streamer.SetFifo(&fifo);
+    streamer.SetGeneralData(&generalData);
+    streamer.CreateZmqSockets(port, IpAddr("127.0.0.1"), -1);
+    streamer.SetNumberofTotalFrames(nImages);
+    streamer.SetCompression(compression);
+    streamer.SetHeaderFormat(headerFormat);
+    streamer.ResetParametersforNewAcquisition("run");
+
+    ZmqSocket sub("localhost", port);
+    sub.Connect();
+    // subscription has to reach the publisher
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    streamer.StartRunning();
+    streamer.Continue();
+    std::thread producer(pushImages, std::ref(fifo), std::cref(generalData),
+                         nImages);
+
+    std::vector<uint16_t> image(generalData.imageSize / 2);
+    uint64_t nReceived = 0;
+    bool ok = true;
+    zmqHeader header;
+    while (sub.ReceiveHeader(0, header, SLS_DETECTOR_JSON_HEADER_VERSION)) {
+        ok &= (header.frameNumber == nReceived + 1);
+        ok &= (header.compression == (compression == defs::NO_COMPRESSION
+                                          ? ""
+                                          : ZMQ_CODEC_SHUFFLE_DEFLATE));
+        int length =
+            sub.ReceiveData(0, (char *)image.data(), generalData.imageSize);
+        ok &= (length == (int)generalData.imageSize);
+        for (size_t j = 0; j != image.size(); ++j) {
+            ok &= (image[j] == static_cast<uint16_t>((nReceived + j) % 200));
+        }
+        ++nReceived;
+    }
+    producer.join();
+    // images sent without copy are back in the fifo
+    streamer.WaitForImagesInZmq();
+    CHECK(ok);
+    CHECK(nReceived == nImages);
+}
+
+TEST_CASE("Streamer sends images in order for compression and header "
+          "formats") {
+    for (auto compression : {defs::NO_COMPRESSION, defs::SHUFFLE_DEFLATE}) {
+        for (auto headerFormat : {defs::JSON_HEADER, defs::BINARY_HEADER}) {
+            streamImages(compression, headerFormat);
+        }
+    }
+}
+
+TEST_CASE("Streamer drops images for a slow client without blocking the "
+          "fifo") {
+    constexpr uint16_t port = 50101;
+    constexpr uint64_t nImages = 50;
+    for (auto policy : {defs::DROP_NEWEST, defs::DROP_OLDEST,
+                        defs::KEEP_LATEST}) {
+        JungfrauData generalData;
+        Fifo fifo(0, generalData.imageSize + IMAGE_STRUCTURE_HEADER_SIZE, 20);
+        DataStreamer streamer(0);
+        streamer.SetFifo(&fifo);
+        streamer.SetGeneralData(&generalData);
+        streamer.CreateZmqSockets(port, IpAddr("127.0.0.1"), -1);
+        streamer.SetNumberofTotalFrames(nImages);
+        streamer.SetPolicy(policy);
+        streamer.ResetParametersforNewAcquisition("run");
+
+        ZmqSocket sub("localhost", port);
+        sub.SetReceiveHighWaterMark(1);
+        sub.Connect();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        streamer.StartRunning();
+        streamer.Continue();
+        // client does not read, more images than the fifo holds
+        pushImages(fifo, generalData, nImages);
+
+        std::vector<uint16_t> image(generalData.imageSize / 2);
+        uint64_t nReceived = 0;
+        uint64_t lastFrameNumber = 0;
+        bool ok = true;
+        zmqHeader header;
+        while (sub.ReceiveHeader(0, header, SLS_DETECTOR_JSON_HEADER_VERSION)) {
+            ok &= (header.frameNumber > lastFrameNumber);
+            lastFrameNumber = header.frameNumber;
+            sub.ReceiveData(0, (char *)image.data(), generalData.imageSize);
+            ++nReceived;
+        }
+        streamer.WaitForImagesInZmq();
+        auto stats = streamer.GetStatistics();
+        CHECK(ok);
+        CHECK(stats.dropped > 0);
+        CHECK(stats.streamed == nReceived);
+        CHECK(stats.streamed + stats.dropped == nImages);
+        CHECK(stats.maxLatency_ns >= stats.averageLatency_ns);
+        if (policy != defs::DROP_NEWEST) {
+            CHECK(lastFrameNumber == nImages);
+        }
+    }
+}
+
+} // namespace sls
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "FileWriter.h"
+#include "catch.hpp"
+#include "receiver_defs.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+namespace sls {
+
+std::vector<char> readFile(const std::string &fname) {
+    std::ifstream file(fname, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file),
+                             std::istreambuf_iterator<char>());
+}
+
+TEST_CASE("Write more than the buffers with an unaligned tail") {
+    const std::string fname = "/tmp/sls_test_filewriter.raw";
+    std::vector<char> data(FILE_BUFFER_SIZE * 2 + 12345);
+    for (size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<char>(i * 7);
+    }
+    FileWriter writer(0);
+    writer.Open(fname, true);
+    REQUIRE(writer.IsOpen());
+    // odd pieces as frames would be
+    size_t n = 0;
+    for (size_t size = 1; n != data.size(); size = size * 3 + 1) {
+        size = std::min(size, data.size() - n);
+        writer.Write(&data[n], size);
+        n += size;
+    }
+    writer.Close();
+    REQUIRE_FALSE(writer.IsOpen());
+    auto stats = writer.GetStatistics();
+    CHECK(stats.bytes == data.size());
+    CHECK(stats.writes == 3);
+    CHECK(stats.maxQueueDepth >= 1);
+    CHECK(readFile(fname) == data);
+
+    // not overwriting an existing file
+    REQUIRE_THROWS(writer.Open(fname, false));
+    std::remove(fname.c_str());
+}
+
+TEST_CASE("Empty file") {
+    const std::string fname = "/tmp/sls_test_filewriter_empty.raw";
+    FileWriter writer(0);
+    writer.Open(fname, true);
+    writer.Close();
+    CHECK(readFile(fname).empty());
+    CHECK(writer.GetStatistics().writes == 0);
+    std::remove(fname.c_str());
+}
+
+TEST_CASE("Prepared file is preallocated and truncated on close") {
+    const std::string fname = "/tmp/sls_test_filewriter_prepared.raw";
+    const std::string unused = "/tmp/sls_test_filewriter_unused.raw";
+    // from a previous run, not touched by preparing over it
+    std::vector<char> previous(100, 'b');
+    std::ofstream(unused).write(previous.data(), previous.size());
+    FileWriter writer(0);
+    writer.Prepare(fname, 10 * FILE_BUFFER_SIZE);
+    writer.Open(fname, true);
+    std::vector<char> data(FILE_BUFFER_SIZE + 100, 'a');
+    writer.Write(data.data(), data.size());
+    writer.Prepare(unused, FILE_BUFFER_SIZE);
+    writer.Close();
+    // fallocate is not supported by all file systems
+    if (writer.GetStatistics().preallocated) {
+        CHECK(readFile(fname).size() == data.size());
+    }
+    CHECK(readFile(fname) == data);
+
+    writer.DiscardPrepared();
+    CHECK(readFile(unused) == previous);
+    CHECK_FALSE(std::ifstream(unused + ".prepared").good());
+    std::remove(fname.c_str());
+    std::remove(unused.c_str());
+}
+
+TEST_CASE("Prepared file does not replace an existing file without overwrite") {
+    const std::string fname = "/tmp/sls_test_filewriter_existing.raw";
+    std::vector<char> previous(100, 'b');
+    std::ofstream(fname).write(previous.data(), previous.size());
+    FileWriter writer(0);
+    writer.Prepare(fname, FILE_BUFFER_SIZE);
+    REQUIRE_THROWS(writer.Open(fname, false));
+    CHECK(readFile(fname) == previous);
+    CHECK_FALSE(std::ifstream(fname + ".prepared").good());
+    std::remove(fname.c_str());
+}
+
+TEST_CASE("Write from memory with io_uring") {
+    const std::string fname = "/tmp/sls_test_filewriter_uring.raw";
+    FileWriter writer(0);
+    if (!writer.UseIoUring(true)) {
+        WARN("io_uring not available");
+        return;
+    }
+    std::vector<char> data(1024 * 1024);
+    for (size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<char>(i * 13);
+    }
+    writer.RegisterMemory(data.data(), data.size());
+    // released from the reap thread
+    std::mutex mutex;
+    std::vector<char *> released;
+    writer.SetReleaseCallBack([&](char *p) {
+        std::lock_guard<std::mutex> lock(mutex);
+        released.push_back(p);
+    });
+    writer.Open(fname, true);
+    // unregistered memory, waits for the write
+    char first[] = "header";
+    writer.Write(first, sizeof(first));
+    const size_t size = 4096 + 17;
+    size_t n = 0;
+    for (; n + size <= data.size(); n += size) {
+        writer.WriteFrom(&data[n], size, &data[n]);
+    }
+    writer.Close();
+    REQUIRE(released.size() == n / size);
+    auto stats = writer.GetStatistics();
+    CHECK(stats.writes == released.size() + 1);
+    CHECK(stats.bytes == n + sizeof(first));
+    CHECK_FALSE(stats.direct);
+
+    std::vector<char> expected(sizeof(first) + n);
+    std::copy(first, first + sizeof(first), expected.begin());
+    std::copy(data.data(), data.data() + n, expected.begin() + sizeof(first));
+    CHECK(readFile(fname) == expected);
+    std::remove(fname.c_str());
+}
+
+TEST_CASE("Writes in flight with io_uring stay below the fifo depth") {
+    const std::string fname = "/tmp/sls_test_filewriter_uring_limit.raw";
+    FileWriter writer(0);
+    if (!writer.UseIoUring(true)) {
+        WARN("io_uring not available");
+        return;
+    }
+    // like a fifo of depth 8: only free addresses can be written again
+    const int depth = 8;
+    const size_t size = 4096;
+    std::vector<char> data(depth * size, 'a');
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<char *> freeAddresses;
+    for (int i = 0; i != depth; ++i) {
+        freeAddresses.push_back(&data[i * size]);
+    }
+    writer.SetMaxWritesInFlight(depth / 2);
+    writer.SetReleaseCallBack([&](char *p) {
+        std::lock_guard<std::mutex> lock(mutex);
+        freeAddresses.push_back(p);
+        cv.notify_one();
+    });
+    writer.Open(fname, true);
+    const int numWrites = 1000;
+    for (int i = 0; i != numWrites; ++i) {
+        char *p = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            REQUIRE(cv.wait_for(lock, std::chrono::seconds(10), [&]() {
+                return !freeAddresses.empty();
+            }));
+            p = freeAddresses.front();
+            freeAddresses.pop_front();
+        }
+        writer.WriteFrom(p, size, p);
+    }
+    writer.Close();
+    CHECK(freeAddresses.size() == (size_t)depth);
+    auto stats = writer.GetStatistics();
+    CHECK(stats.writes == numWrites);
+    CHECK(stats.maxQueueDepth <= depth / 2);
+    std::remove(fname.c_str());
+}
+
+} // namespace sls
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "FrameSynchronizer.h"
+#include "catch.hpp"
+#include "sls/ZmqSocket.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace sls {
+
+using defs = slsDetectorDefs;
+
+constexpr uint32_t nPixelsX = 4;
+constexpr uint32_t nPixelsY = 2;
+
+uint16_t pixelValue(uint64_t frameNumber, uint32_t row, size_t pixel) {
+    return static_cast<uint16_t>(frameNumber * 100 + row * 10 + pixel);
+}
+
+/** one port streaming as the receiver, row of a 1x2 detector */
+void streamPort(ZmqSocket &pub, uint32_t row, uint64_t nFrames,
+                uint64_t skipFrame) {
+    std::vector<uint16_t> image(nPixelsX * nPixelsY);
+    for (uint64_t fnum = 1; fnum <= nFrames; ++fnum) {
+        if (fnum == skipFrame) {
+            continue;
+        }
+        zmqHeader header;
+        header.data = true;
+        header.jsonversion = SLS_DETECTOR_JSON_HEADER_VERSION;
+        header.dynamicRange = 16;
+        header.fileIndex = 0;
+        header.ndetx = 1;
+        header.ndety = 2;
+        header.npixelsx = nPixelsX;
+        header.npixelsy = nPixelsY;
+        header.imageSize = image.size() * sizeof(uint16_t);
+        header.frameNumber = fnum;
+        header.row = row;
+        header.detType = defs::JUNGFRAU;
+        header.completeImage = true;
+        for (size_t i = 0; i != image.size(); ++i) {
+            image[i] = pixelValue(fnum, row, i);
+        }
+        pub.SendHeader(row, header);
+        pub.SendData((char *)image.data(), header.imageSize);
+    }
+    zmqHeader dummy;
+    dummy.data = false;
+    dummy.jsonversion = SLS_DETECTOR_JSON_HEADER_VERSION;
+    pub.SendHeader(row, dummy);
+}
+
+TEST_CASE("Frame synchronizer publishes the detector image of each frame") {
+    constexpr uint64_t nFrames = 10;
+    constexpr uint64_t missingFrame = 5;
+    ZmqSocket top(50201, "*");
+    ZmqSocket bottom(50202, "*");
+    FrameSynchronizer synchronizer({"localhost:50201", "localhost:50202"},
+                                   50210, 16, std::chrono::milliseconds(1000));
+    ZmqSocket sub("localhost", 50210);
+    sub.Connect();
+    // subscriptions have to reach the publishers
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    streamPort(top, 0, nFrames, 0);
+    streamPort(bottom, 1, nFrames, missingFrame);
+
+    const size_t nPixels = nPixelsX * nPixelsY;
+    std::vector<uint16_t> image(2 * nPixels);
+    uint64_t nReceived = 0;
+    bool ok = true;
+    zmqHeader header;
+    while (sub.ReceiveHeader(0, header, SLS_DETECTOR_JSON_HEADER_VERSION)) {
+        ++nReceived;
+        int length = sub.ReceiveData(0, (char *)image.data(),
+                                     image.size() * sizeof(uint16_t));
+        ok &= (length == (int)(image.size() * sizeof(uint16_t)));
+        ok &= (header.frameNumber == nReceived);
+        ok &= (header.ndetx == 1 && header.ndety == 1);
+        ok &= (header.npixelsx == nPixelsX && header.npixelsy == 2 * nPixelsY);
+        ok &= (header.completeImage == (nReceived != missingFrame));
+        for (size_t i = 0; i != nPixels; ++i) {
+            ok &= (image[i] == pixelValue(nReceived, 0, i));
+            ok &= (image[nPixels + i] == (nReceived == missingFrame
+                                              ? 0xFFFF
+                                              : pixelValue(nReceived, 1, i)));
+        }
+    }
+    CHECK(ok);
+    CHECK(nReceived == nFrames);
+    auto stats = synchronizer.GetStatistics();
+    CHECK(stats.complete == nFrames - 1);
+    CHECK(stats.incomplete == 1);
+    CHECK(stats.late == 0);
+}
+
+/** one port of an eiger in 32 bit mode, nSubFrames sub frames per frame */
+void streamSubFrames(ZmqSocket &pub, uint32_t row, uint64_t nFrames,
+                     uint32_t nSubFrames) {
+    std::vector<uint32_t> image(nPixelsX * nPixelsY);
+    for (uint64_t fnum = 1; fnum <= nFrames; ++fnum) {
+        for (uint32_t sub = 0; sub != nSubFrames; ++sub) {
+            zmqHeader header;
+            header.data = true;
+            header.jsonversion = SLS_DETECTOR_JSON_HEADER_VERSION;
+            header.dynamicRange = 32;
+            header.ndetx = 1;
+            header.ndety = 2;
+            header.npixelsx = nPixelsX;
+            header.npixelsy = nPixelsY;
+            header.imageSize = image.size() * sizeof(uint32_t);
+            header.frameNumber = fnum;
+            header.expLength = sub;
+            header.row = row;
+            header.detType = defs::EIGER;
+            header.completeImage = true;
+            for (size_t i = 0; i != image.size(); ++i) {
+                image[i] = pixelValue(fnum, row, i) + sub * 1000;
+            }
+            pub.SendHeader(row, header);
+            pub.SendData((char *)image.data(), header.imageSize);
+        }
+    }
+    zmqHeader dummy;
+    dummy.data = false;
+    dummy.jsonversion = SLS_DETECTOR_JSON_HEADER_VERSION;
+    pub.SendHeader(row, dummy);
+}
+
+TEST_CASE("Frame synchronizer publishes each sub frame of eiger 32 bit") {
+    constexpr uint64_t nFrames = 4;
+    constexpr uint32_t nSubFrames = 3;
+    ZmqSocket top(50203, "*");
+    ZmqSocket bottom(50204, "*");
+    FrameSynchronizer synchronizer({"localhost:50203", "localhost:50204"},
+                                   50211, 16, std::chrono::milliseconds(1000));
+    ZmqSocket sub("localhost", 50211);
+    sub.Connect();
+    // subscriptions have to reach the publishers
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    streamSubFrames(top, 0, nFrames, nSubFrames);
+    streamSubFrames(bottom, 1, nFrames, nSubFrames);
+
+    const size_t nPixels = nPixelsX * nPixelsY;
+    std::vector<uint32_t> image(2 * nPixels);
+    uint64_t nReceived = 0;
+    bool ok = true;
+    zmqHeader header;
+    while (sub.ReceiveHeader(0, header, SLS_DETECTOR_JSON_HEADER_VERSION)) {
+        uint64_t fnum = nReceived / nSubFrames + 1;
+        uint32_t subFrame = nReceived % nSubFrames;
+        ++nReceived;
+        sub.ReceiveData(0, (char *)image.data(),
+                        image.size() * sizeof(uint32_t));
+        ok &= (header.frameNumber == fnum && header.expLength == subFrame);
+        ok &= header.completeImage;
+        for (size_t i = 0; i != nPixels; ++i) {
+            ok &= (image[i] == pixelValue(fnum, 0, i) + subFrame * 1000u);
+            ok &= (image[nPixels + i] ==
+                   pixelValue(fnum, 1, i) + subFrame * 1000u);
+        }
+    }
+    CHECK(ok);
+    CHECK(nReceived == nFrames * nSubFrames);
+    auto stats = synchronizer.GetStatistics();
+    CHECK(stats.complete == nFrames * nSubFrames);
+    CHECK(stats.incomplete == 0);
+    CHECK(stats.late == 0);
+}
+
+TEST_CASE("Frame synchronizer throws for an invalid source") {
+    REQUIRE_THROWS(FrameSynchronizer({"localhost"}, 50210, 16,
+                                     std::chrono::milliseconds(1000)));
+}
+
+} // namespace sls
@@ -0,0 +1,461 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "HDF5DataFile.h"
+#include "HDF5RawDriver.h"
+#include "catch.hpp"
+#include "receiver_defs.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace sls {
+
+using defs = slsDetectorDefs;
+
+std::string writePort(int port, std::mutex *hdf5Lib, uint64_t nImages,
+                      uint32_t nx, uint32_t ny) {
+    const std::string prefix =
+        "/tmp/sls_test_hdf5datafile_" + std::to_string(port);
+    HDF5DataFile file(port, hdf5Lib);
+    // as DataProcessor::CreateFirstFiles
+    file.CloseFile();
+    file.CreateFirstHDF5DataFile(prefix, 0, true, true, 50001 + port, 0,
+                                 nImages, nx, ny, 16, defs::NO_COMPRESSION, 4);
+    std::vector<uint16_t> image(nx * ny);
+    defs::sls_receiver_header header{};
+    for (uint64_t i = 0; i != nImages; ++i) {
+        for (size_t j = 0; j != image.size(); ++j) {
+            image[j] = static_cast<uint16_t>(port + i * 7 + j);
+        }
+        header.detHeader.frameNumber = i + 1;
+        file.WriteToFile(reinterpret_cast<char *>(image.data()), header,
+                         image.size() * sizeof(uint16_t), i, 0);
+    }
+    file.CloseFile();
+    return prefix + "_f0_0.h5";
+}
+
+// 1 mb images, 4 per chunk
+constexpr uint32_t chunkNx = 1024, chunkNy = 512;
+
+uint16_t testPixel(uint64_t i, size_t j) {
+    return static_cast<uint16_t>(i * 7 + j);
+}
+
+defs::sls_receiver_header testHeader(uint64_t i) {
+    defs::sls_receiver_header header{};
+    header.detHeader.frameNumber = i + 1;
+    header.detHeader.expLength = static_cast<uint32_t>(i * 2);
+    header.detHeader.packetNumber = static_cast<uint32_t>(i % 128);
+    header.detHeader.timestamp = i * 1000;
+    header.detHeader.modId = 3;
+    header.detHeader.row = static_cast<uint16_t>(i % 5);
+    header.detHeader.column = 1;
+    header.detHeader.detSpec1 = i * 3 + 1;
+    header.detHeader.detSpec2 = static_cast<uint16_t>(i + 10);
+    header.detHeader.detSpec3 = static_cast<uint32_t>(i * 5);
+    header.detHeader.detSpec4 = static_cast<uint16_t>(i + 20);
+    header.detHeader.detType = static_cast<uint8_t>(defs::JUNGFRAU);
+    header.detHeader.version = static_cast<uint8_t>(i + 2);
+    header.packetsMask.set(i);
+    header.packetsMask.set(MAX_NUM_PACKETS - 1);
+    return header;
+}
+
+/** images of indices (in the acquisition), as DataProcessor */
+void writeImages(const std::string &prefix, uint32_t framesPerFile,
+                 uint64_t nImages, const std::vector<uint64_t> &indices,
+                 defs::fileCompression compression) {
+    std::mutex hdf5Lib;
+    HDF5DataFile file(0, &hdf5Lib);
+    file.CloseFile();
+    file.CreateFirstHDF5DataFile(prefix, 0, true, true, 50001, framesPerFile,
+                                 nImages, chunkNx, chunkNy, 16, compression,
+                                 2);
+    std::vector<uint16_t> image(chunkNx * chunkNy);
+    for (auto i : indices) {
+        for (size_t j = 0; j != image.size(); ++j) {
+            image[j] = testPixel(i, j);
+        }
+        auto header = testHeader(i);
+        file.WriteToFile(reinterpret_cast<char *>(image.data()), header,
+                         image.size() * sizeof(uint16_t), i,
+                         header.detHeader.packetNumber);
+    }
+    file.CloseFile();
+}
+
+template <typename T>
+std::vector<T> readDataset(H5::H5File &fd, const std::string &name,
+                           const H5::PredType &type) {
+    H5::DataSet ds = fd.openDataSet(name);
+    hsize_t dims[DATA_RANK]{};
+    int rank = ds.getSpace().getSimpleExtentDims(dims);
+    hsize_t n = 1;
+    for (int i = 0; i != rank; ++i) {
+        n *= dims[i];
+    }
+    std::vector<T> retval(n);
+    ds.read(retval.data(), type);
+    return retval;
+}
+
+/** the file has the images [first, first + n), missing ones filled with
+ * 0xFF and their frame number 0 */
+void checkImages(const std::string &fname, uint64_t first, uint64_t n,
+                 const std::vector<uint64_t> &missing = {}) {
+    H5::H5File fd(fname, H5F_ACC_RDONLY);
+    auto images = readDataset<uint16_t>(fd, DATASET_NAME,
+                                        H5::PredType::NATIVE_UINT16);
+    auto frameNumbers = readDataset<uint64_t>(fd, "frame number",
+                                              H5::PredType::NATIVE_UINT64);
+    const size_t imageSize = chunkNx * chunkNy;
+    REQUIRE(images.size() == n * imageSize);
+    REQUIRE(frameNumbers.size() == n);
+    for (uint64_t k = 0; k != n; ++k) {
+        uint64_t i = first + k;
+        bool isMissing =
+            std::find(missing.begin(), missing.end(), i) != missing.end();
+        CAPTURE(i);
+        CHECK(frameNumbers[k] == (isMissing ? 0 : i + 1));
+        bool ok = true;
+        for (size_t j = 0; j != imageSize; ++j) {
+            ok &= (images[k * imageSize + j] ==
+                   (isMissing ? 0xFFFF : testPixel(i, j)));
+        }
+        CHECK(ok);
+    }
+}
+
+std::vector<uint64_t> imageIndices(uint64_t n) {
+    std::vector<uint64_t> retval(n);
+    for (uint64_t i = 0; i != n; ++i) {
+        retval[i] = i;
+    }
+    return retval;
+}
+
+TEST_CASE("Raw driver only for hdf5 < 1.12") {
+#if H5_VERSION_GE(1, 12, 0)
+    CHECK_FALSE(HDF5RawDriver::IsAvailable());
+#else
+    CHECK(HDF5RawDriver::IsAvailable());
+#endif
+    // otherwise files keep the default driver
+    H5::FileAccPropList fapl;
+    HDF5RawDriver::SetFileAccess(fapl);
+    CHECK((fapl.getDriver() != H5FD_SEC2) == HDF5RawDriver::IsAvailable());
+}
+
+TEST_CASE("Raw data of a direct chunk write is deferred") {
+    const std::string fname = "/tmp/sls_test_hdf5rawdriver.h5";
+    std::vector<uint16_t> data(64 * 32);
+    for (size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<uint16_t>(i * 3);
+    }
+    {
+        H5::FileAccPropList fapl;
+        HDF5RawDriver::SetFileAccess(fapl);
+        H5::H5File fd(fname, H5F_ACC_TRUNC, H5::FileCreatPropList::DEFAULT,
+                      fapl);
+        hsize_t dims[2] = {64, 32};
+        H5::DataSpace space(2, dims);
+        H5::DSetCreatPropList plist;
+        plist.setChunk(2, dims);
+        H5::DataSet ds =
+            fd.createDataSet("data", H5::PredType::STD_U16LE, space, plist);
+        hsize_t start[2] = {0, 0};
+        HDF5RawDriver::Defer(fd, data.data(), data.size() * sizeof(uint16_t));
+        REQUIRE(H5Dwrite_chunk(ds.getId(), H5P_DEFAULT, 0, start,
+                               data.size() * sizeof(uint16_t),
+                               data.data()) >= 0);
+        auto raw = HDF5RawDriver::TakeDeferred(fd);
+#if !H5_VERSION_GE(1, 12, 0)
+        CHECK(raw.size == data.size() * sizeof(uint16_t));
+        CHECK(raw.data == data.data());
+#else
+        // written by hdf5 in the hdf5 lib mutex
+        CHECK(raw.size == 0);
+#endif
+        HDF5RawDriver::Complete(raw);
+    }
+    H5::H5File fd(fname, H5F_ACC_RDONLY);
+    std::vector<uint16_t> result(data.size());
+    fd.openDataSet("data").read(result.data(), H5::PredType::NATIVE_UINT16);
+    CHECK(result == data);
+    std::remove(fname.c_str());
+}
+
+TEST_CASE("Raw data other than the expected chunk is written right away") {
+    const std::string fname = "/tmp/sls_test_hdf5rawdriver_other.h5";
+    std::vector<uint16_t> data(64 * 32);
+    for (size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<uint16_t>(i * 5);
+    }
+    std::vector<uint16_t> other(data.size());
+    {
+        H5::FileAccPropList fapl;
+        HDF5RawDriver::SetFileAccess(fapl);
+        H5::H5File fd(fname, H5F_ACC_TRUNC, H5::FileCreatPropList::DEFAULT,
+                      fapl);
+        hsize_t dims[2] = {64, 32};
+        H5::DataSpace space(2, dims);
+        H5::DSetCreatPropList plist;
+        plist.setChunk(2, dims);
+        H5::DataSet ds =
+            fd.createDataSet("data", H5::PredType::STD_U16LE, space, plist);
+        hsize_t start[2] = {0, 0};
+        HDF5RawDriver::Defer(fd, other.data(),
+                             other.size() * sizeof(uint16_t));
+        REQUIRE(H5Dwrite_chunk(ds.getId(), H5P_DEFAULT, 0, start,
+                               data.size() * sizeof(uint16_t),
+                               data.data()) >= 0);
+        auto raw = HDF5RawDriver::TakeDeferred(fd);
+        CHECK(raw.size == 0);
+    }
+    H5::H5File fd(fname, H5F_ACC_RDONLY);
+    std::vector<uint16_t> result(data.size());
+    fd.openDataSet("data").read(result.data(), H5::PredType::NATIVE_UINT16);
+    CHECK(result == data);
+    std::remove(fname.c_str());
+}
+
+TEST_CASE("Ports write hdf5 files concurrently") {
+    std::mutex hdf5Lib;
+    constexpr uint64_t nImages = 100;
+    constexpr uint32_t nx = 256, ny = 64;
+    std::vector<std::string> fnames(3);
+    std::vector<std::thread> threads;
+    for (int i = 0; i != 3; ++i) {
+        threads.emplace_back([&, i]() {
+            fnames[i] = writePort(i, &hdf5Lib, nImages, nx, ny);
+        });
+    }
+    for (auto &it : threads) {
+        it.join();
+    }
+    for (int port = 0; port != 3; ++port) {
+        H5::H5File fd(fnames[port], H5F_ACC_RDONLY);
+        std::vector<uint16_t> images(nImages * nx * ny);
+        fd.openDataSet(DATASET_NAME)
+            .read(images.data(), H5::PredType::NATIVE_UINT16);
+        std::vector<uint64_t> frameNumbers(nImages);
+        fd.openDataSet("frame number")
+            .read(frameNumbers.data(), H5::PredType::NATIVE_UINT64);
+        bool ok = true;
+        for (uint64_t i = 0; i != nImages; ++i) {
+            ok &= (frameNumbers[i] == i + 1);
+            for (size_t j = 0; j != nx * ny; ++j) {
+                ok &= (images[i * nx * ny + j] ==
+                       static_cast<uint16_t>(port + i * 7 + j));
+            }
+        }
+        CHECK(ok);
+        std::remove(fnames[port].c_str());
+    }
+}
+
+TEST_CASE("Compressed chunks read back with the hdf5 filters") {
+    // 1 mb images, 4 per chunk
+    constexpr uint32_t nx = 1024, ny = 512;
+    constexpr uint64_t nImages = 8;
+    const std::string prefix = "/tmp/sls_test_hdf5datafile_compressed";
+    std::vector<uint16_t> images(nImages * nx * ny);
+    // first chunk compresses, second (noise) does not
+    uint32_t x = 12345;
+    for (size_t i = 0; i != images.size(); ++i) {
+        if (i < images.size() / 2) {
+            images[i] = static_cast<uint16_t>(i % 100);
+        } else {
+            x = x * 1664525 + 1013904223;
+            images[i] = static_cast<uint16_t>(x >> 16);
+        }
+    }
+    std::mutex hdf5Lib;
+    {
+        HDF5DataFile file(0, &hdf5Lib);
+        file.CloseFile();
+        file.CreateFirstHDF5DataFile(prefix, 0, true, true, 50001, 0, nImages,
+                                     nx, ny, 16, defs::SHUFFLE_DEFLATE, 2);
+        defs::sls_receiver_header header{};
+        for (uint64_t i = 0; i != nImages; ++i) {
+            header.detHeader.frameNumber = i + 1;
+            file.WriteToFile(reinterpret_cast<char *>(&images[i * nx * ny]),
+                             header, nx * ny * sizeof(uint16_t), i, 0);
+        }
+        file.CloseFile();
+    }
+    const std::string fname = prefix + "_f0_0.h5";
+    H5::H5File fd(fname, H5F_ACC_RDONLY);
+    H5::DataSet ds = fd.openDataSet(DATASET_NAME);
+#if H5_VERSION_GE(1, 10, 5)
+    hsize_t offset[DATA_RANK] = {0, 0, 0};
+    unsigned filterMask = 0;
+    haddr_t addr = 0;
+    hsize_t size = 0;
+    REQUIRE(H5Dget_chunk_info_by_coord(ds.getId(), offset, &filterMask, &addr,
+                                       &size) >= 0);
+    CHECK(filterMask == 0);
+    CHECK(size < 4 * nx * ny * sizeof(uint16_t));
+    offset[0] = 4;
+    REQUIRE(H5Dget_chunk_info_by_coord(ds.getId(), offset, &filterMask, &addr,
+                                       &size) >= 0);
+    // deflate skipped
+    CHECK(filterMask == (1u << 1));
+    CHECK(size == 4 * nx * ny * sizeof(uint16_t));
+#endif
+    std::vector<uint16_t> result(images.size());
+    ds.read(result.data(), H5::PredType::NATIVE_UINT16);
+    CHECK(result == images);
+    std::remove(fname.c_str());
+}
+
+TEST_CASE("Missing images are filled, their parameters 0") {
+    const std::string prefix = "/tmp/sls_test_hdf5datafile_missing";
+    for (auto compression : {defs::NO_COMPRESSION, defs::SHUFFLE_DEFLATE}) {
+        // one of each chunk, the whole last chunk
+        writeImages(prefix, 0, 12, {0, 2, 3, 4, 5, 6}, compression);
+        checkImages(prefix + "_f0_0.h5", 0, 12, {1, 7, 8, 9, 10, 11});
+    }
+    std::remove((prefix + "_f0_0.h5").c_str());
+}
+
+TEST_CASE("Partial last chunk up to the extent of the dataset") {
+    const std::string prefix = "/tmp/sls_test_hdf5datafile_partial";
+    for (auto compression : {defs::NO_COMPRESSION, defs::SHUFFLE_DEFLATE}) {
+        writeImages(prefix, 0, 6, imageIndices(6), compression);
+        checkImages(prefix + "_f0_0.h5", 0, 6);
+    }
+    std::remove((prefix + "_f0_0.h5").c_str());
+}
+
+TEST_CASE("File rollover in the middle of a chunk") {
+    const std::string prefix = "/tmp/sls_test_hdf5datafile_rollover";
+    for (auto compression : {defs::NO_COMPRESSION, defs::SHUFFLE_DEFLATE}) {
+        // 4 images per chunk, 6 per file
+        writeImages(prefix, 6, 14, imageIndices(14), compression);
+        checkImages(prefix + "_f0_0.h5", 0, 6);
+        checkImages(prefix + "_f1_0.h5", 6, 6);
+        // the last file has the extent of the others
+        checkImages(prefix + "_f2_0.h5", 12, 6, {14, 15, 16, 17});
+    }
+    for (int i = 0; i != 3; ++i) {
+        std::remove((prefix + "_f" + std::to_string(i) + "_0.h5").c_str());
+    }
+}
+
+TEST_CASE("Images out of order across a chunk boundary") {
+    const std::string prefix = "/tmp/sls_test_hdf5datafile_order";
+    for (auto compression : {defs::NO_COMPRESSION, defs::SHUFFLE_DEFLATE}) {
+        // 3 after the chunk of 4 was started, 1 after the last chunk
+        writeImages(prefix, 0, 10, {0, 2, 4, 3, 5, 6, 8, 1, 9, 7},
+                    compression);
+        checkImages(prefix + "_f0_0.h5", 0, 10);
+    }
+    std::remove((prefix + "_f0_0.h5").c_str());
+}
+
+TEST_CASE("Parameters of each image after a chunked write") {
+    const std::string prefix = "/tmp/sls_test_hdf5datafile_parameters";
+    const std::string fname = prefix + "_f0_0.h5";
+    // 2.5 chunks
+    const uint64_t n = 10;
+    for (auto compression : {defs::NO_COMPRESSION, defs::SHUFFLE_DEFLATE}) {
+        writeImages(prefix, 0, n, imageIndices(n), compression);
+        H5::H5File fd(fname, H5F_ACC_RDONLY);
+        auto frameNumber = readDataset<uint64_t>(fd, "frame number",
+                                                 H5::PredType::NATIVE_UINT64);
+        auto expLength = readDataset<uint32_t>(
+            fd, "exp length or sub exposure time",
+            H5::PredType::NATIVE_UINT32);
+        auto packets = readDataset<uint32_t>(fd, "packets caught",
+                                             H5::PredType::NATIVE_UINT32);
+        auto detSpec1 = readDataset<uint64_t>(fd, "detector specific 1",
+                                              H5::PredType::NATIVE_UINT64);
+        auto timestamp = readDataset<uint64_t>(fd, "timestamp",
+                                               H5::PredType::NATIVE_UINT64);
+        auto modId =
+            readDataset<uint16_t>(fd, "mod id", H5::PredType::NATIVE_UINT16);
+        auto row =
+            readDataset<uint16_t>(fd, "row", H5::PredType::NATIVE_UINT16);
+        auto column =
+            readDataset<uint16_t>(fd, "column", H5::PredType::NATIVE_UINT16);
+        auto detSpec2 = readDataset<uint16_t>(fd, "detector specific 2",
+                                              H5::PredType::NATIVE_UINT16);
+        auto detSpec3 = readDataset<uint32_t>(fd, "detector specific 3",
+                                              H5::PredType::NATIVE_UINT32);
+        auto detSpec4 = readDataset<uint16_t>(fd, "detector specific 4",
+                                              H5::PredType::NATIVE_UINT16);
+        auto detType = readDataset<uint8_t>(fd, "detector type",
+                                            H5::PredType::NATIVE_UINT8);
+        auto version = readDataset<uint8_t>(fd, "detector header version",
+                                            H5::PredType::NATIVE_UINT8);
+        H5::DataSet dsMask = fd.openDataSet("packets caught bit mask");
+        const size_t maskSize = sizeof(defs::bitset_storage);
+        REQUIRE(dsMask.getDataType().getSize() == maskSize);
+        std::vector<uint8_t> mask(n * maskSize);
+        dsMask.read(mask.data(), dsMask.getDataType());
+
+        REQUIRE(frameNumber.size() == n);
+        for (uint64_t i = 0; i != n; ++i) {
+            CAPTURE(i);
+            auto header = testHeader(i);
+            auto &h = header.detHeader;
+            CHECK(frameNumber[i] == h.frameNumber);
+            CHECK(expLength[i] == h.expLength);
+            CHECK(packets[i] == h.packetNumber);
+            CHECK(detSpec1[i] == h.detSpec1);
+            CHECK(timestamp[i] == h.timestamp);
+            CHECK(modId[i] == h.modId);
+            CHECK(row[i] == h.row);
+            CHECK(column[i] == h.column);
+            CHECK(detSpec2[i] == h.detSpec2);
+            CHECK(detSpec3[i] == h.detSpec3);
+            CHECK(detSpec4[i] == h.detSpec4);
+            CHECK(detType[i] == h.detType);
+            CHECK(version[i] == h.version);
+            for (int k = 0; k != MAX_NUM_PACKETS; ++k) {
+                bool bit = (mask[i * maskSize + (k >> 3)] >> (k & 7)) & 1;
+                if (bit != header.packetsMask[k]) {
+                    FAIL("bit " << k << " of the packets caught bit mask");
+                }
+            }
+        }
+    }
+    std::remove(fname.c_str());
+}
+
+TEST_CASE("Benchmark hdf5 write throughput against number of ports",
+          "[.bench]") {
+    // jungfrau module, 0.5 GB per port
+    constexpr uint32_t nx = 1024, ny = 512;
+    constexpr uint64_t nImages = 500;
+    for (int nPorts : {1, 2, 4, 8}) {
+        std::mutex hdf5Lib;
+        std::vector<std::string> fnames(nPorts);
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i != nPorts; ++i) {
+            threads.emplace_back([&, i]() {
+                fnames[i] = writePort(i, &hdf5Lib, nImages, nx, ny);
+            });
+        }
+        for (auto &it : threads) {
+            it.join();
+        }
+        std::chrono::duration<double> t =
+            std::chrono::steady_clock::now() - start;
+        double bytes = (double)nPorts * nImages * nx * ny * sizeof(uint16_t);
+        std::cout << nPorts << " ports: " << bytes / t.count() / 1e6
+                  << " MB/s\n";
+        for (const auto &it : fnames) {
+            std::remove(it.c_str());
+        }
+    }
+}
+
+} // namespace sls
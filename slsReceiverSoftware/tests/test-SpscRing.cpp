@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "catch.hpp"
+#include "sls/CircularFifo.h"
+#include "sls/SpscRing.h"
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace sls {
+
+TEST_CASE("Empty ring") {
+    SpscRing<char> fifo(0);
+
+    // Since the fifo can hold zero elements
+    // its both empty and full
+    CHECK(fifo.isEmpty() == true);
+    CHECK(fifo.isFull() == true);
+
+    // push fails
+    char *c = new char;
+    *c = 'h';
+    CHECK(fifo.push(c, true) == false);
+
+    // pop fails
+    CHECK(fifo.pop(c, true) == false);
+
+    delete c;
+}
+
+TEST_CASE("Push pop ring") {
+    // not a power of 2, capacity is still exact
+    SpscRing<int> fifo(5);
+
+    std::vector<int> vec{3, 7, 12, 3, 4};
+    int *p = &vec[0];
+
+    for (size_t i = 0; i != vec.size(); ++i) {
+        fifo.push(p);
+        ++p;
+        CHECK(fifo.getDataValue() == (int)(i + 1));
+        CHECK(fifo.getFreeValue() == (int)(4 - i));
+    }
+
+    CHECK(fifo.isEmpty() == false);
+    CHECK(fifo.isFull() == true);
+    CHECK(fifo.push(p, true) == false);
+
+    for (size_t i = 0; i != vec.size(); ++i) {
+        fifo.pop(p);
+        CHECK(*p == vec[i]);
+        CHECK(fifo.getDataValue() == (int)(4 - i));
+        CHECK(fifo.getFreeValue() == (int)(i + 1));
+    }
+
+    CHECK(fifo.isEmpty() == true);
+    CHECK(fifo.isFull() == false);
+}
+
+TEST_CASE("Batched pop from ring") {
+    SpscRing<int> fifo(4);
+    std::vector<int> vec{1, 2, 3};
+    for (auto &v : vec) {
+        int *p = &v;
+        fifo.push(p);
+    }
+    int *items[4]{};
+    CHECK(fifo.pop(items, 2) == 2);
+    CHECK(*items[0] == 1);
+    CHECK(*items[1] == 2);
+    CHECK(fifo.pop(items, 4) == 1);
+    CHECK(*items[0] == 3);
+    CHECK(fifo.pop(items, 4, true) == 0);
+}
+
+TEST_CASE("Ring between two threads wrapping around") {
+    constexpr size_t n_items = 100000;
+    SpscRing<size_t> fifo(3);
+    std::vector<size_t> values(n_items);
+    for (size_t i = 0; i != n_items; ++i) {
+        values[i] = i;
+    }
+    std::thread producer([&]() {
+        for (size_t i = 0; i != n_items; ++i) {
+            size_t *p = &values[i];
+            fifo.push(p);
+        }
+    });
+    size_t n = 0;
+    bool ordered = true;
+    size_t *items[2]{};
+    while (n != n_items) {
+        size_t r = fifo.pop(items, 2);
+        for (size_t i = 0; i != r; ++i) {
+            ordered = ordered && (*items[i] == n + i);
+        }
+        n += r;
+    }
+    producer.join();
+    CHECK(ordered);
+    CHECK(fifo.isEmpty());
+}
+
+template <typename Fifo> double passItems(size_t n_items, size_t depth) {
+    Fifo fifo(depth);
+    char c{};
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&]() {
+        for (size_t i = 0; i != n_items; ++i) {
+            char *p = &c;
+            fifo.push(p);
+        }
+    });
+    char *p = nullptr;
+    for (size_t i = 0; i != n_items; ++i) {
+        fifo.pop(p);
+    }
+    producer.join();
+    std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+    return n_items / t.count();
+}
+
+TEST_CASE("Benchmark CircularFifo against SpscRing", "[.bench]") {
+    constexpr size_t n_items = 5000000;
+    for (size_t depth : {8, 2500}) {
+        auto circular = passItems<CircularFifo<char>>(n_items, depth);
+        auto ring = passItems<SpscRing<char>>(n_items, depth);
+        std::cout << "depth " << depth << ": CircularFifo " << circular / 1e6
+                  << " M items/s, SpscRing " << ring / 1e6
+                  << " M items/s\n";
+    }
+}
+
+} // namespace sls
@@ -19,6 +19,10 @@ class ClientSocket : public DataSocket {
 
     std::string readErrorMessage();
 
+    /** false if a connection kept open between commands was closed by the
+     * server (or has unexpected data) */
+    bool isConnected() const;
+
   private:
     void readReply(int &ret, void *retval, size_t retval_size);
     struct sockaddr_in serverAddr {};
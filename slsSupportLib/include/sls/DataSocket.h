@@ -80,6 +80,9 @@ class DataSocket {
     int write(void *buffer, size_t size);
     int setTimeOut(int t_seconds);
     int setReceiveTimeout(int us);
+    /** small writes sent right away instead of waiting for the (delayed)
+     * ack of the previous one, eg. commands on a connection kept open */
+    int setNoDelay();
     void close();
     void shutDownSocket();
     void shutdown();
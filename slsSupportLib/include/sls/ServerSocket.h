@@ -7,9 +7,11 @@
 #include "sls/network_utils.h"
 #include <cstdint>
 #include <netdb.h>
+#include <memory>
 #include <string>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <vector>
 
 namespace sls {
 
@@ -17,6 +19,14 @@ class ServerSocket : public DataSocket {
   public:
     ServerSocket(int port);
     ServerInterface accept();
+    /**
+     * Waits for the next command, on a new connection or on one that a
+     * client keeps open between commands. Sets its client as this client.
+     * Connections closed by their client are closed. Throws if shut down.
+     */
+    ServerInterface &waitForCommand();
+    /** after a failed command, as its arguments might not have been read */
+    void closeConnection(const ServerInterface &socket);
     IpAddr getLastClient() const noexcept { return lastClient; }
     IpAddr getThisClient() const noexcept { return thisClient; }
     IpAddr getLockedBy() const noexcept { return lockedBy; }
@@ -26,6 +36,12 @@ class ServerSocket : public DataSocket {
     int getPort() const noexcept { return serverPort; }
 
   private:
+    struct Connection {
+        std::unique_ptr<ServerInterface> socket;
+        IpAddr client;
+    };
+    /** kept open between commands */
+    std::vector<Connection> connections;
     IpAddr thisClient;
     IpAddr lastClient;
     IpAddr lockedBy;
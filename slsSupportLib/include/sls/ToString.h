@@ -31,6 +31,11 @@ std::string ToString(const defs::detectorSettings s);
 std::string ToString(const defs::speedLevel s);
 std::string ToString(const defs::timingMode s);
 std::string ToString(const defs::frameDiscardPolicy s);
+std::string ToString(const defs::socketBackend s);
+std::string ToString(const defs::writeEngine s);
+std::string ToString(const defs::fileCompression s);
+std::string ToString(const defs::zmqHeaderFormat s);
+std::string ToString(const defs::zmqStreamingPolicy s);
 std::string ToString(const defs::fileFormat s);
 std::string ToString(const defs::externalSignalFlag s);
 std::string ToString(const defs::readoutMode s);
@@ -61,6 +66,9 @@ std::ostream &operator<<(std::ostream &os,
 std::string ToString(const slsDetectorDefs::pedestalParameters &r);
 std::ostream &operator<<(std::ostream &os,
                          const slsDetectorDefs::pedestalParameters &r);
+std::string ToString(const slsDetectorDefs::streamingStatistics &r);
+std::ostream &operator<<(std::ostream &os,
+                         const slsDetectorDefs::streamingStatistics &r);
 const std::string &ToString(const std::string &s);
 
 /** Convert std::chrono::duration with specified output unit */
@@ -306,6 +314,11 @@ template <> defs::detectorSettings StringTo(const std::string &s);
 template <> defs::speedLevel StringTo(const std::string &s);
 template <> defs::timingMode StringTo(const std::string &s);
 template <> defs::frameDiscardPolicy StringTo(const std::string &s);
+template <> defs::socketBackend StringTo(const std::string &s);
+template <> defs::writeEngine StringTo(const std::string &s);
+template <> defs::fileCompression StringTo(const std::string &s);
+template <> defs::zmqHeaderFormat StringTo(const std::string &s);
+template <> defs::zmqStreamingPolicy StringTo(const std::string &s);
 template <> defs::fileFormat StringTo(const std::string &s);
 template <> defs::externalSignalFlag StringTo(const std::string &s);
 template <> defs::readoutMode StringTo(const std::string &s);
@@ -8,22 +8,79 @@ receiver listener loop. Should be used RAII style...
 */
 
 #include <stdint.h>
-#include <sys/types.h> //ssize_t
+#include <string>
+#include <sys/socket.h> //mmsghdr
+#include <sys/types.h>  //ssize_t
+#include <sys/uio.h>    //iovec
+#include <vector>
 namespace sls {
 
 class UdpRxSocket {
     const ssize_t packet_size_;
+    const uint16_t port_;
     int sockfd_{-1};
+    std::vector<mmsghdr> msgs_;
+    std::vector<iovec> iovecs_;
+
+    // PACKET_MMAP (TPACKET_V3) ring, only if ringfd_ != -1
+    int ringfd_{-1};
+    char *ring_{nullptr};
+    size_t block_size_{0};
+    size_t num_blocks_{0};
+    size_t current_block_{0};
+    bool holding_block_{false};
+    uint32_t packets_left_{0};
+    char *next_packet_{nullptr};
+    uint64_t ring_packets_{0};
+    double ring_first_ts_{0};
+    double ring_last_ts_{0};
 
   public:
+    /** Statistics of the packet ring since the last call to
+     * getRingStatistics() */
+    struct RingStatistics {
+        /** packets in the blocks handed over by the kernel */
+        uint64_t packets{0};
+        /** packets dropped by the kernel as the ring was full */
+        uint64_t drops{0};
+        /** between the first and last packet (block timestamps) */
+        double seconds{0};
+    };
+
     UdpRxSocket(uint16_t port, ssize_t packet_size,
                 const char *hostname = nullptr, int kernel_buffer_size = 0);
     ~UdpRxSocket();
     bool ReceivePacket(char *dst) noexcept;
+    /** Receives up to getBatchSize() packets with one recvmmsg call into
+     * dst, packet i at dst + i * packet_size. Blocks until at least one packet
+     * arrives. Returns number of packets received, 0 if shut down or error */
+    int ReceivePackets(char *dst) noexcept;
+    /** As above, but for at most n_packets (<= getBatchSize()) and scatters
+     * each packet i: the first header_size bytes to header + i * header_size
+     * and the rest directly to payload[i] */
+    int ReceivePackets(char *header, size_t header_size, char *const *payload,
+                       int n_packets) noexcept;
+    /** if packet i of the last ReceivePackets call has the expected size */
+    bool IsValidPacket(int i) const noexcept;
+    int getBatchSize() const noexcept;
+    void setBatchSize(int n_packets);
     int getBufferSize() const;
     void setBufferSize(int size);
     ssize_t getPacketSize() const noexcept;
     void Shutdown();
+
+    /** Read packets from a PACKET_MMAP (TPACKET_V3) ring on interface (all
+     * if empty) instead of copying each one out of the socket. The udp
+     * socket stays bound, but drops everything. Needs CAP_NET_RAW, throws
+     * if the ring cannot be set up, leaving the socket as it was */
+    void UsePacketRing(const std::string &interface, size_t ring_size);
+    bool IsPacketRing() const noexcept;
+    RingStatistics getRingStatistics();
+
+  private:
+    /** next udp payload from the ring, waits for a block only if wait */
+    bool NextRingPacket(bool wait, char *&data, uint32_t &size) noexcept;
+    void CloseRing() noexcept;
 };
 
 } // namespace sls
@@ -15,6 +15,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <vector>
 
 // Selective suppression of  warning in gcc,
 // showed up in gcc 12 and at the moment
@@ -38,6 +39,13 @@ namespace sls {
 #define DEFAULT_LOW_ZMQ_HWM_BUFFERSIZE (1024 * 1024) // 1MB
 #define DEFAULT_ZMQ_BUFFERSIZE         (-1)          // os default
 
+// codec of compressed image data in the json header
+#define ZMQ_CODEC_SHUFFLE_DEFLATE "shuffledeflate"
+
+// binary header, "SLSB" (json headers start with '{')
+#define ZMQ_BINARY_HEADER_MAGIC   (0x42534C53)
+#define ZMQ_BINARY_HEADER_VERSION (1)
+
 /** zmq header structure */
 struct zmqHeader {
     /** true if incoming data, false if end of acquisition */
@@ -87,11 +95,59 @@ struct zmqHeader {
     std::map<std::string, std::string> addJsonHeader;
     /** (xmin, xmax, ymin, ymax) roi only in files written */
     std::array<int, 4> rx_roi{};
+    /** codec of the image data, empty if not compressed. imageSize is the
+     * size before compression */
+    std::string compression;
 };
 
+/**
+ * binary zmq header (native byte order), instead of the json header.
+ * Followed by fname, additional json header (as json object) and
+ * compression, without terminating null
+ */
+struct zmqBinaryHeader {
+    uint32_t magic{ZMQ_BINARY_HEADER_MAGIC};
+    uint16_t binaryVersion{ZMQ_BINARY_HEADER_VERSION};
+    uint8_t data{0};
+    uint8_t completeImage{0};
+    uint32_t jsonversion{0};
+    uint32_t dynamicRange{0};
+    uint64_t fileIndex{0};
+    uint32_t ndetx{0};
+    uint32_t ndety{0};
+    uint32_t npixelsx{0};
+    uint32_t npixelsy{0};
+    uint32_t imageSize{0};
+    uint64_t acqIndex{0};
+    uint64_t frameIndex{0};
+    double progress{0};
+    uint64_t frameNumber{0};
+    uint32_t expLength{0};
+    uint32_t packetNumber{0};
+    uint64_t detSpec1{0};
+    uint64_t timestamp{0};
+    uint16_t modId{0};
+    uint16_t row{0};
+    uint16_t column{0};
+    uint16_t detSpec2{0};
+    uint32_t detSpec3{0};
+    uint16_t detSpec4{0};
+    uint8_t detType{0};
+    uint8_t version{0};
+    int32_t flipRows{0};
+    uint32_t quad{0};
+    int32_t rx_roi[4]{};
+    uint16_t fnameLength{0};
+    uint16_t addJsonHeaderLength{0};
+    uint16_t compressionLength{0};
+} __attribute__((packed));
+
 class ZmqSocket {
 
   public:
+    /** releases the buffer of a message sent without copy (as zmq_free_fn) */
+    using FreeFunction = void (*)(void *data, void *hint);
+
     // Socket Options for optimization
     // ZMQ_LINGER default is already -1 means no messages discarded. use this
     // options if optimizing required ZMQ_SNDHWM default is 0 means no limit.
@@ -166,13 +222,17 @@ class ZmqSocket {
      */
     void Disconnect() { sockfd.Disconnect(); }
 
+    /** Send headers as zmqBinaryHeader instead of json. Clients detect the
+     * format of each header */
+    void SetBinaryHeader(bool enable) { binaryHeader = enable; }
+
     /**
      * Send Message Header
      * @param index self index for debugging
      * @param header zmq header (from json)
      * @returns 0 if error, else 1
      */
-    int SendHeader(int index, zmqHeader header);
+    int SendHeader(int index, const zmqHeader &header);
 
     /**
      * Send Message Body
@@ -182,6 +242,25 @@ class ZmqSocket {
      */
     int SendData(char *buf, int length);
 
+    /**
+     * Send Message Body without copying it
+     * @param buf message, owned by zmq until released with freeFunction
+     * (possibly from a zmq thread, also if sending failed)
+     * @param length length of message
+     * @param freeFunction releases buf
+     * @param hint passed to freeFunction
+     * @returns 0 if error, else 1
+     */
+    int SendData(char *buf, int length, FreeFunction freeFunction,
+                 void *hint);
+
+    /**
+     * Wait for a message to receive
+     * @param timeoutMs -1 to wait without timeout
+     * @returns false on timeout or interrupt
+     */
+    bool WaitForMessage(int timeoutMs);
+
     /**
      * Receive Header
      * @param index self index for debugging
@@ -193,11 +272,12 @@ class ZmqSocket {
     int ReceiveHeader(const int index, zmqHeader &zHeader, uint32_t version);
 
     /**
-     * Receive Data
+     * Receive Data, decompressed if the last header received announced a
+     * codec
      * @param index self index for debugging
      * @param buf buffer to copy image data to
      * @param size size of image
-     * @returns length of data received
+     * @returns length of data received (after decompression)
      */
     int ReceiveData(const int index, char *buf, const int size);
 
@@ -227,6 +307,16 @@ class ZmqSocket {
     int ParseHeader(const int index, int length, char *buff, zmqHeader &zHeader,
                     uint32_t version);
 
+    /** as ParseHeader for a zmqBinaryHeader */
+    int ParseBinaryHeader(const int index, int length, const char *buff,
+                          zmqHeader &zHeader, uint32_t version);
+
+    /** renders the fields of the header that seldom change, if they
+     * changed since the last header */
+    void UpdateHeaderTemplate(const zmqHeader &header);
+    void RenderJsonHeader(const zmqHeader &header);
+    void RenderBinaryHeader(const zmqHeader &header);
+
     /**
      * Class to close socket descriptors automatically
      * upon encountering exceptions in the ZmqSocket constructor
@@ -258,6 +348,26 @@ class ZmqSocket {
     mySocketDescriptors sockfd;
 
     std::unique_ptr<char[]> header_buffer = make_unique<char[]>(MAX_STR_LENGTH);
+
+    bool binaryHeader{false};
+    /** header sent last time the template was rendered */
+    std::unique_ptr<zmqHeader> templateHeader;
+    /** json of the fields that seldom change, without closing brace */
+    std::string jsonTemplate;
+    std::string addJsonHeaderText;
+    std::string message;
+
+    /** additional json header of the last binary header, parsed only if it
+     * changes */
+    std::string receivedAddJsonHeaderText;
+    std::map<std::string, std::string> receivedAddJsonHeader;
+
+    /** from the last header received, to decompress the data */
+    std::string receivedCompression;
+    uint32_t receivedImageSize{0};
+    size_t receivedBytesPerPixel{1};
+    std::vector<char> decompressed;
+    std::vector<char> unshuffled;
 };
 
 } // namespace sls
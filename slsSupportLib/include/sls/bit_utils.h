@@ -3,6 +3,8 @@
 #pragma once
 
 #include <bitset>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 namespace sls {
 template <typename T> std::vector<int> getSetBits(T val) {
@@ -18,4 +20,13 @@ template <typename T> std::vector<int> getSetBits(T val) {
     }
     return set_bits;
 }
+
+/** Unpacks n 12 bit pixels (2 pixels in 3 bytes, lower nibble of the middle
+ * byte belongs to the first pixel) to 16 bit. Uses avx2 or ssse3 if the cpu
+ * supports it. n has to be even */
+void unpack12To16Bit(uint16_t *dst, const uint8_t *src, size_t n);
+
+/** scalar version of unpack12To16Bit */
+void unpack12To16BitScalar(uint16_t *dst, const uint8_t *src, size_t n);
+
 } // namespace sls
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#pragma once
+
+/**
+ * Shuffle and deflate of image data, the same for the chunks of hdf5 files
+ * (written as the hdf5 shuffle and deflate filters would) and for the zmq
+ * stream, so that both stay readable with the same decoder.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sls {
+
+/** bytes shuffled as one pixel for a bit mode, 4 and 12 bit are packed */
+size_t bytesPerPixel(uint32_t dynamicRange);
+
+/** byte planes of the pixels as the hdf5 shuffle filter, a remainder of less
+ * than a pixel as is */
+void shuffleBytes(const char *src, size_t size, size_t bytesPerPixel,
+                  char *dst);
+
+/** inverse of shuffleBytes */
+void unshuffleBytes(const char *src, size_t size, size_t bytesPerPixel,
+                    char *dst);
+
+/**
+ * Shuffle (if bytesPerPixel > 1), then deflate
+ * @param buf image data
+ * @param size size of image data
+ * @param bytesPerPixel bytes shuffled as one pixel
+ * @param level deflate level (1-9)
+ * @param shuffled shuffled data if bytesPerPixel > 1, also if it returns
+ * false (as the hdf5 shuffle filter still applies)
+ * @param compressed compressed data
+ * @returns false if it does not compress, then store or send the data
+ * without deflate
+ */
+bool shuffleDeflate(const char *buf, size_t size, size_t bytesPerPixel,
+                    int level, std::vector<char> &shuffled,
+                    std::vector<char> &compressed);
+
+/**
+ * Inflate, then unshuffle (if bytesPerPixel > 1)
+ * @param buf compressed data
+ * @param length length of compressed data
+ * @param bytesPerPixel bytes shuffled as one pixel
+ * @param dst buffer for the image data
+ * @param size size of image data
+ * @param shuffled scratch buffer
+ * @returns false if corrupt or not of size
+ */
+bool inflateUnshuffle(const char *buf, size_t length, size_t bytesPerPixel,
+                      char *dst, size_t size, std::vector<char> &shuffled);
+
+} // namespace sls
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sls {
 
@@ -88,6 +89,12 @@ IpAddr HostnameToIp(const char *hostname);
 std::string IpToInterfaceName(const std::string &ip);
 MacAddr InterfaceNameToMac(const std::string &inf);
 IpAddr InterfaceNameToIp(const std::string &ifn);
+/** numa node of the network card, -1 if unknown (or virtual interface) */
+int InterfaceNameToNumaNode(const std::string &ifn);
+/** cpus local to the network card, empty if unknown */
+std::vector<int> InterfaceNameToLocalCpus(const std::string &ifn);
+/** cpus handling the interrupts of the network card, empty if unknown */
+std::vector<int> InterfaceNameToIrqCpus(const std::string &ifn);
 void validatePortNumber(uint16_t port);
 void validatePortRange(uint16_t startPort, int numPorts);
 } // namespace sls
@@ -46,6 +46,13 @@
 
 #define MAX_UDP_DESTINATION 32
 
+/** max packets per recvmmsg call in receiver (kernel UIO_MAXIOV) */
+#define MAX_RX_UDP_BATCH_SIZE 1024
+
+/** max threads processing the images of one udp port in receiver */
+#define MAX_RX_PROCESSING_THREADS 64
+#define MAX_RX_COMPRESSION_THREADS 64
+
 #define SLS_DETECTOR_HEADER_VERSION      0x2
 #define SLS_DETECTOR_JSON_HEADER_VERSION 0x5
 
@@ -58,6 +65,11 @@
 /** maximum unit size of program sent to blackfin */
 #define MAX_BLACKFIN_PROGRAM_SIZE (128 * 1024)
 
+/** max commands in a command batch and max size of the arguments (or return
+ * value) of one of them */
+#define MAX_BATCH_COMMANDS  1024
+#define MAX_BATCH_ARGS_SIZE (4 * 1024)
+
 #define GET_FLAG -1
 
 #define DEFAULT_DET_MAC  "00:aa:bb:cc:dd:ee"
@@ -167,8 +179,29 @@ class slsDetectorDefs {
         NUM_DISCARD_POLICIES
     };
 
+    enum socketBackend { UDP_SOCKET, PACKET_MMAP, NUM_SOCKET_BACKENDS };
+
+    enum writeEngine { IO_THREAD, IO_URING, NUM_WRITE_ENGINES };
+
+    enum fileCompression {
+        NO_COMPRESSION,
+        SHUFFLE_DEFLATE,
+        NUM_FILE_COMPRESSIONS
+    };
+
     enum fileFormat { BINARY, HDF5, NUM_FILE_FORMATS };
 
+    enum zmqHeaderFormat { JSON_HEADER, BINARY_HEADER, NUM_ZMQ_HEADER_FORMATS };
+
+    /** what the receiver streams when its zmq send queue is full */
+    enum zmqStreamingPolicy {
+        BLOCK_ON_FULL,
+        DROP_NEWEST,
+        DROP_OLDEST,
+        KEEP_LATEST,
+        NUM_ZMQ_STREAMING_POLICIES
+    };
+
     /**
         @short structure for a region of interest
         xmin,xmax,ymin,ymax define the limits of the region
@@ -570,6 +603,23 @@ enum streamingInterface {
         }
     } __attribute__((packed));
 
+    /** of a receiver streaming port, since the start of the acquisition */
+    struct streamingStatistics {
+        uint64_t streamed{0};
+        uint64_t dropped{0};
+        /** from the streamer taking the image out of the fifo until zmq
+         * releases it */
+        uint64_t averageLatency_ns{0};
+        uint64_t maxLatency_ns{0};
+
+        bool operator==(const streamingStatistics &other) const {
+            return ((streamed == other.streamed) &&
+                    (dropped == other.dropped) &&
+                    (averageLatency_ns == other.averageLatency_ns) &&
+                    (maxLatency_ns == other.maxLatency_ns));
+        }
+    } __attribute__((packed));
+
     /**
      * structure to udpate receiver
      */
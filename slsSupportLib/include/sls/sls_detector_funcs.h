@@ -292,6 +292,7 @@ enum detFuncs {
     F_SET_COLUMN,
     F_GET_PEDESTAL_MODE,
     F_SET_PEDESTAL_MODE,
+    F_EXEC_COMMAND_BATCH,
 
     NUM_DET_FUNCTIONS,
     RECEIVER_ENUM_START = 512, /**< detector function should not exceed this
@@ -403,6 +404,34 @@ enum detFuncs {
     F_RECEIVER_SET_TRANSCEIVER_MASK,
     F_RECEIVER_SET_ROW,
     F_RECEIVER_SET_COLUMN,
+    F_GET_RECEIVER_UDP_BATCH_SIZE,
+    F_SET_RECEIVER_UDP_BATCH_SIZE,
+    F_GET_RECEIVER_SOCKET_BACKEND,
+    F_SET_RECEIVER_SOCKET_BACKEND,
+    F_GET_RECEIVER_FIFO_HUGEPAGE,
+    F_SET_RECEIVER_FIFO_HUGEPAGE,
+    F_GET_RECEIVER_FIFO_NUMA_NODE,
+    F_SET_RECEIVER_FIFO_NUMA_NODE,
+    F_GET_RECEIVER_THREAD_CPUS,
+    F_SET_RECEIVER_THREAD_CPUS,
+    F_GET_RECEIVER_PROCESSING_THREADS,
+    F_SET_RECEIVER_PROCESSING_THREADS,
+    F_GET_RECEIVER_WRITE_ENGINE,
+    F_SET_RECEIVER_WRITE_ENGINE,
+    F_GET_RECEIVER_FILE_COMPRESSION,
+    F_SET_RECEIVER_FILE_COMPRESSION,
+    F_GET_RECEIVER_STREAMING_COMPRESSION,
+    F_SET_RECEIVER_STREAMING_COMPRESSION,
+    F_GET_RECEIVER_STREAMING_COMPRESSION_LEVEL,
+    F_SET_RECEIVER_STREAMING_COMPRESSION_LEVEL,
+    F_GET_RECEIVER_STREAMING_HEADER_FORMAT,
+    F_SET_RECEIVER_STREAMING_HEADER_FORMAT,
+    F_GET_RECEIVER_STREAMING_POLICY,
+    F_SET_RECEIVER_STREAMING_POLICY,
+    F_GET_RECEIVER_STREAMING_STATISTICS,
+    F_RECEIVER_EXEC_COMMAND_BATCH,
+    F_GET_RECEIVER_COMPRESSION_THREADS,
+    F_SET_RECEIVER_COMPRESSION_THREADS,
 
     NUM_REC_FUNCTIONS
 };
@@ -691,6 +720,7 @@ const char* getFunctionNameFromEnum(enum detFuncs func) {
     case F_SET_COLUMN:                      return "F_SET_COLUMN";
     case F_GET_PEDESTAL_MODE:               return "F_GET_PEDESTAL_MODE";   
     case F_SET_PEDESTAL_MODE:               return "F_SET_PEDESTAL_MODE";   
+    case F_EXEC_COMMAND_BATCH:              return "F_EXEC_COMMAND_BATCH";
 
     case NUM_DET_FUNCTIONS:              	return "NUM_DET_FUNCTIONS";
     case RECEIVER_ENUM_START:				return "RECEIVER_ENUM_START";
@@ -802,6 +832,34 @@ const char* getFunctionNameFromEnum(enum detFuncs func) {
     case F_RECEIVER_SET_TRANSCEIVER_MASK:   return "F_RECEIVER_SET_TRANSCEIVER_MASK";
     case F_RECEIVER_SET_ROW:                return "F_RECEIVER_SET_ROW";
     case F_RECEIVER_SET_COLUMN:             return "F_RECEIVER_SET_COLUMN";
+    case F_GET_RECEIVER_UDP_BATCH_SIZE:     return "F_GET_RECEIVER_UDP_BATCH_SIZE";
+    case F_SET_RECEIVER_UDP_BATCH_SIZE:     return "F_SET_RECEIVER_UDP_BATCH_SIZE";
+    case F_GET_RECEIVER_SOCKET_BACKEND:     return "F_GET_RECEIVER_SOCKET_BACKEND";
+    case F_SET_RECEIVER_SOCKET_BACKEND:     return "F_SET_RECEIVER_SOCKET_BACKEND";
+    case F_GET_RECEIVER_FIFO_HUGEPAGE:      return "F_GET_RECEIVER_FIFO_HUGEPAGE";
+    case F_SET_RECEIVER_FIFO_HUGEPAGE:      return "F_SET_RECEIVER_FIFO_HUGEPAGE";
+    case F_GET_RECEIVER_FIFO_NUMA_NODE:     return "F_GET_RECEIVER_FIFO_NUMA_NODE";
+    case F_SET_RECEIVER_FIFO_NUMA_NODE:     return "F_SET_RECEIVER_FIFO_NUMA_NODE";
+    case F_GET_RECEIVER_THREAD_CPUS:        return "F_GET_RECEIVER_THREAD_CPUS";
+    case F_SET_RECEIVER_THREAD_CPUS:        return "F_SET_RECEIVER_THREAD_CPUS";
+    case F_GET_RECEIVER_PROCESSING_THREADS: return "F_GET_RECEIVER_PROCESSING_THREADS";
+    case F_SET_RECEIVER_PROCESSING_THREADS: return "F_SET_RECEIVER_PROCESSING_THREADS";
+    case F_GET_RECEIVER_WRITE_ENGINE:       return "F_GET_RECEIVER_WRITE_ENGINE";
+    case F_SET_RECEIVER_WRITE_ENGINE:       return "F_SET_RECEIVER_WRITE_ENGINE";
+    case F_GET_RECEIVER_FILE_COMPRESSION:   return "F_GET_RECEIVER_FILE_COMPRESSION";
+    case F_SET_RECEIVER_FILE_COMPRESSION:   return "F_SET_RECEIVER_FILE_COMPRESSION";
+    case F_GET_RECEIVER_STREAMING_COMPRESSION:  return "F_GET_RECEIVER_STREAMING_COMPRESSION";
+    case F_SET_RECEIVER_STREAMING_COMPRESSION:  return "F_SET_RECEIVER_STREAMING_COMPRESSION";
+    case F_GET_RECEIVER_STREAMING_COMPRESSION_LEVEL:    return "F_GET_RECEIVER_STREAMING_COMPRESSION_LEVEL";
+    case F_SET_RECEIVER_STREAMING_COMPRESSION_LEVEL:    return "F_SET_RECEIVER_STREAMING_COMPRESSION_LEVEL";
+    case F_GET_RECEIVER_STREAMING_HEADER_FORMAT:    return "F_GET_RECEIVER_STREAMING_HEADER_FORMAT";
+    case F_SET_RECEIVER_STREAMING_HEADER_FORMAT:    return "F_SET_RECEIVER_STREAMING_HEADER_FORMAT";
+    case F_GET_RECEIVER_STREAMING_POLICY:       return "F_GET_RECEIVER_STREAMING_POLICY";
+    case F_SET_RECEIVER_STREAMING_POLICY:       return "F_SET_RECEIVER_STREAMING_POLICY";
+    case F_GET_RECEIVER_STREAMING_STATISTICS:   return "F_GET_RECEIVER_STREAMING_STATISTICS";
+    case F_RECEIVER_EXEC_COMMAND_BATCH:         return "F_RECEIVER_EXEC_COMMAND_BATCH";
+    case F_GET_RECEIVER_COMPRESSION_THREADS:    return "F_GET_RECEIVER_COMPRESSION_THREADS";
+    case F_SET_RECEIVER_COMPRESSION_THREADS:    return "F_SET_RECEIVER_COMPRESSION_THREADS";
 
 
     case NUM_REC_FUNCTIONS: 				return "NUM_REC_FUNCTIONS";
@@ -63,4 +63,9 @@ bool replace_first(std::string *s, const std::string &substr,
 
 std::pair<std::string, uint16_t> ParseHostPort(const std::string &s);
 
+/** Linux cpu list format, "0-3,8" gives {0, 1, 2, 3, 8}. Throws for cpus not
+ * in [0, CPU_SETSIZE) */
+std::vector<int> ParseCpuList(const std::string &s);
+std::string ToCpuList(std::vector<int> cpus);
+
 } // namespace sls
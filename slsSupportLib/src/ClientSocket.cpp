@@ -9,6 +9,7 @@
 #include <cassert>
 #include <cstring>
 #include <iostream>
+#include <poll.h>
 #include <stdexcept>
 #include <unistd.h>
 namespace sls {
@@ -46,6 +47,7 @@ ClientSocket::ClientSocket(std::string stype, const std::string &host,
         throw SocketError(msg);
     }
     freeaddrinfo(result);
+    setNoDelay();
 }
 
 ClientSocket::ClientSocket(std::string sType, struct sockaddr_in addr)
@@ -59,6 +61,7 @@ ClientSocket::ClientSocket(std::string sType, struct sockaddr_in addr)
                           std::to_string(addr.sin_port) + "\n";
         throw SocketError(msg);
     }
+    setNoDelay();
 }
 
 int ClientSocket::sendCommandThenRead(int fnum, const void *args,
@@ -103,6 +106,15 @@ void ClientSocket::readReply(int &ret, void *retval, size_t retval_size) {
     }
 }
 
+bool ClientSocket::isConnected() const {
+    if (getSocketId() < 0) {
+        return false;
+    }
+    // nothing to read between commands, unless closed
+    pollfd pfd{getSocketId(), POLLIN, 0};
+    return ::poll(&pfd, 1, 0) == 0;
+}
+
 std::string ClientSocket::readErrorMessage() {
     std::string error_msg(MAX_STR_LENGTH, '\0');
     Receive(&error_msg[0], error_msg.size());
@@ -11,6 +11,8 @@
 #include <fcntl.h>
 #include <iostream>
 #include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <sstream>
 #include <sys/socket.h>
 #include <sys/types.h>
@@ -81,7 +83,12 @@ int DataSocket::Send(const void *buffer, size_t size) {
     int bytes_sent = 0;
     int data_size = static_cast<int>(size); // signed size
     while (bytes_sent < (data_size)) {
-        auto this_send = ::write(getSocketId(), buffer, size);
+        // no SIGPIPE if the peer closed the connection (kept open between
+        // commands), the error is thrown below
+        auto this_send =
+            ::send(getSocketId(),
+                   reinterpret_cast<const char *>(buffer) + bytes_sent,
+                   data_size - bytes_sent, MSG_NOSIGNAL);
         if (this_send <= 0)
             break;
         bytes_sent += this_send;
@@ -114,6 +121,12 @@ int DataSocket::setReceiveTimeout(int us) {
                         sizeof(struct timeval));
 }
 
+int DataSocket::setNoDelay() {
+    int value = 1;
+    return ::setsockopt(getSocketId(), IPPROTO_TCP, TCP_NODELAY, &value,
+                        sizeof(value));
+}
+
 int DataSocket::setTimeOut(int t_seconds) {
     if (t_seconds <= 0)
         return -1;
@@ -4,14 +4,18 @@
 #include "sls/ServerInterface.h"
 
 #include "sls/DataSocket.h"
+#include "sls/container_utils.h"
 #include "sls/logger.h"
 #include "sls/sls_detector_defs.h"
 #include "sls/sls_detector_exceptions.h"
 #include "sls/string_utils.h"
 
+#include <algorithm>
 #include <arpa/inet.h>
+#include <cerrno>
 #include <cstring>
 #include <iostream>
+#include <poll.h>
 #include <stdexcept>
 #include <unistd.h>
 
@@ -55,7 +59,61 @@ ServerInterface ServerSocket::accept() {
     char tc[INET_ADDRSTRLEN]{};
     inet_ntop(AF_INET, &(clientAddr.sin_addr), tc, INET_ADDRSTRLEN);
     thisClient = IpAddr{tc};
-    return ServerInterface(newSocket);
+    ServerInterface socket(newSocket);
+    socket.setNoDelay();
+    return socket;
+}
+
+ServerInterface &ServerSocket::waitForCommand() {
+    while (true) {
+        std::vector<pollfd> fds;
+        fds.reserve(connections.size() + 1);
+        fds.push_back(pollfd{getSocketId(), POLLIN, 0});
+        for (const auto &it : connections) {
+            fds.push_back(pollfd{it.socket->getSocketId(), POLLIN, 0});
+        }
+        if (::poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw SocketError("Server ERROR: socket poll failed\n");
+        }
+
+        // new clients first, so that a client sending many commands on its
+        // connection does not keep out the others
+        if (fds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+            throw SocketError("Server ERROR: socket shut down\n");
+        }
+        if (fds[0].revents & POLLIN) {
+            auto socket = make_unique<ServerInterface>(accept());
+            connections.push_back(Connection{std::move(socket), thisClient});
+            return *connections.back().socket;
+        }
+
+        for (size_t i = 1; i != fds.size(); ++i) {
+            if (fds[i].revents == 0) {
+                continue;
+            }
+            auto &connection = connections[i - 1];
+            char c = 0;
+            if (::recv(fds[i].fd, &c, 1, MSG_PEEK) <= 0) {
+                // closed by the client
+                closeConnection(*connection.socket);
+                break;
+            }
+            lastClient = thisClient;
+            thisClient = connection.client;
+            return *connection.socket;
+        }
+    }
+}
+
+void ServerSocket::closeConnection(const ServerInterface &socket) {
+    connections.erase(std::remove_if(connections.begin(), connections.end(),
+                                     [&socket](const Connection &it) {
+                                         return it.socket.get() == &socket;
+                                     }),
+                      connections.end());
 }
 
 }; // namespace sls
@@ -172,6 +172,20 @@ std::ostream &operator<<(std::ostream &os,
     return os << ToString(r);
 }
 
+std::string ToString(const slsDetectorDefs::streamingStatistics &r) {
+    std::ostringstream oss;
+    oss << "[streamed " << r.streamed << ", dropped " << r.dropped
+        << ", latency avg "
+        << ToString(std::chrono::nanoseconds{r.averageLatency_ns}) << ", max "
+        << ToString(std::chrono::nanoseconds{r.maxLatency_ns}) << ']';
+    return oss.str();
+}
+
+std::ostream &operator<<(std::ostream &os,
+                         const slsDetectorDefs::streamingStatistics &r) {
+    return os << ToString(r);
+}
+
 std::string ToString(const defs::runStatus s) {
     switch (s) {
     case defs::ERROR:
@@ -310,6 +324,65 @@ std::string ToString(const defs::frameDiscardPolicy s) {
     }
 }
 
+std::string ToString(const defs::socketBackend s) {
+    switch (s) {
+    case defs::UDP_SOCKET:
+        return std::string("socket");
+    case defs::PACKET_MMAP:
+        return std::string("packetmmap");
+    default:
+        return std::string("Unknown");
+    }
+}
+
+std::string ToString(const defs::writeEngine s) {
+    switch (s) {
+    case defs::IO_THREAD:
+        return std::string("iothread");
+    case defs::IO_URING:
+        return std::string("iouring");
+    default:
+        return std::string("Unknown");
+    }
+}
+
+std::string ToString(const defs::fileCompression s) {
+    switch (s) {
+    case defs::NO_COMPRESSION:
+        return std::string("none");
+    case defs::SHUFFLE_DEFLATE:
+        return std::string("shuffledeflate");
+    default:
+        return std::string("Unknown");
+    }
+}
+
+std::string ToString(const defs::zmqHeaderFormat s) {
+    switch (s) {
+    case defs::JSON_HEADER:
+        return std::string("json");
+    case defs::BINARY_HEADER:
+        return std::string("binary");
+    default:
+        return std::string("Unknown");
+    }
+}
+
+std::string ToString(const defs::zmqStreamingPolicy s) {
+    switch (s) {
+    case defs::BLOCK_ON_FULL:
+        return std::string("block");
+    case defs::DROP_NEWEST:
+        return std::string("dropnewest");
+    case defs::DROP_OLDEST:
+        return std::string("dropoldest");
+    case defs::KEEP_LATEST:
+        return std::string("keeplatest");
+    default:
+        return std::string("Unknown");
+    }
+}
+
 std::string ToString(const defs::fileFormat s) {
     switch (s) {
     case defs::HDF5:
@@ -785,6 +858,50 @@ template <> defs::frameDiscardPolicy StringTo(const std::string &s) {
     throw RuntimeError("Unknown frame discard policy " + s);
 }
 
+template <> defs::socketBackend StringTo(const std::string &s) {
+    if (s == "socket")
+        return defs::UDP_SOCKET;
+    if (s == "packetmmap")
+        return defs::PACKET_MMAP;
+    throw RuntimeError("Unknown socket backend " + s);
+}
+
+template <> defs::writeEngine StringTo(const std::string &s) {
+    if (s == "iothread")
+        return defs::IO_THREAD;
+    if (s == "iouring")
+        return defs::IO_URING;
+    throw RuntimeError("Unknown write engine " + s);
+}
+
+template <> defs::fileCompression StringTo(const std::string &s) {
+    if (s == "none")
+        return defs::NO_COMPRESSION;
+    if (s == "shuffledeflate")
+        return defs::SHUFFLE_DEFLATE;
+    throw RuntimeError("Unknown file compression " + s);
+}
+
+template <> defs::zmqHeaderFormat StringTo(const std::string &s) {
+    if (s == "json")
+        return defs::JSON_HEADER;
+    if (s == "binary")
+        return defs::BINARY_HEADER;
+    throw RuntimeError("Unknown zmq header format " + s);
+}
+
+template <> defs::zmqStreamingPolicy StringTo(const std::string &s) {
+    if (s == "block")
+        return defs::BLOCK_ON_FULL;
+    if (s == "dropnewest")
+        return defs::DROP_NEWEST;
+    if (s == "dropoldest")
+        return defs::DROP_OLDEST;
+    if (s == "keeplatest")
+        return defs::KEEP_LATEST;
+    throw RuntimeError("Unknown zmq streaming policy " + s);
+}
+
 template <> defs::fileFormat StringTo(const std::string &s) {
     if (s == "hdf5")
         return defs::HDF5;
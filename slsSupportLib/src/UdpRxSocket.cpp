@@ -3,13 +3,22 @@
 #include "sls/UdpRxSocket.h"
 #include "sls/logger.h"
 #include "sls/network_utils.h"
+#include "sls/sls_detector_defs.h"
 #include "sls/sls_detector_exceptions.h"
+#include <algorithm>
+#include <arpa/inet.h>
 #include <cstdint>
 #include <errno.h>
 #include <iostream>
+#include <linux/filter.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+#include <net/if.h>
 #include <netdb.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
@@ -17,7 +26,8 @@ namespace sls {
 
 UdpRxSocket::UdpRxSocket(uint16_t port, ssize_t packet_size,
                          const char *hostname, int kernel_buffer_size)
-    : packet_size_(packet_size) {
+    : packet_size_(packet_size), port_(port) {
+    setBatchSize(1);
     struct addrinfo hints {};
     hints.ai_family = AF_UNSPEC;
     hints.ai_socktype = SOCK_DGRAM;
@@ -60,6 +70,7 @@ UdpRxSocket::UdpRxSocket(uint16_t port, ssize_t packet_size,
 
 UdpRxSocket::~UdpRxSocket() {
     Shutdown();
+    CloseRing();
     close(sockfd_);
     sockfd_ = -1;
 }
@@ -67,12 +78,103 @@ UdpRxSocket::~UdpRxSocket() {
 ssize_t UdpRxSocket::getPacketSize() const noexcept { return packet_size_; }
 
 bool UdpRxSocket::ReceivePacket(char *dst) noexcept {
+    if (ringfd_ != -1) {
+        char *data = nullptr;
+        uint32_t size = 0;
+        if (!NextRingPacket(true, data, size) ||
+            static_cast<ssize_t>(size) != packet_size_) {
+            return false;
+        }
+        memcpy(dst, data, size);
+        return true;
+    }
     auto bytes_received =
         recvfrom(sockfd_, dst, packet_size_, 0, nullptr, nullptr);
 
     return bytes_received == packet_size_;
 }
 
+int UdpRxSocket::ReceivePackets(char *dst) noexcept {
+    const int n_packets = static_cast<int>(msgs_.size());
+    if (ringfd_ != -1) {
+        int n = 0;
+        char *data = nullptr;
+        uint32_t size = 0;
+        while (n != n_packets && NextRingPacket(n == 0, data, size)) {
+            memcpy(dst + n * packet_size_, data,
+                   std::min<size_t>(size, packet_size_));
+            msgs_[n++].msg_len = size;
+        }
+        return n;
+    }
+    for (int i = 0; i != n_packets; ++i) {
+        iovec *iov = msgs_[i].msg_hdr.msg_iov;
+        iov[0].iov_base = dst + i * packet_size_;
+        iov[0].iov_len = packet_size_;
+        msgs_[i].msg_hdr.msg_iovlen = 1;
+        msgs_[i].msg_len = 0;
+    }
+    // block only for the first packet, then take whatever is queued
+    auto n = recvmmsg(sockfd_, msgs_.data(), n_packets, MSG_WAITFORONE,
+                      nullptr);
+    return n < 0 ? 0 : n;
+}
+
+int UdpRxSocket::ReceivePackets(char *header, size_t header_size,
+                                char *const *payload, int n_packets) noexcept {
+    if (ringfd_ != -1) {
+        const size_t payload_size = packet_size_ - header_size;
+        int n = 0;
+        char *data = nullptr;
+        uint32_t size = 0;
+        while (n != n_packets && NextRingPacket(n == 0, data, size)) {
+            memcpy(header + n * header_size, data,
+                   std::min<size_t>(size, header_size));
+            if (size > header_size) {
+                memcpy(payload[n], data + header_size,
+                       std::min<size_t>(size - header_size, payload_size));
+            }
+            msgs_[n++].msg_len = size;
+        }
+        return n;
+    }
+    for (int i = 0; i != n_packets; ++i) {
+        iovec *iov = msgs_[i].msg_hdr.msg_iov;
+        iov[0].iov_base = header + i * header_size;
+        iov[0].iov_len = header_size;
+        iov[1].iov_base = payload[i];
+        iov[1].iov_len = packet_size_ - header_size;
+        msgs_[i].msg_hdr.msg_iovlen = 2;
+        msgs_[i].msg_len = 0;
+    }
+    // block only for the first packet, then take whatever is queued
+    auto n = recvmmsg(sockfd_, msgs_.data(), n_packets, MSG_WAITFORONE,
+                      nullptr);
+    return n < 0 ? 0 : n;
+}
+
+bool UdpRxSocket::IsValidPacket(int i) const noexcept {
+    return msgs_[i].msg_len == static_cast<unsigned int>(packet_size_);
+}
+
+int UdpRxSocket::getBatchSize() const noexcept {
+    return static_cast<int>(msgs_.size());
+}
+
+void UdpRxSocket::setBatchSize(int n_packets) {
+    if (n_packets < 1 || n_packets > MAX_RX_UDP_BATCH_SIZE) {
+        throw RuntimeError("Invalid udp batch size " +
+                           std::to_string(n_packets) + ". Options: 1 - " +
+                           std::to_string(MAX_RX_UDP_BATCH_SIZE));
+    }
+    msgs_.assign(n_packets, mmsghdr{});
+    // two per packet for header and payload when scattering
+    iovecs_.assign(2 * n_packets, iovec{});
+    for (int i = 0; i != n_packets; ++i) {
+        msgs_[i].msg_hdr.msg_iov = &iovecs_[2 * i];
+    }
+}
+
 int UdpRxSocket::getBufferSize() const {
     int ret = 0;
     socklen_t optlen = sizeof(ret);
@@ -89,7 +191,213 @@ void UdpRxSocket::setBufferSize(int size) {
 }
 
 void UdpRxSocket::Shutdown() {
-    // not closing yet on purpose, but read gives -1
+    // not closing yet on purpose, but read gives -1 (and wakes up the poll
+    // on the packet ring)
     shutdown(sockfd_, SHUT_RDWR);
 }
+
+void UdpRxSocket::UsePacketRing(const std::string &interface,
+                                size_t ring_size) {
+    CloseRing();
+    ringfd_ = socket(AF_PACKET, SOCK_DGRAM, htons(ETH_P_IP));
+    try {
+        if (ringfd_ == -1) {
+            throw RuntimeError("Failed to create packet socket [" +
+                               std::string(strerror(errno)) + ']');
+        }
+        // only unfragmented udp packets to our port reach the ring
+        // (offsets from the ip header as it is a SOCK_DGRAM packet socket)
+        sock_filter code[] = {
+            BPF_STMT(BPF_LD | BPF_B | BPF_ABS, 9), // protocol
+            BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, IPPROTO_UDP, 0, 6),
+            BPF_STMT(BPF_LD | BPF_H | BPF_ABS, 6), // fragment offset
+            BPF_JUMP(BPF_JMP | BPF_JSET | BPF_K, 0x1fff, 4, 0),
+            BPF_STMT(BPF_LDX | BPF_B | BPF_MSH, 0), // ip header length
+            BPF_STMT(BPF_LD | BPF_H | BPF_IND, 2),  // udp destination port
+            BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, port_, 0, 1),
+            BPF_STMT(BPF_RET | BPF_K, 0xffffffff),
+            BPF_STMT(BPF_RET | BPF_K, 0),
+        };
+        sock_fprog filter{sizeof(code) / sizeof(code[0]), code};
+        if (setsockopt(ringfd_, SOL_SOCKET, SO_ATTACH_FILTER, &filter,
+                       sizeof(filter))) {
+            throw RuntimeError("Could not attach packet filter [" +
+                               std::string(strerror(errno)) + ']');
+        }
+        int version = TPACKET_V3;
+        if (setsockopt(ringfd_, SOL_PACKET, PACKET_VERSION, &version,
+                       sizeof(version))) {
+            throw RuntimeError("Could not set TPACKET_V3 [" +
+                               std::string(strerror(errno)) + ']');
+        }
+
+        // 4 MB blocks, retired by the kernel latest after 1 ms
+        block_size_ = 1 << 22;
+        num_blocks_ = std::max<size_t>(2, ring_size / block_size_);
+        tpacket_req3 req{};
+        req.tp_block_size = block_size_;
+        req.tp_block_nr = num_blocks_;
+        req.tp_frame_size = TPACKET_ALIGNMENT << 7;
+        req.tp_frame_nr = (block_size_ / req.tp_frame_size) * num_blocks_;
+        req.tp_retire_blk_tov = 1;
+        if (setsockopt(ringfd_, SOL_PACKET, PACKET_RX_RING, &req,
+                       sizeof(req))) {
+            throw RuntimeError("Could not set up packet ring [" +
+                               std::string(strerror(errno)) + ']');
+        }
+        void *ring = mmap(nullptr, block_size_ * num_blocks_,
+                          PROT_READ | PROT_WRITE, MAP_SHARED, ringfd_, 0);
+        if (ring == MAP_FAILED) {
+            throw RuntimeError("Could not map packet ring [" +
+                               std::string(strerror(errno)) + ']');
+        }
+        ring_ = static_cast<char *>(ring);
+
+        sockaddr_ll addr{};
+        addr.sll_family = AF_PACKET;
+        addr.sll_protocol = htons(ETH_P_IP);
+        if (!interface.empty()) {
+            addr.sll_ifindex = if_nametoindex(interface.c_str());
+            if (addr.sll_ifindex == 0) {
+                throw RuntimeError("Unknown interface " + interface);
+            }
+        }
+        if (bind(ringfd_, reinterpret_cast<sockaddr *>(&addr),
+                 sizeof(addr))) {
+            throw RuntimeError("Could not bind packet ring to " +
+                               interface + " [" +
+                               std::string(strerror(errno)) + ']');
+        }
+
+        // the udp socket only prevents icmp port unreachable replies, let
+        // the kernel drop the packets before they are queued (a packet
+        // reaching it would be taken for a shutdown by NextRingPacket)
+        sock_filter drop[] = {BPF_STMT(BPF_RET | BPF_K, 0)};
+        sock_fprog dropFilter{1, drop};
+        if (setsockopt(sockfd_, SOL_SOCKET, SO_ATTACH_FILTER, &dropFilter,
+                       sizeof(dropFilter))) {
+            throw RuntimeError("Could not attach drop filter to udp socket [" +
+                               std::string(strerror(errno)) + ']');
+        }
+    } catch (...) {
+        CloseRing();
+        throw;
+    }
+
+    // and drain its queue
+    char dummy;
+    while (recv(sockfd_, &dummy, sizeof(dummy), MSG_DONTWAIT) >= 0)
+        ;
+}
+
+bool UdpRxSocket::IsPacketRing() const noexcept { return ringfd_ != -1; }
+
+UdpRxSocket::RingStatistics UdpRxSocket::getRingStatistics() {
+    RingStatistics stats;
+    if (ringfd_ == -1) {
+        return stats;
+    }
+    stats.packets = ring_packets_;
+    stats.seconds = ring_last_ts_ - ring_first_ts_;
+    // reset by the kernel on every read
+    tpacket_stats_v3 kstats{};
+    socklen_t len = sizeof(kstats);
+    if (getsockopt(ringfd_, SOL_PACKET, PACKET_STATISTICS, &kstats, &len) ==
+        0) {
+        stats.drops = kstats.tp_drops;
+    }
+    ring_packets_ = 0;
+    ring_first_ts_ = 0;
+    ring_last_ts_ = 0;
+    return stats;
+}
+
+bool UdpRxSocket::NextRingPacket(bool wait, char *&data,
+                                 uint32_t &size) noexcept {
+    while (true) {
+        if (packets_left_ == 0) {
+            auto *block = reinterpret_cast<tpacket_block_desc *>(
+                ring_ + current_block_ * block_size_);
+            // payload of the previous call has been copied by now
+            if (holding_block_) {
+                __atomic_store_n(&block->hdr.bh1.block_status,
+                                 TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+                holding_block_ = false;
+                current_block_ = (current_block_ + 1) % num_blocks_;
+                block = reinterpret_cast<tpacket_block_desc *>(
+                    ring_ + current_block_ * block_size_);
+            }
+            if (!(__atomic_load_n(&block->hdr.bh1.block_status,
+                                  __ATOMIC_ACQUIRE) &
+                  TP_STATUS_USER)) {
+                if (!wait) {
+                    return false;
+                }
+                // udp socket is readable only once it is shut down
+                pollfd fds[2]{{ringfd_, POLLIN | POLLERR, 0},
+                              {sockfd_, POLLIN, 0}};
+                if ((poll(fds, 2, -1) == -1 && errno != EINTR) ||
+                    fds[1].revents) {
+                    return false;
+                }
+                continue;
+            }
+            holding_block_ = true;
+            const auto &bh = block->hdr.bh1;
+            packets_left_ = bh.num_pkts;
+            next_packet_ = reinterpret_cast<char *>(block) +
+                           bh.offset_to_first_pkt;
+            ring_packets_ += bh.num_pkts;
+            if (ring_first_ts_ == 0) {
+                ring_first_ts_ = bh.ts_first_pkt.ts_sec +
+                                 bh.ts_first_pkt.ts_nsec * 1e-9;
+            }
+            ring_last_ts_ =
+                bh.ts_last_pkt.ts_sec + bh.ts_last_pkt.ts_nsec * 1e-9;
+            continue;
+        }
+
+        auto *hdr = reinterpret_cast<tpacket3_hdr *>(next_packet_);
+        next_packet_ += hdr->tp_next_offset;
+        --packets_left_;
+        auto *ll = reinterpret_cast<sockaddr_ll *>(
+            reinterpret_cast<char *>(hdr) +
+            TPACKET_ALIGN(sizeof(tpacket3_hdr)));
+        // own packets seen again on loopback
+        if (ll->sll_pkttype == PACKET_OUTGOING) {
+            continue;
+        }
+        char *ip = reinterpret_cast<char *>(hdr) + hdr->tp_net;
+        uint32_t ip_header_size = (ip[0] & 0xf) * 4;
+        uint16_t udp_length = 0;
+        memcpy(&udp_length, ip + ip_header_size + 4, sizeof(udp_length));
+        udp_length = ntohs(udp_length);
+        // udp header is 8 bytes
+        if (udp_length < 8 ||
+            hdr->tp_snaplen < ip_header_size + udp_length) {
+            continue;
+        }
+        data = ip + ip_header_size + 8;
+        size = udp_length - 8;
+        return true;
+    }
+}
+
+void UdpRxSocket::CloseRing() noexcept {
+    if (ring_ != nullptr) {
+        munmap(ring_, block_size_ * num_blocks_);
+        ring_ = nullptr;
+    }
+    if (ringfd_ != -1) {
+        close(ringfd_);
+        ringfd_ = -1;
+    }
+    current_block_ = 0;
+    holding_block_ = false;
+    packets_left_ = 0;
+    next_packet_ = nullptr;
+    ring_packets_ = 0;
+    ring_first_ts_ = 0;
+    ring_last_ts_ = 0;
+}
 } // namespace sls
\ No newline at end of file
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: LGPL-3.0-or-other
 // Copyright (C) 2021 Contributors to the SLS Detector Package
 #include "sls/ZmqSocket.h"
+#include "sls/compression_utils.h"
 #include "sls/logger.h"
 #include "sls/network_utils.h" //ip
 #include <chrono>
@@ -69,6 +70,14 @@ ZmqSocket::ZmqSocket(const uint16_t portnumber, const char *ethip)
         throw ZmqSocketError("Could not create socket");
     }
     LOG(logDEBUG) << "Default send high water mark:" << GetSendHighWaterMark();
+    // messages of slow subscribers are discarded on close, instead of
+    // waiting for them (they might hold buffers sent without copy)
+    const int linger = 0;
+    if (zmq_setsockopt(sockfd.socketDescriptor, ZMQ_LINGER, &linger,
+                       sizeof(linger))) {
+        PrintError();
+        throw ZmqSocketError("Could not set ZMQ_LINGER");
+    }
 
     // construct address, can be refactored with libfmt
     std::ostringstream oss;
@@ -211,30 +220,64 @@ int ZmqSocket::Connect() {
     return 0;
 }
 
-int ZmqSocket::SendHeader(int index, zmqHeader header) {
+namespace {
+
+/** faster than an ostream for the fields of each header */
+void AppendNumber(std::string &s, uint64_t value) {
+    char buf[20];
+    char *end = buf + sizeof(buf);
+    char *p = end;
+    do {
+        *--p = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    s.append(p, end);
+}
+
+/** true if the fields of the header template are the same */
+bool SameTemplate(const zmqHeader &a, const zmqHeader &b) {
+    return a.data == b.data && a.jsonversion == b.jsonversion &&
+           a.dynamicRange == b.dynamicRange && a.fileIndex == b.fileIndex &&
+           a.ndetx == b.ndetx && a.ndety == b.ndety &&
+           a.npixelsx == b.npixelsx && a.npixelsy == b.npixelsy &&
+           a.fname == b.fname && a.detType == b.detType &&
+           a.version == b.version && a.flipRows == b.flipRows &&
+           a.quad == b.quad && a.addJsonHeader == b.addJsonHeader &&
+           a.rx_roi == b.rx_roi;
+}
+
+} // namespace
+
+void ZmqSocket::UpdateHeaderTemplate(const zmqHeader &header) {
+    if (templateHeader && SameTemplate(*templateHeader, header)) {
+        return;
+    }
+    templateHeader = make_unique<zmqHeader>(header);
+
+    addJsonHeaderText.clear();
+    if (!header.addJsonHeader.empty()) {
+        std::ostringstream oss;
+        oss << "{";
+        for (auto it = header.addJsonHeader.begin();
+             it != header.addJsonHeader.end(); ++it) {
+            if (it != header.addJsonHeader.begin()) {
+                oss << ", ";
+            }
+            oss << "\"" << it->first.c_str() << "\":\"" << it->second.c_str()
+                << "\"";
+        }
+        oss << " } ";
+        addJsonHeaderText = oss.str();
+    }
+
     std::ostringstream oss;
     oss << "{\"jsonversion\":" << header.jsonversion
         << ", \"bitmode\":" << header.dynamicRange
         << ", \"fileIndex\":" << header.fileIndex << ", \"detshape\":["
         << header.ndetx << ", " << header.ndety << ']' << ", \"shape\":["
         << header.npixelsx << ", " << header.npixelsy << ']'
-        << ", \"size\":" << header.imageSize
-        << ", \"acqIndex\":" << header.acqIndex
-        << ", \"frameIndex\":" << header.frameIndex
-        << ", \"progress\":" << header.progress << ", \"fname\":\""
-        << header.fname << '\"' << ", \"data\":" << (header.data ? 1 : 0)
-        << ", \"completeImage\":" << (header.completeImage ? 1 : 0)
-
-        << ", \"frameNumber\":" << header.frameNumber
-        << ", \"expLength\":" << header.expLength
-        << ", \"packetNumber\":" << header.packetNumber
-        << ", \"detSpec1\":" << header.detSpec1
-        << ", \"timestamp\":" << header.timestamp
-        << ", \"modId\":" << header.modId << ", \"row\":" << header.row
-        << ", \"column\":" << header.column
-        << ", \"detSpec2\":" << header.detSpec2
-        << ", \"detSpec3\":" << header.detSpec3
-        << ", \"detSpec4\":" << header.detSpec4
+        << ", \"fname\":\"" << header.fname << '\"'
+        << ", \"data\":" << (header.data ? 1 : 0)
         << ", \"detType\":" << static_cast<int>(header.detType)
         << ", \"version\":"
         << static_cast<int>(header.version)
@@ -242,29 +285,115 @@ int ZmqSocket::SendHeader(int index, zmqHeader header) {
         // additional stuff
         << ", \"flipRows\":" << header.flipRows << ", \"quad\":" << header.quad;
 
-    if (!header.addJsonHeader.empty()) {
-        oss << ", \"addJsonHeader\": {";
-        for (auto it = header.addJsonHeader.begin();
-             it != header.addJsonHeader.end(); ++it) {
-            if (it != header.addJsonHeader.begin()) {
-                oss << ", ";
-            }
-            oss << "\"" << it->first.c_str() << "\":\"" << it->second.c_str()
-                << "\"";
-        }
-        oss << " } ";
+    if (!addJsonHeaderText.empty()) {
+        oss << ", \"addJsonHeader\": " << addJsonHeaderText;
     }
     oss << ", \"rx_roi\":[" << header.rx_roi[0] << ", " << header.rx_roi[1]
         << ", " << header.rx_roi[2] << ", " << header.rx_roi[3] << "]";
-    oss << "}\n";
-    std::string message = oss.str();
-    int length = message.length();
+    jsonTemplate = oss.str();
+}
+
+void ZmqSocket::RenderJsonHeader(const zmqHeader &header) {
+    message.assign(jsonTemplate);
+    message.append(", \"size\":");
+    AppendNumber(message, header.imageSize);
+    message.append(", \"acqIndex\":");
+    AppendNumber(message, header.acqIndex);
+    message.append(", \"frameIndex\":");
+    AppendNumber(message, header.frameIndex);
+    // as an ostream with default precision
+    char progress[32];
+    snprintf(progress, sizeof(progress), "%g", header.progress);
+    message.append(", \"progress\":");
+    message.append(progress);
+    message.append(", \"completeImage\":");
+    message.append(header.completeImage ? "1" : "0");
+    message.append(", \"frameNumber\":");
+    AppendNumber(message, header.frameNumber);
+    message.append(", \"expLength\":");
+    AppendNumber(message, header.expLength);
+    message.append(", \"packetNumber\":");
+    AppendNumber(message, header.packetNumber);
+    message.append(", \"detSpec1\":");
+    AppendNumber(message, header.detSpec1);
+    message.append(", \"timestamp\":");
+    AppendNumber(message, header.timestamp);
+    message.append(", \"modId\":");
+    AppendNumber(message, header.modId);
+    message.append(", \"row\":");
+    AppendNumber(message, header.row);
+    message.append(", \"column\":");
+    AppendNumber(message, header.column);
+    message.append(", \"detSpec2\":");
+    AppendNumber(message, header.detSpec2);
+    message.append(", \"detSpec3\":");
+    AppendNumber(message, header.detSpec3);
+    message.append(", \"detSpec4\":");
+    AppendNumber(message, header.detSpec4);
+    if (!header.compression.empty()) {
+        message.append(", \"compression\":\"");
+        message.append(header.compression);
+        message.append("\"");
+    }
+    message.append("}\n");
+}
+
+void ZmqSocket::RenderBinaryHeader(const zmqHeader &header) {
+    zmqBinaryHeader b;
+    b.data = header.data ? 1 : 0;
+    b.completeImage = header.completeImage ? 1 : 0;
+    b.jsonversion = header.jsonversion;
+    b.dynamicRange = header.dynamicRange;
+    b.fileIndex = header.fileIndex;
+    b.ndetx = header.ndetx;
+    b.ndety = header.ndety;
+    b.npixelsx = header.npixelsx;
+    b.npixelsy = header.npixelsy;
+    b.imageSize = header.imageSize;
+    b.acqIndex = header.acqIndex;
+    b.frameIndex = header.frameIndex;
+    b.progress = header.progress;
+    b.frameNumber = header.frameNumber;
+    b.expLength = header.expLength;
+    b.packetNumber = header.packetNumber;
+    b.detSpec1 = header.detSpec1;
+    b.timestamp = header.timestamp;
+    b.modId = header.modId;
+    b.row = header.row;
+    b.column = header.column;
+    b.detSpec2 = header.detSpec2;
+    b.detSpec3 = header.detSpec3;
+    b.detSpec4 = header.detSpec4;
+    b.detType = header.detType;
+    b.version = header.version;
+    b.flipRows = header.flipRows;
+    b.quad = header.quad;
+    for (size_t i = 0; i != header.rx_roi.size(); ++i) {
+        b.rx_roi[i] = header.rx_roi[i];
+    }
+    b.fnameLength = header.fname.size();
+    b.addJsonHeaderLength = addJsonHeaderText.size();
+    b.compressionLength = header.compression.size();
+
+    message.assign(reinterpret_cast<const char *>(&b), sizeof(b));
+    message.append(header.fname);
+    message.append(addJsonHeaderText);
+    message.append(header.compression);
+}
+
+int ZmqSocket::SendHeader(int index, const zmqHeader &header) {
+    UpdateHeaderTemplate(header);
+    if (binaryHeader) {
+        RenderBinaryHeader(header);
+    } else {
+        RenderJsonHeader(header);
+    }
 #ifdef ZMQ_DETAIL
     // if(!index)
     LOG(logINFOBLUE) << index << " : Streamer: buf: " << message;
 #endif
 
-    if (zmq_send(sockfd.socketDescriptor, message.c_str(), length,
+    if (zmq_send(sockfd.socketDescriptor, message.data(), message.size(),
                  header.data ? ZMQ_SNDMORE : 0) < 0) {
         PrintError();
         return 0;
@@ -283,6 +412,33 @@ int ZmqSocket::SendData(char *buf, int length) {
     return 1;
 }
 
+int ZmqSocket::SendData(char *buf, int length, FreeFunction freeFunction,
+                        void *hint) {
+    zmq_msg_t message;
+    if (zmq_msg_init_data(&message, buf, length, freeFunction, hint) != 0) {
+        PrintError();
+        freeFunction(buf, hint);
+        return 0;
+    }
+    if (zmq_msg_send(&message, sockfd.socketDescriptor, 0) < 0) {
+        PrintError();
+        // releases buf
+        zmq_msg_close(&message);
+        return 0;
+    }
+    return 1;
+}
+
+bool ZmqSocket::WaitForMessage(int timeoutMs) {
+    zmq_pollitem_t item{sockfd.socketDescriptor, 0, ZMQ_POLLIN, 0};
+    int ret = zmq_poll(&item, 1, timeoutMs);
+    if (ret < 0 && errno != EINTR) {
+        PrintError();
+        throw ZmqSocketError("Could not poll socket");
+    }
+    return ret > 0;
+}
+
 int ZmqSocket::ReceiveHeader(const int index, zmqHeader &zHeader,
                              uint32_t version) {
     const int bytes_received = zmq_recv(sockfd.socketDescriptor,
@@ -292,8 +448,19 @@ int ZmqSocket::ReceiveHeader(const int index, zmqHeader &zHeader,
         cprintf(BLUE, "Header %d [%hu] Length: %d Header:%s \n", index, portno,
                 bytes_received, header_buffer.get());
 #endif
-        if (ParseHeader(index, bytes_received, header_buffer.get(), zHeader,
-                        version)) {
+        uint32_t magic = 0;
+        if (bytes_received >= (int)sizeof(magic)) {
+            memcpy(&magic, header_buffer.get(), sizeof(magic));
+        }
+        int parsed = 0;
+        if (magic == ZMQ_BINARY_HEADER_MAGIC) {
+            parsed = ParseBinaryHeader(index, bytes_received,
+                                       header_buffer.get(), zHeader, version);
+        } else {
+            parsed = ParseHeader(index, bytes_received, header_buffer.get(),
+                                 zHeader, version);
+        }
+        if (parsed) {
 #ifdef ZMQ_DETAIL
             cprintf(RED, "Parsed Header %d [%hu] Length: %d Header:%s \n",
                     index, portno, bytes_received, header_buffer.get());
@@ -382,6 +549,115 @@ int ZmqSocket::ParseHeader(const int index, int length, char *buff,
         zHeader.rx_roi[i] = a[i].GetInt();
     }
 
+    zHeader.compression.clear();
+    if (document.HasMember("compression")) {
+        zHeader.compression = document["compression"].GetString();
+    }
+    receivedCompression = zHeader.compression;
+    receivedImageSize = zHeader.imageSize;
+    receivedBytesPerPixel = bytesPerPixel(zHeader.dynamicRange);
+
+    return 1;
+}
+
+int ZmqSocket::ParseBinaryHeader(const int index, int length,
+                                 const char *buff, zmqHeader &zHeader,
+                                 uint32_t version) {
+    zmqBinaryHeader b;
+    if (length < (int)sizeof(b) || length > MAX_STR_LENGTH) {
+        LOG(logERROR) << index << " Could not parse binary header. len:"
+                      << length;
+        return 0;
+    }
+    memcpy(&b, buff, sizeof(b));
+    if (b.binaryVersion != ZMQ_BINARY_HEADER_VERSION) {
+        LOG(logERROR) << "binary header version mismatch. required "
+                      << ZMQ_BINARY_HEADER_VERSION << ", got "
+                      << b.binaryVersion;
+        return 0;
+    }
+
+    // version check
+    zHeader.jsonversion = b.jsonversion;
+    if (zHeader.jsonversion != version) {
+        LOG(logERROR) << "version mismatch. required " << version << ", got "
+                      << zHeader.jsonversion;
+        return 0;
+    }
+    if ((int)sizeof(b) + b.fnameLength + b.addJsonHeaderLength +
+            b.compressionLength !=
+        length) {
+        LOG(logERROR) << index << " Could not parse binary header. len:"
+                      << length;
+        return 0;
+    }
+
+    // parse
+    zHeader.data = (b.data != 0);
+    zHeader.dynamicRange = b.dynamicRange;
+    zHeader.fileIndex = b.fileIndex;
+    zHeader.ndetx = b.ndetx;
+    zHeader.ndety = b.ndety;
+    zHeader.npixelsx = b.npixelsx;
+    zHeader.npixelsy = b.npixelsy;
+    zHeader.imageSize = b.imageSize;
+    zHeader.acqIndex = b.acqIndex;
+    zHeader.frameIndex = b.frameIndex;
+    zHeader.progress = b.progress;
+
+    zHeader.frameNumber = b.frameNumber;
+    zHeader.expLength = b.expLength;
+    zHeader.packetNumber = b.packetNumber;
+    zHeader.detSpec1 = b.detSpec1;
+    zHeader.timestamp = b.timestamp;
+    zHeader.modId = b.modId;
+    zHeader.row = b.row;
+    zHeader.column = b.column;
+    zHeader.detSpec2 = b.detSpec2;
+    zHeader.detSpec3 = b.detSpec3;
+    zHeader.detSpec4 = b.detSpec4;
+    zHeader.detType = b.detType;
+    zHeader.version = b.version;
+
+    zHeader.flipRows = b.flipRows;
+    zHeader.quad = b.quad;
+    zHeader.completeImage = (b.completeImage != 0);
+    for (size_t i = 0; i != zHeader.rx_roi.size(); ++i) {
+        zHeader.rx_roi[i] = b.rx_roi[i];
+    }
+
+    const char *text = buff + sizeof(b);
+    zHeader.fname.assign(text, b.fnameLength);
+    text += b.fnameLength;
+
+    // parsed only if it changed
+    if (receivedAddJsonHeaderText.compare(0, std::string::npos, text,
+                                          b.addJsonHeaderLength) != 0) {
+        receivedAddJsonHeader.clear();
+        if (b.addJsonHeaderLength != 0) {
+            Document document;
+            if (document.Parse(text, b.addJsonHeaderLength).HasParseError() ||
+                !document.IsObject()) {
+                LOG(logERROR) << index
+                              << " Could not parse additional json header";
+                return 0;
+            }
+            for (Value::ConstMemberIterator iter = document.MemberBegin();
+                 iter != document.MemberEnd(); ++iter) {
+                receivedAddJsonHeader[iter->name.GetString()] =
+                    iter->value.GetString();
+            }
+        }
+        receivedAddJsonHeaderText.assign(text, b.addJsonHeaderLength);
+    }
+    zHeader.addJsonHeader = receivedAddJsonHeader;
+    text += b.addJsonHeaderLength;
+
+    zHeader.compression.assign(text, b.compressionLength);
+    receivedCompression = zHeader.compression;
+    receivedImageSize = zHeader.imageSize;
+    receivedBytesPerPixel = bytesPerPixel(zHeader.dynamicRange);
+
     return 1;
 }
 
@@ -389,10 +665,36 @@ int ZmqSocket::ReceiveData(const int index, char *buf, const int size) {
     zmq_msg_t message;
     zmq_msg_init(&message);
     int length = ReceiveMessage(index, message);
+    const char *data = (char *)zmq_msg_data(&message);
+
+    // decompress (directly to buf if it is the image size)
+    if (length > 0 && !receivedCompression.empty()) {
+        char *dst = buf;
+        if ((int)receivedImageSize != size) {
+            decompressed.resize(receivedImageSize);
+            dst = decompressed.data();
+        }
+        if (receivedCompression != ZMQ_CODEC_SHUFFLE_DEFLATE ||
+            !inflateUnshuffle(data, length, receivedBytesPerPixel, dst,
+                              receivedImageSize, unshuffled)) {
+            LOG(logERROR) << "Could not decompress data (codec "
+                          << receivedCompression << ") for socket " << index;
+            memset(buf, 0xFF, size);
+            zmq_msg_close(&message);
+            return -1;
+        }
+        length = receivedImageSize;
+        if (dst == buf) {
+            zmq_msg_close(&message);
+            return length;
+        }
+        data = dst;
+    }
+
     if (length == size) {
-        memcpy(buf, (char *)zmq_msg_data(&message), size);
+        memcpy(buf, data, size);
     } else if (length < size) {
-        memcpy(buf, (char *)zmq_msg_data(&message), length);
+        memcpy(buf, data, length);
         memset(buf + length, 0xFF, size - length);
     } else {
         LOG(logERROR) << "Received weird packet size " << length
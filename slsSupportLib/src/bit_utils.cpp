@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "sls/bit_utils.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SLS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace sls {
+
+void unpack12To16BitScalar(uint16_t *dst, const uint8_t *src, size_t n) {
+    for (size_t i = 0; i + 1 < n; i += 2) {
+        uint16_t b0 = src[0], b1 = src[1], b2 = src[2];
+        dst[i] = b0 | ((b1 & 0xF) << 8);
+        dst[i + 1] = (b1 >> 4) | (b2 << 4);
+        src += 3;
+    }
+}
+
+#ifdef SLS_X86_SIMD
+namespace {
+
+// 8 pixels from 12 bytes: each 16 bit lane gets the 2 bytes of its pixel,
+// even pixels are then masked, odd pixels shifted
+__attribute__((target("ssse3"))) size_t
+unpack12To16BitSsse3(uint16_t *dst, const uint8_t *src, size_t n) {
+    const __m128i shuffle =
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m128i evenMask = _mm_set1_epi32(0x00000FFF);
+    size_t i = 0;
+    // 16 bytes are loaded for 12
+    for (; i + 8 <= n && (i / 2) * 3 + 16 <= (n / 2) * 3; i += 8) {
+        __m128i v = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(src + (i / 2) * 3));
+        v = _mm_shuffle_epi8(v, shuffle);
+        __m128i even = _mm_and_si128(v, evenMask);
+        __m128i odd = _mm_andnot_si128(evenMask, _mm_srli_epi16(v, 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i),
+                         _mm_or_si128(even, odd));
+    }
+    return i;
+}
+
+// 16 pixels from 24 bytes, 12 bytes per 128 bit lane
+__attribute__((target("avx2"))) size_t
+unpack12To16BitAvx2(uint16_t *dst, const uint8_t *src, size_t n) {
+    const __m256i shuffle = _mm256_setr_epi8(
+        0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11, 0, 1, 1, 2, 3, 4, 4,
+        5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m256i evenMask = _mm256_set1_epi32(0x00000FFF);
+    size_t i = 0;
+    // 28 bytes are loaded for 24
+    for (; i + 16 <= n && (i / 2) * 3 + 28 <= (n / 2) * 3; i += 16) {
+        const uint8_t *s = src + (i / 2) * 3;
+        __m256i v = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(s))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 12)), 1);
+        v = _mm256_shuffle_epi8(v, shuffle);
+        __m256i even = _mm256_and_si256(v, evenMask);
+        __m256i odd =
+            _mm256_andnot_si256(evenMask, _mm256_srli_epi16(v, 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i),
+                            _mm256_or_si256(even, odd));
+    }
+    return i;
+}
+
+using UnpackFunction = size_t (*)(uint16_t *, const uint8_t *, size_t);
+
+UnpackFunction selectUnpack() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return unpack12To16BitAvx2;
+    if (__builtin_cpu_supports("ssse3"))
+        return unpack12To16BitSsse3;
+    return nullptr;
+}
+
+} // namespace
+#endif
+
+void unpack12To16Bit(uint16_t *dst, const uint8_t *src, size_t n) {
+    size_t done = 0;
+#ifdef SLS_X86_SIMD
+    static const UnpackFunction simd = selectUnpack();
+    if (simd != nullptr) {
+        done = simd(dst, src, n);
+    }
+#endif
+    // tail
+    unpack12To16BitScalar(dst + done, src + (done / 2) * 3, n - done);
+}
+
+} // namespace sls
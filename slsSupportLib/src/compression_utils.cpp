@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "sls/compression_utils.h"
+
+#include <cstring>
+#include <zlib.h>
+
+namespace sls {
+
+size_t bytesPerPixel(uint32_t dynamicRange) {
+    return (dynamicRange >= 16 ? dynamicRange / 8 : 1);
+}
+
+void shuffleBytes(const char *src, size_t size, size_t bytesPerPixel,
+                  char *dst) {
+    size_t n = size / bytesPerPixel;
+    for (size_t b = 0; b != bytesPerPixel; ++b) {
+        char *plane = dst + b * n;
+        for (size_t i = 0; i != n; ++i) {
+            plane[i] = src[i * bytesPerPixel + b];
+        }
+    }
+    size_t rest = n * bytesPerPixel;
+    memcpy(dst + rest, src + rest, size - rest);
+}
+
+void unshuffleBytes(const char *src, size_t size, size_t bytesPerPixel,
+                    char *dst) {
+    size_t n = size / bytesPerPixel;
+    for (size_t b = 0; b != bytesPerPixel; ++b) {
+        const char *plane = src + b * n;
+        for (size_t i = 0; i != n; ++i) {
+            dst[i * bytesPerPixel + b] = plane[i];
+        }
+    }
+    size_t rest = n * bytesPerPixel;
+    memcpy(dst + rest, src + rest, size - rest);
+}
+
+bool shuffleDeflate(const char *buf, size_t size, size_t bytesPerPixel,
+                    int level, std::vector<char> &shuffled,
+                    std::vector<char> &compressed) {
+    const char *src = buf;
+    if (bytesPerPixel > 1) {
+        shuffled.resize(size);
+        shuffleBytes(buf, size, bytesPerPixel, shuffled.data());
+        src = shuffled.data();
+    }
+
+    uLongf length = compressBound(size);
+    compressed.resize(length);
+    if (compress2((Bytef *)compressed.data(), &length, (const Bytef *)src,
+                  size, level) != Z_OK ||
+        length >= size) {
+        return false;
+    }
+    compressed.resize(length);
+    return true;
+}
+
+bool inflateUnshuffle(const char *buf, size_t length, size_t bytesPerPixel,
+                      char *dst, size_t size, std::vector<char> &shuffled) {
+    char *out = dst;
+    if (bytesPerPixel > 1) {
+        shuffled.resize(size);
+        out = shuffled.data();
+    }
+    uLongf outLength = size;
+    if (uncompress((Bytef *)out, &outLength, (const Bytef *)buf, length) !=
+            Z_OK ||
+        outLength != size) {
+        return false;
+    }
+    if (bytesPerPixel > 1) {
+        unshuffleBytes(shuffled.data(), size, bytesPerPixel, dst);
+    }
+    return true;
+}
+
+} // namespace sls
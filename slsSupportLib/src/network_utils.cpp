@@ -3,11 +3,14 @@
 #include "sls/sls_detector_exceptions.h"
 
 #include "sls/network_utils.h"
+#include "sls/string_utils.h"
 #include <algorithm>
 #include <arpa/inet.h>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <dirent.h>
+#include <fstream>
 #include <ifaddrs.h>
 #include <iomanip>
 #include <limits>
@@ -176,6 +179,63 @@ IpAddr InterfaceNameToIp(const std::string &ifn) {
     return IpAddr{host};
 }
 
+int InterfaceNameToNumaNode(const std::string &ifn) {
+    if (ifn.empty() || ifn.find('/') != std::string::npos) {
+        return -1;
+    }
+    std::ifstream file("/sys/class/net/" + ifn + "/device/numa_node");
+    int node = -1;
+    if (!(file >> node)) {
+        return -1;
+    }
+    return node;
+}
+
+std::vector<int> InterfaceNameToLocalCpus(const std::string &ifn) {
+    if (ifn.empty() || ifn.find('/') != std::string::npos) {
+        return {};
+    }
+    std::ifstream file("/sys/class/net/" + ifn + "/device/local_cpulist");
+    std::string list;
+    if (!(file >> list)) {
+        return {};
+    }
+    try {
+        return ParseCpuList(list);
+    } catch (const RuntimeError &) {
+        return {};
+    }
+}
+
+std::vector<int> InterfaceNameToIrqCpus(const std::string &ifn) {
+    if (ifn.empty() || ifn.find('/') != std::string::npos) {
+        return {};
+    }
+    std::vector<int> cpus;
+    std::string path = "/sys/class/net/" + ifn + "/device/msi_irqs";
+    DIR *dir = opendir(path.c_str());
+    if (dir == nullptr) {
+        return {};
+    }
+    while (struct dirent *entry = readdir(dir)) {
+        std::ifstream file(std::string("/proc/irq/") + entry->d_name +
+                           "/smp_affinity_list");
+        std::string list;
+        if (entry->d_name[0] == '.' || !(file >> list)) {
+            continue;
+        }
+        try {
+            auto irq = ParseCpuList(list);
+            cpus.insert(cpus.end(), irq.begin(), irq.end());
+        } catch (const RuntimeError &) {
+        }
+    }
+    closedir(dir);
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
 MacAddr InterfaceNameToMac(const std::string &inf) {
     // TODO! Copied from genericSocket needs to be refactored!
     struct ifreq ifr;
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <sched.h>
 #include <sls/ToString.h>
 #include <sstream>
 
@@ -66,4 +67,63 @@ std::pair<std::string, uint16_t> ParseHostPort(const std::string &s) {
     return std::make_pair(host, port);
 }
 
+std::vector<int> ParseCpuList(const std::string &s) {
+    // checked before expanding the range
+    auto toCpu = [&s](const std::string &value) {
+        int cpu = -1;
+        try {
+            cpu = std::stoi(value);
+        } catch (const std::out_of_range &) {
+        }
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+            throw RuntimeError("Invalid cpu list " + s + " (cpus from 0 to " +
+                               std::to_string(CPU_SETSIZE - 1) + ")");
+        }
+        return cpu;
+    };
+    std::vector<int> cpus;
+    for (const auto &range : split(s, ',')) {
+        auto limits = split(range, '-');
+        // split drops empty parts, eg. of "-1"
+        if (limits.size() < 1 || limits.size() > 2 ||
+            std::count(range.begin(), range.end(), '-') + 1 !=
+                static_cast<int>(limits.size()) ||
+            !is_int(limits[0]) || !is_int(limits.back())) {
+            throw RuntimeError("Invalid cpu list " + s);
+        }
+        int first = toCpu(limits[0]);
+        int last = toCpu(limits.back());
+        if (first > last) {
+            throw RuntimeError("Invalid cpu list " + s);
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::string ToCpuList(std::vector<int> cpus) {
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    std::ostringstream oss;
+    for (size_t i = 0; i < cpus.size();) {
+        size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+            ++j;
+        }
+        if (i != 0) {
+            oss << ',';
+        }
+        oss << cpus[i];
+        if (j != i) {
+            oss << '-' << cpus[j];
+        }
+        i = j + 1;
+    }
+    return oss.str();
+}
+
 }; // namespace sls
\ No newline at end of file
@@ -46,6 +46,42 @@ TEST_CASE("The server recive the same message as we send", "[support]") {
     CHECK(client.getSocketId() == -1);
 }
 
+/** replies to each int with the int + 1, closes after a negative one */
+void serveCommands(ServerSocket &server, int nCommands) {
+    for (int i = 0; i != nCommands; ++i) {
+        auto &socket = server.waitForCommand();
+        auto value = socket.Receive<int>();
+        socket.Send(value + 1);
+        if (value < 0) {
+            server.closeConnection(socket);
+        }
+    }
+}
+
+TEST_CASE("Server serves many commands on a connection kept open",
+          "[support]") {
+    auto server = ServerSocket(1950);
+    auto s = std::async(std::launch::async, serveCommands, std::ref(server), 5);
+    auto kept = DetectorSocket("localhost", 1950);
+    for (int i = 0; i != 3; ++i) {
+        CHECK(kept.isConnected());
+        kept.Send(i);
+        CHECK(kept.Receive<int>() == i + 1);
+        // another client in between
+        if (i == 1) {
+            auto other = DetectorSocket("localhost", 1950);
+            other.Send(10);
+            CHECK(other.Receive<int>() == 11);
+        }
+    }
+    // closed by the server
+    kept.Send(-5);
+    CHECK(kept.Receive<int>() == -4);
+    s.get();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    CHECK_FALSE(kept.isConnected());
+}
+
 TEST_CASE("throws on no server", "[support]") {
     CHECK_THROWS(DetectorSocket("localhost", 1950));
 }
@@ -100,6 +100,132 @@ TEST_CASE("Too small packet") {
     close(fd);
 }
 
+TEST_CASE("Receive a batch of packets") {
+    constexpr int port = 50001;
+    constexpr int n_packets = 3;
+    constexpr int batch = 8;
+    UdpRxSocket s(port, sizeof(int));
+    s.setBatchSize(batch);
+    CHECK(s.getBatchSize() == batch);
+    auto fd = open_socket(port);
+    for (int i = 0; i != n_packets; ++i) {
+        write(fd, &i, sizeof(i));
+    }
+    // too small packet
+    int16_t val = 10;
+    write(fd, &val, sizeof(val));
+
+    // a whole batch from any packet on
+    int buff[n_packets + batch]{};
+    int n = 0;
+    // all packets are queued on loopback, but allow for late ones, validity
+    // only known for the packets of the last call
+    while (n < n_packets + 1) {
+        int received = s.ReceivePackets(reinterpret_cast<char *>(buff + n));
+        for (int i = 0; i != received; ++i) {
+            CHECK(s.IsValidPacket(i) == (n + i < n_packets));
+        }
+        n += received;
+    }
+    CHECK(n == n_packets + 1);
+    for (int i = 0; i != n_packets; ++i) {
+        CHECK(buff[i] == i);
+    }
+    close(fd);
+}
+
+TEST_CASE("Scatter header and payload of a batch of packets") {
+    constexpr int port = 50001;
+    struct packet {
+        int header;
+        int payload[2];
+    };
+    UdpRxSocket s(port, sizeof(packet));
+    s.setBatchSize(4);
+    auto fd = open_socket(port);
+    for (int i = 0; i != 2; ++i) {
+        packet p{i, {10 * i, 10 * i + 1}};
+        write(fd, &p, sizeof(p));
+    }
+
+    int headers[4]{};
+    int payloads[4][2]{};
+    char *dst[4];
+    for (int i = 0; i != 4; ++i) {
+        // reverse order to check payloads go where they are told
+        dst[i] = reinterpret_cast<char *>(payloads[3 - i]);
+    }
+    int n = 0;
+    while (n < 2) {
+        int r = s.ReceivePackets(reinterpret_cast<char *>(headers + n),
+                                 sizeof(int), dst + n, 2 - n);
+        for (int i = 0; i != r; ++i) {
+            CHECK(s.IsValidPacket(i));
+        }
+        n += r;
+    }
+    for (int i = 0; i != 2; ++i) {
+        CHECK(headers[i] == i);
+        CHECK(payloads[3 - i][0] == 10 * i);
+        CHECK(payloads[3 - i][1] == 10 * i + 1);
+    }
+    close(fd);
+}
+
+TEST_CASE("Receive a batch of packets from packet ring or fall back") {
+    constexpr int port = 50001;
+    constexpr int n_packets = 3;
+    constexpr int batch = 8;
+    UdpRxSocket s(port, sizeof(int), "127.0.0.1");
+    s.setBatchSize(batch);
+    // needs CAP_NET_RAW, socket unchanged otherwise
+    bool ring = true;
+    try {
+        s.UsePacketRing("lo", 0);
+    } catch (const RuntimeError &) {
+        ring = false;
+    }
+    CHECK(s.IsPacketRing() == ring);
+    auto fd = open_socket(port);
+    for (int i = 0; i != n_packets; ++i) {
+        write(fd, &i, sizeof(i));
+    }
+
+    // a whole batch from any packet on
+    int buff[n_packets + batch]{};
+    int n = 0;
+    while (n < n_packets) {
+        int r = s.ReceivePackets(reinterpret_cast<char *>(buff + n));
+        for (int i = 0; i != r; ++i) {
+            CHECK(s.IsValidPacket(i));
+        }
+        n += r;
+    }
+    CHECK(n == n_packets);
+    for (int i = 0; i != n_packets; ++i) {
+        CHECK(buff[i] == i);
+    }
+    if (ring) {
+        CHECK(s.getRingStatistics().packets >= n_packets);
+    }
+    close(fd);
+
+    // shut down while waiting
+    auto receiving = std::async(std::launch::async, [&s, &buff]() {
+        return s.ReceivePackets(reinterpret_cast<char *>(buff));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    s.Shutdown();
+    CHECK(receiving.get() == 0);
+}
+
+TEST_CASE("Invalid batch size") {
+    UdpRxSocket s(default_port, sizeof(int));
+    CHECK(s.getBatchSize() == 1);
+    CHECK_THROWS(s.setBatchSize(0));
+    CHECK_THROWS(s.setBatchSize(1025));
+}
+
 TEST_CASE("Receive an int to an external buffer") {
     int to_send = 5;
     int received = -1;
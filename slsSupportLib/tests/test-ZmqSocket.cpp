@@ -2,6 +2,12 @@
 // Copyright (C) 2021 Contributors to the SLS Detector Package
 #include "catch.hpp"
 #include "sls/ZmqSocket.h"
+#include "sls/compression_utils.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
 
 namespace sls {
 
@@ -90,6 +96,127 @@ TEST_CASE("Send serveral headers of different length") {
     REQUIRE(received_header.fname == "short");
 }
 
+zmqHeader makeTestHeader(uint64_t frameNumber) {
+    zmqHeader header;
+    header.data = true;
+    header.jsonversion = 0;
+    header.dynamicRange = 16;
+    header.fileIndex = 3;
+    header.ndetx = 2;
+    header.ndety = 4;
+    header.npixelsx = 1024;
+    header.npixelsy = 256;
+    header.imageSize = 1024 * 256 * 2;
+    header.acqIndex = frameNumber;
+    header.frameIndex = frameNumber - 1;
+    header.progress = 12.5;
+    header.fname = "/data/run";
+    header.frameNumber = frameNumber;
+    header.expLength = 5;
+    header.packetNumber = 64;
+    header.detSpec1 = 0x123456789ABCDEF;
+    header.timestamp = 987654321012;
+    header.modId = 7;
+    header.row = 1;
+    header.column = 3;
+    header.detSpec2 = 11;
+    header.detSpec3 = 12;
+    header.detSpec4 = 13;
+    header.detType = 3;
+    header.version = 2;
+    header.flipRows = 1;
+    header.quad = 0;
+    header.completeImage = true;
+    header.addJsonHeader = {{"key1", "value1"}, {"key2", "value2"}};
+    header.rx_roi = {0, 1023, 0, 255};
+    return header;
+}
+
+void checkHeader(const zmqHeader &a, const zmqHeader &b) {
+    CHECK(a.data == b.data);
+    CHECK(a.jsonversion == b.jsonversion);
+    CHECK(a.dynamicRange == b.dynamicRange);
+    CHECK(a.fileIndex == b.fileIndex);
+    CHECK(a.ndetx == b.ndetx);
+    CHECK(a.ndety == b.ndety);
+    CHECK(a.npixelsx == b.npixelsx);
+    CHECK(a.npixelsy == b.npixelsy);
+    CHECK(a.imageSize == b.imageSize);
+    CHECK(a.acqIndex == b.acqIndex);
+    CHECK(a.frameIndex == b.frameIndex);
+    CHECK(a.progress == b.progress);
+    CHECK(a.fname == b.fname);
+    CHECK(a.frameNumber == b.frameNumber);
+    CHECK(a.expLength == b.expLength);
+    CHECK(a.packetNumber == b.packetNumber);
+    CHECK(a.detSpec1 == b.detSpec1);
+    CHECK(a.timestamp == b.timestamp);
+    CHECK(a.modId == b.modId);
+    CHECK(a.row == b.row);
+    CHECK(a.column == b.column);
+    CHECK(a.detSpec2 == b.detSpec2);
+    CHECK(a.detSpec3 == b.detSpec3);
+    CHECK(a.detSpec4 == b.detSpec4);
+    CHECK(a.detType == b.detType);
+    CHECK(a.version == b.version);
+    CHECK(a.flipRows == b.flipRows);
+    CHECK(a.quad == b.quad);
+    CHECK(a.completeImage == b.completeImage);
+    CHECK(a.addJsonHeader == b.addJsonHeader);
+    CHECK(a.rx_roi == b.rx_roi);
+    CHECK(a.compression == b.compression);
+}
+
+TEST_CASE("Send all header fields as json and binary") {
+    constexpr int port = 50001;
+    ZmqSocket sub("localhost", port);
+    sub.Connect();
+
+    ZmqSocket pub(port, "*");
+
+    for (bool binary : {false, true}) {
+        pub.SetBinaryHeader(binary);
+        zmqHeader received_header;
+        // first renders the template, then only the fields of each frame
+        for (uint64_t fnum = 1; fnum != 4; ++fnum) {
+            zmqHeader header = makeTestHeader(fnum);
+            header.data = false;
+            if (fnum == 3) {
+                header.addJsonHeader["key3"] = "value3";
+                header.compression = ZMQ_CODEC_SHUFFLE_DEFLATE;
+            }
+            pub.SendHeader(0, header);
+            REQUIRE(sub.ReceiveHeader(0, received_header, 0) == 0);
+            checkHeader(received_header, header);
+        }
+    }
+}
+
+TEST_CASE("Benchmark sending json and binary headers", "[.bench]") {
+    constexpr int port = 50001;
+    constexpr int nHeaders = 100000;
+    ZmqSocket sub("localhost", port);
+    sub.Connect();
+
+    ZmqSocket pub(port, "*");
+    std::vector<char> data(4);
+    for (bool binary : {false, true}) {
+        pub.SetBinaryHeader(binary);
+        zmqHeader received_header;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i != nHeaders; ++i) {
+            pub.SendHeader(0, makeTestHeader(i + 1));
+            pub.SendData(data.data(), data.size());
+            sub.ReceiveHeader(0, received_header, 0);
+            sub.ReceiveData(0, data.data(), data.size());
+        }
+        std::chrono::duration<double> t =
+            std::chrono::steady_clock::now() - start;
+        std::cout << (binary ? "binary" : "json") << ": "
+                  << nHeaders / t.count() / 1e3 << " kHz\n";
+    }
+}
+
 TEST_CASE("Send header and data") {
     constexpr int port = 50001;
     ZmqSocket sub("localhost", port);
@@ -117,4 +244,69 @@ TEST_CASE("Send header and data") {
     }
 }
 
+TEST_CASE("Send data without copy") {
+    constexpr int port = 50001;
+    ZmqSocket sub("localhost", port);
+    sub.Connect();
+
+    ZmqSocket pub(port, "*");
+
+    std::vector<int> data{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    const int nbytes = data.size() * sizeof(decltype(data)::value_type);
+    zmqHeader header;
+    header.data = true;
+    header.imageSize = nbytes;
+
+    std::atomic<int> released{0};
+    auto release = [](void *, void *hint) {
+        ++*static_cast<std::atomic<int> *>(hint);
+    };
+    pub.SendHeader(0, header);
+    pub.SendData((char *)data.data(), nbytes, release, &released);
+
+    zmqHeader received_header;
+    sub.ReceiveHeader(0, received_header, 0);
+    std::vector<int> received_data(data.size());
+    sub.ReceiveData(0, (char *)received_data.data(), nbytes);
+    REQUIRE(received_data == data);
+    for (int i = 0; i != 1000 && released == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(released == 1);
+}
+
+TEST_CASE("Receive compressed data") {
+    constexpr int port = 50001;
+    ZmqSocket sub("localhost", port);
+    sub.Connect();
+
+    ZmqSocket pub(port, "*");
+
+    std::vector<uint16_t> data(1024);
+    for (size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<uint16_t>(i % 100);
+    }
+    const int nbytes = data.size() * sizeof(uint16_t);
+    std::vector<char> shuffled, compressed;
+    REQUIRE(shuffleDeflate((char *)data.data(), nbytes, bytesPerPixel(16), 1,
+                           shuffled, compressed));
+    zmqHeader header;
+    header.data = true;
+    header.dynamicRange = 16;
+    header.imageSize = nbytes;
+    header.compression = ZMQ_CODEC_SHUFFLE_DEFLATE;
+
+    pub.SendHeader(0, header);
+    pub.SendData(compressed.data(), compressed.size());
+
+    zmqHeader received_header;
+    sub.ReceiveHeader(0, received_header, 0);
+    REQUIRE(received_header.compression == ZMQ_CODEC_SHUFFLE_DEFLATE);
+    REQUIRE(received_header.imageSize == (uint32_t)nbytes);
+    std::vector<uint16_t> received_data(data.size());
+    REQUIRE(sub.ReceiveData(0, (char *)received_data.data(), nbytes) ==
+            nbytes);
+    REQUIRE(received_data == data);
+}
+
 } // namespace sls
\ No newline at end of file
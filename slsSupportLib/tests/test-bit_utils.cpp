@@ -2,6 +2,8 @@
 // Copyright (C) 2021 Contributors to the SLS Detector Package
 #include "catch.hpp"
 #include "sls/bit_utils.h"
+#include <chrono>
+#include <iostream>
 #include <vector>
 
 namespace sls {
@@ -42,4 +44,68 @@ TEST_CASE("Get set bits from 523") {
     REQUIRE(vec == std::vector<int>{0, 1, 3, 9});
 }
 
+TEST_CASE("Unpack 12 bit pixels to 16 bit") {
+    // 0x123, 0xabc, 0xfff, 0x000
+    std::vector<uint8_t> src{0x23, 0xc1, 0xab, 0xff, 0x0f, 0x00};
+    std::vector<uint16_t> dst(4);
+    unpack12To16Bit(dst.data(), src.data(), dst.size());
+    REQUIRE(dst == std::vector<uint16_t>{0x123, 0xabc, 0xfff, 0x000});
+}
+
+TEST_CASE("Unpack 12 bit pixels with simd as scalar, including tails") {
+    std::vector<uint8_t> src(3 * 1000);
+    for (size_t i = 0; i != src.size(); ++i) {
+        src[i] = static_cast<uint8_t>(i * 37 + (i >> 5));
+    }
+    for (size_t n = 0; n <= 2 * 1000; n += (n < 100) ? 2 : 222) {
+        std::vector<uint16_t> expected(n), result(n + 1, 0xdead);
+        unpack12To16BitScalar(expected.data(), src.data(), n);
+        unpack12To16Bit(result.data(), src.data(), n);
+        // nothing written past n
+        CHECK(result.back() == 0xdead);
+        result.pop_back();
+        CHECK(result == expected);
+    }
+}
+
+// as it was in the receiver hdf5 writer
+void unpack12To16BitBytewise(uint16_t *dst, uint8_t *src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        *dst = (uint16_t)(*src++ & 0xFF);
+        *dst++ |= (uint16_t)((*src & 0xF) << 8u);
+        ++i;
+        *dst = (uint16_t)((*src++ & 0xF0) >> 4u);
+        *dst++ |= (uint16_t)((*src++ & 0xFF) << 4u);
+    }
+}
+
+TEST_CASE("Benchmark 12 to 16 bit unpacking", "[.bench]") {
+    // eiger half module
+    constexpr size_t n = 256 * 2 * 256;
+    constexpr int nFrames = 2000;
+    std::vector<uint8_t> src(n / 2 * 3);
+    for (size_t i = 0; i != src.size(); ++i) {
+        src[i] = static_cast<uint8_t>(i * 37);
+    }
+    std::vector<uint16_t> dst(n);
+    auto run = [&](const char *name, void (*func)(uint16_t *, uint8_t *,
+                                                   size_t)) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i != nFrames; ++i) {
+            func(dst.data(), src.data(), n);
+        }
+        std::chrono::duration<double> t =
+            std::chrono::steady_clock::now() - start;
+        std::cout << name << ": " << nFrames * n / t.count() / 1e6
+                  << " Mpixels/s\n";
+    };
+    run("bytewise", unpack12To16BitBytewise);
+    run("scalar", [](uint16_t *d, uint8_t *s, size_t n) {
+        unpack12To16BitScalar(d, s, n);
+    });
+    run("simd", [](uint16_t *d, uint8_t *s, size_t n) {
+        unpack12To16Bit(d, s, n);
+    });
+}
+
 } // namespace sls
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: LGPL-3.0-or-other
+// Copyright (C) 2021 Contributors to the SLS Detector Package
+#include "catch.hpp"
+#include "sls/compression_utils.h"
+
+#include <vector>
+
+namespace sls {
+
+TEST_CASE("Bytes shuffled as one pixel") {
+    CHECK(bytesPerPixel(4) == 1);
+    CHECK(bytesPerPixel(8) == 1);
+    CHECK(bytesPerPixel(12) == 1);
+    CHECK(bytesPerPixel(16) == 2);
+    CHECK(bytesPerPixel(32) == 4);
+}
+
+TEST_CASE("Shuffle bytes to byte planes of the pixels") {
+    // 50 pixels of 2 bytes and a remainder
+    std::vector<char> image(101);
+    for (size_t i = 0; i != image.size(); ++i) {
+        image[i] = static_cast<char>(i);
+    }
+    std::vector<char> shuffled(image.size());
+    shuffleBytes(image.data(), image.size(), 2, shuffled.data());
+    for (size_t i = 0; i != 50; ++i) {
+        CHECK(shuffled[i] == image[2 * i]);
+        CHECK(shuffled[50 + i] == image[2 * i + 1]);
+    }
+    CHECK(shuffled[100] == image[100]);
+    std::vector<char> result(image.size());
+    unshuffleBytes(shuffled.data(), shuffled.size(), 2, result.data());
+    CHECK(result == image);
+}
+
+TEST_CASE("Compress and decompress image data") {
+    for (size_t bytesPerPixel : {1, 2, 4}) {
+        // odd size for a remainder that is not shuffled
+        std::vector<char> image(1000 * bytesPerPixel + 1);
+        for (size_t i = 0; i != image.size(); ++i) {
+            image[i] = static_cast<char>((i / bytesPerPixel) % 7);
+        }
+        std::vector<char> shuffled, compressed;
+        REQUIRE(shuffleDeflate(image.data(), image.size(), bytesPerPixel, 1,
+                               shuffled, compressed));
+        CHECK(compressed.size() < image.size());
+        std::vector<char> result(image.size());
+        REQUIRE(inflateUnshuffle(compressed.data(), compressed.size(),
+                                 bytesPerPixel, result.data(), result.size(),
+                                 shuffled));
+        CHECK(result == image);
+        // corrupt
+        CHECK_FALSE(inflateUnshuffle(compressed.data(), compressed.size() / 2,
+                                     bytesPerPixel, result.data(),
+                                     result.size(), shuffled));
+    }
+}
+
+TEST_CASE("Data that does not compress is only shuffled") {
+    std::vector<char> image(1000);
+    uint32_t x = 12345;
+    for (auto &it : image) {
+        x = x * 1664525 + 1013904223;
+        it = static_cast<char>(x >> 24);
+    }
+    std::vector<char> shuffled, compressed;
+    CHECK_FALSE(
+        shuffleDeflate(image.data(), image.size(), 2, 1, shuffled, compressed));
+    std::vector<char> expected(image.size());
+    shuffleBytes(image.data(), image.size(), 2, expected.data());
+    CHECK(shuffled == expected);
+}
+
+} // namespace sls
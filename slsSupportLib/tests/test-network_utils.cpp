@@ -114,6 +114,19 @@ TEST_CASE("Copy construct a MacAddr") {
     CHECK(addr == addr2);
 }
 
+TEST_CASE("Numa node of interface without device is unknown", "[support]") {
+    CHECK(InterfaceNameToNumaNode("lo") == -1);
+    CHECK(InterfaceNameToNumaNode("") == -1);
+    CHECK(InterfaceNameToNumaNode("../lo") == -1);
+}
+
+TEST_CASE("Cpus of interface without device are unknown", "[support]") {
+    CHECK(InterfaceNameToLocalCpus("lo").empty());
+    CHECK(InterfaceNameToIrqCpus("lo").empty());
+    CHECK(InterfaceNameToLocalCpus("../lo").empty());
+    CHECK(InterfaceNameToIrqCpus("").empty());
+}
+
 TEST_CASE("udp dst struct basic properties") {
     static_assert(sizeof(UdpDestination) == 32,
                   "udpDestination struct size does not match");
@@ -123,6 +123,32 @@ TEST_CASE("port missing") {
     REQUIRE(res.second == 0);
 }
 
+TEST_CASE("parse cpu list") {
+    REQUIRE(ParseCpuList("0-3,8") == std::vector<int>{0, 1, 2, 3, 8});
+    REQUIRE(ParseCpuList("5") == std::vector<int>{5});
+    REQUIRE(ParseCpuList("8,2,2-3") == std::vector<int>{2, 3, 8});
+    REQUIRE(ParseCpuList("").empty());
+    REQUIRE_THROWS(ParseCpuList("3-1"));
+    REQUIRE_THROWS(ParseCpuList("a"));
+    REQUIRE_THROWS(ParseCpuList("1-2-3"));
+}
+
+TEST_CASE("Parse cpu list out of range") {
+    REQUIRE(ParseCpuList("1022-1023") == std::vector<int>{1022, 1023});
+    REQUIRE_THROWS(ParseCpuList("0-2000000000"));
+    REQUIRE_THROWS(ParseCpuList("0-2147483647"));
+    REQUIRE_THROWS(ParseCpuList("99999999999"));
+    REQUIRE_THROWS(ParseCpuList("1024"));
+    REQUIRE_THROWS(ParseCpuList("-1"));
+    REQUIRE_THROWS(ParseCpuList("1--3"));
+}
+
+TEST_CASE("cpu list to string") {
+    REQUIRE(ToCpuList({0, 1, 2, 3, 8}) == "0-3,8");
+    REQUIRE(ToCpuList({8, 5, 4}) == "4-5,8");
+    REQUIRE(ToCpuList({}).empty());
+}
+
 // TEST_CASE("concat things not being strings")
 
 } // namespace sls